@@ -25,7 +25,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 174
+#define ANGLE_SH_VERSION 179
 
 enum ShShaderSpec
 {
@@ -218,6 +218,22 @@ const ShCompileOptions SH_EMULATE_ATAN2_FLOAT_FUNCTION = UINT64_C(1) << 30;
 // "uniform highp uint webgl_angle_ViewID_OVR".
 const ShCompileOptions SH_TRANSLATE_VIEWID_OVR_TO_UNIFORM = UINT64_C(1) << 31;
 
+// Set to 1 to record the time and the pool memory taken by every stage of the compilation. They
+// can be retrieved with sh::GetCompileStatistics.
+const ShCompileOptions SH_COMPILE_STATISTICS = UINT64_C(1) << 32;
+
+// Set to 1 to propagate constants and remove dead code after the variables have been collected:
+// branches with constant conditions, unread variables and the stores to them, and the functions
+// that are no longer called. Variables that are only used in the removed code are still reported
+// as statically used.
+const ShCompileOptions SH_OPTIMIZE_TREE = UINT64_C(1) << 33;
+
+// Set to 1 to write compact GLSL/ESSL output: the variables and functions that aren't part of the
+// interface of the shader get short names, and redundant whitespace and parentheses are left out.
+// The names are assigned in the same order on every compile. Uniforms, attributes, varyings,
+// outputs and interface blocks keep the names reported through sh::GetUniforms and the like.
+const ShCompileOptions SH_MINIFY_OUTPUT = UINT64_C(1) << 34;
+
 // Defines alternate strategies for implementing array index clamping.
 enum ShArrayIndexClampingStrategy
 {
@@ -525,6 +541,84 @@ bool GetInterfaceBlockRegister(const ShHandle handle,
 // Note that the map contains also registers of samplers that have been extracted from structs.
 const std::map<std::string, unsigned int> *GetUniformRegisterMap(const ShHandle handle);
 
+// Memory statistics of the pool allocator of a compiler, accumulated since its construction.
+struct PoolAllocatorStats
+{
+    // Number and total size of the allocations made in the pool.
+    size_t allocationCount;
+    size_t allocatedBytes;
+    // Largest amount of pool memory in use at once, including the unused end of pages.
+    size_t peakBytes;
+    // Pages owned by the compiler, in use or kept for the next compile.
+    size_t pageCount;
+};
+
+// Returns the pool allocator statistics of a compiler.
+// Parameters:
+// handle: Specifies the compiler
+PoolAllocatorStats GetPoolAllocatorStats(const ShHandle handle);
+
+// Cost of one stage of a compilation: preprocessing, parsing, one of the passes run on the AST or
+// the output of the object code. Passes that share a traversal of the AST are reported as one
+// stage, named after all of them joined with '+'.
+struct CompileStageStatistics
+{
+    std::string name;
+    double seconds;
+    // Bytes allocated from the pool allocator during the stage.
+    size_t allocatedBytes;
+};
+
+struct CompileStatistics
+{
+    // Stages in the order they ran.
+    std::vector<CompileStageStatistics> stages;
+    // Wall time of the whole compilation.
+    double totalSeconds;
+    PoolAllocatorStats poolAllocator;
+};
+
+// Returns the statistics of the last compilation done with SH_COMPILE_STATISTICS. The stages are
+// empty if the last compilation didn't use that option.
+// Parameters:
+// handle: Specifies the compiler
+CompileStatistics GetCompileStatistics(const ShHandle handle);
+
+// A shader to compile with CompileBatch.
+struct BatchCompileJob
+{
+    sh::GLenum type;
+    std::vector<std::string> sources;
+    ShCompileOptions compileOptions;
+};
+
+// The outcome of a BatchCompileJob. The object code and variables are only filled in when the
+// job asked for them with SH_OBJECT_CODE and SH_VARIABLES.
+struct BatchCompileResult
+{
+    bool success;
+    int shaderVersion;
+    std::string infoLog;
+    std::string objectCode;
+    std::vector<sh::Uniform> uniforms;
+    std::vector<sh::Varying> varyings;
+    std::vector<sh::Attribute> attributes;
+    std::vector<sh::OutputVariable> outputVariables;
+    std::vector<sh::InterfaceBlock> interfaceBlocks;
+};
+
+// Compiles a batch of shaders on worker threads. Every thread constructs its own compilers, so
+// this only needs Initialize() to have been called. Returns one result per job, in job order.
+// Parameters:
+// spec, output, resources: Used to construct the compilers, see ConstructCompiler.
+// jobs: Specifies the shaders to compile.
+// maxThreads: Specifies the number of threads to use, 0 to use one per hardware thread.
+std::vector<BatchCompileResult> CompileBatch(ShShaderSpec spec,
+                                             ShShaderOutput output,
+                                             const ShBuiltInResources &resources,
+                                             const std::vector<BatchCompileJob> &jobs,
+                                             size_t maxThreads);
+
 }  // namespace sh
 
 #endif // GLSLANG_SHADERLANG_H_
@@ -9,6 +9,7 @@
 #ifndef ANGLE_PLATFORM_H
 #define ANGLE_PLATFORM_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #if defined(_WIN32)
@@ -192,6 +193,31 @@ inline void ANGLE_overrideWorkaroundsD3D(PlatformMethods *platform,
 {
 }
 
+// Blob cache ---------------------------------------------------------
+
+// Stores a blob under a key, in the style of EGL_ANDROID_blob_cache. ANGLE uses it to keep the
+// binaries of linked programs between runs. The platform may drop any blob at any time, and a
+// later blob stored under the same key replaces the earlier one.
+inline void ANGLE_setBlob(PlatformMethods *platform,
+                          const void *key,
+                          size_t keySize,
+                          const void *value,
+                          size_t valueSize)
+{
+}
+
+// Returns the size of the blob stored under the key, or 0 if there is none. The blob is copied
+// to value only if valueSize is at least that size, so ANGLE first calls it with a null value to
+// learn the size.
+inline size_t ANGLE_getBlob(PlatformMethods *platform,
+                            const void *key,
+                            size_t keySize,
+                            void *value,
+                            size_t valueSize)
+{
+    return 0;
+}
+
 // Platform methods are enumerated here once.
 #define ANGLE_PLATFORM_OP(OP)       \
     OP(currentTime)                 \
@@ -206,7 +232,9 @@ inline void ANGLE_overrideWorkaroundsD3D(PlatformMethods *platform,
     OP(histogramEnumeration)        \
     OP(histogramSparse)             \
     OP(histogramBoolean)            \
-    OP(overrideWorkaroundsD3D)
+    OP(overrideWorkaroundsD3D)      \
+    OP(setBlob)                     \
+    OP(getBlob)
 
 #define ANGLE_PLATFORM_METHOD_DEF(Name) decltype(&ANGLE_##Name) Name = ANGLE_##Name;
 
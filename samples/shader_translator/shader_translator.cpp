@@ -11,10 +11,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
+#include <chrono>
 #include <sstream>
 #include <vector>
 #include "angle_gl.h"
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
 //
 // Return codes from main.
 //
@@ -29,9 +37,16 @@ enum TFailCode
 static void usage();
 static sh::GLenum FindShaderType(const char *fileName);
 static bool CompileFile(char *fileName, ShHandle compiler, ShCompileOptions compileOptions);
+static TFailCode CompileDirectory(const std::string &directory,
+                                  ShShaderSpec spec,
+                                  ShShaderOutput output,
+                                  const ShBuiltInResources &resources,
+                                  ShCompileOptions compileOptions,
+                                  int threadCount);
 static void LogMsg(const char *msg, const char *name, const int num, const char *logName);
 static void PrintVariable(const std::string &prefix, size_t index, const sh::ShaderVariable &var);
 static void PrintActiveVariables(ShHandle compiler);
+static void PrintCompileStatistics(ShHandle compiler);
 
 // If NUM_SOURCE_STRINGS is set to a value > 1, the input file data is
 // broken into that many chunks. This will affect file/line numbering in
@@ -76,6 +91,8 @@ int main(int argc, char *argv[])
     ShHandle computeCompiler  = 0;
     ShShaderSpec spec = SH_GLES2_SPEC;
     ShShaderOutput output = SH_ESSL_OUTPUT;
+    const char *batchDirectory = nullptr;
+    int batchThreadCount       = 0;
 
     sh::Initialize();
 
@@ -93,7 +110,26 @@ int main(int argc, char *argv[])
               case 'i': compileOptions |= SH_INTERMEDIATE_TREE; break;
               case 'o': compileOptions |= SH_OBJECT_CODE; break;
               case 'u': compileOptions |= SH_VARIABLES; break;
+              case 't': compileOptions |= SH_COMPILE_STATISTICS; break;
               case 'p': resources.WEBGL_debug_shader_precision = 1; break;
+              case 'd':
+                  if (argv[0][2] == '=' && argv[0][3] != '\0')
+                  {
+                      batchDirectory = &argv[0][3];
+                  }
+                  else
+                  {
+                      failCode = EFailUsage;
+                  }
+                  break;
+              case 'j':
+                  if (argv[0][2] != '=' ||
+                      !ParseIntValue(&argv[0][sizeof("-j=") - 1], 0, &batchThreadCount) ||
+                      batchThreadCount < 0)
+                  {
+                      failCode = EFailUsage;
+                  }
+                  break;
               case 's':
                 if (argv[0][2] == '=')
                 {
@@ -285,6 +321,13 @@ int main(int argc, char *argv[])
                     LogMsg("END", "COMPILER", numCompiles, "VARIABLES");
                     printf("\n\n");
                 }
+                if (compileOptions & SH_COMPILE_STATISTICS)
+                {
+                    LogMsg("BEGIN", "COMPILER", numCompiles, "STATISTICS");
+                    PrintCompileStatistics(compiler);
+                    LogMsg("END", "COMPILER", numCompiles, "STATISTICS");
+                    printf("\n\n");
+                }
                 if (!compiled)
                   failCode = EFailCompile;
                 ++numCompiles;
@@ -296,7 +339,18 @@ int main(int argc, char *argv[])
         }
     }
 
-    if ((vertexCompiler == 0) && (fragmentCompiler == 0) && (computeCompiler == 0))
+    if (batchDirectory != nullptr && failCode == ESuccess)
+    {
+        if (spec != SH_GLES2_SPEC && spec != SH_WEBGL_SPEC)
+        {
+            resources.MaxDrawBuffers             = 8;
+            resources.MaxVertexTextureImageUnits = 16;
+            resources.MaxTextureImageUnits       = 16;
+        }
+        failCode = CompileDirectory(batchDirectory, spec, output, resources, compileOptions,
+                                    batchThreadCount);
+    }
+    else if ((vertexCompiler == 0) && (fragmentCompiler == 0) && (computeCompiler == 0))
         failCode = EFailUsage;
     if (failCode == EFailUsage)
         usage();
@@ -320,11 +374,16 @@ void usage()
 {
     // clang-format off
     printf(
-        "Usage: translate [-i -o -u -l -p -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "Usage: translate [-i -o -u -t -l -p -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "       translate [options] -d=DIR [-j=NUM]\n"
         "Where: filename : filename ending in .frag or .vert\n"
+        "       -d=DIR   : compile the .vert, .frag and .comp files of DIR in parallel and print\n"
+        "                  the throughput\n"
+        "       -j=NUM   : number of threads used with -d (default one per core)\n"
         "       -i       : print intermediate tree\n"
         "       -o       : print translated code\n"
         "       -u       : print active attribs, uniforms, varyings and program outputs\n"
+        "       -t       : print the time and pool memory taken by every compilation stage\n"
         "       -p       : use precision emulation\n"
         "       -s=e2    : use GLES2 spec (this is by default)\n"
         "       -s=e3    : use GLES3 spec (in development)\n"
@@ -397,6 +456,108 @@ bool CompileFile(char *fileName, ShHandle compiler, ShCompileOptions compileOpti
     return ret ? true : false;
 }
 
+//
+//   List the shader files directly inside a directory, sorted by name
+//
+static bool ListShaderFiles(const std::string &directory, std::vector<std::string> *fileNames)
+{
+#if defined(_WIN32)
+    WIN32_FIND_DATAA findData;
+    HANDLE findHandle = FindFirstFileA((directory + "\\*").c_str(), &findData);
+    if (findHandle == INVALID_HANDLE_VALUE)
+        return false;
+    do
+    {
+        if ((findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+            fileNames->push_back(findData.cFileName);
+    } while (FindNextFileA(findHandle, &findData));
+    FindClose(findHandle);
+#else
+    DIR *dir = opendir(directory.c_str());
+    if (!dir)
+        return false;
+    while (dirent *entry = readdir(dir))
+    {
+        if (entry->d_name[0] != '.')
+            fileNames->push_back(entry->d_name);
+    }
+    closedir(dir);
+#endif
+
+    fileNames->erase(std::remove_if(fileNames->begin(), fileNames->end(),
+                                    [](const std::string &fileName) {
+                                        const char *ext = strrchr(fileName.c_str(), '.');
+                                        return !ext || (strncmp(ext, ".frag", 5) != 0 &&
+                                                        strncmp(ext, ".vert", 5) != 0 &&
+                                                        strncmp(ext, ".comp", 5) != 0);
+                                    }),
+                     fileNames->end());
+    std::sort(fileNames->begin(), fileNames->end());
+    return true;
+}
+
+//
+//   Compile all the shaders of a directory with sh::CompileBatch and report the throughput
+//
+TFailCode CompileDirectory(const std::string &directory,
+                           ShShaderSpec spec,
+                           ShShaderOutput output,
+                           const ShBuiltInResources &resources,
+                           ShCompileOptions compileOptions,
+                           int threadCount)
+{
+    std::vector<std::string> fileNames;
+    if (!ListShaderFiles(directory, &fileNames))
+    {
+        printf("Error: unable to read directory: %s\n", directory.c_str());
+        return EFailUsage;
+    }
+
+    std::vector<sh::BatchCompileJob> jobs;
+    size_t sourceBytes = 0;
+    for (const std::string &fileName : fileNames)
+    {
+        std::string path = directory + "/" + fileName;
+        ShaderSource source;
+        if (!ReadShaderSource(path.c_str(), source))
+            return EFailCompile;
+
+        sh::BatchCompileJob job;
+        job.type           = FindShaderType(path.c_str());
+        job.compileOptions = compileOptions;
+        for (const char *chunk : source)
+        {
+            job.sources.push_back(chunk);
+            sourceBytes += job.sources.back().size();
+        }
+        FreeShaderSource(source);
+        jobs.push_back(job);
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<sh::BatchCompileResult> results =
+        sh::CompileBatch(spec, output, resources, jobs, threadCount);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+    size_t failedCount = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (!results[i].success)
+        {
+            ++failedCount;
+            printf("%s: compile failed\n%s\n", fileNames[i].c_str(), results[i].infoLog.c_str());
+        }
+    }
+
+    double seconds = std::max(elapsed.count(), 1e-9);
+    printf("Compiled %u shaders (%u failed) from %s in %.1f ms: %.1f shaders/s, %.1f KB/s\n",
+           static_cast<unsigned int>(results.size()), static_cast<unsigned int>(failedCount),
+           directory.c_str(), seconds * 1000.0, results.size() / seconds,
+           sourceBytes / 1024.0 / seconds);
+
+    return failedCount == 0 ? ESuccess : EFailCompile;
+}
+
 void LogMsg(const char *msg, const char *name, const int num, const char *logName)
 {
     printf("#### %s %s %d %s ####\n", msg, name, num, logName);
@@ -631,6 +792,21 @@ static bool ReadShaderSource(const char *fileName, ShaderSource &source)
     return true;
 }
 
+static void PrintCompileStatistics(ShHandle compiler)
+{
+    sh::CompileStatistics statistics = sh::GetCompileStatistics(compiler);
+
+    for (const sh::CompileStageStatistics &stage : statistics.stages)
+    {
+        printf("%-48s %10.3f ms %10zu bytes\n", stage.name.c_str(), stage.seconds * 1000.0,
+               stage.allocatedBytes);
+    }
+    printf("%-48s %10.3f ms\n", "Total", statistics.totalSeconds * 1000.0);
+    printf("Pool allocator: %zu allocations, %zu bytes allocated, %zu bytes peak, %zu pages\n",
+           statistics.poolAllocator.allocationCount, statistics.poolAllocator.allocatedBytes,
+           statistics.poolAllocator.peakBytes, statistics.poolAllocator.pageCount);
+}
+
 static void FreeShaderSource(ShaderSource &source)
 {
     for (ShaderSource::size_type i = 0; i < source.size(); ++i)
@@ -0,0 +1,617 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TraceRecorder:
+//   Implementation of the built-in trace recorder.
+//
+
+#include "common/TraceRecorder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/debug.h"
+#include "third_party/trace_event/trace_event.h"
+
+namespace angle
+{
+
+namespace
+{
+
+constexpr size_t kMaxCategories         = 32;
+constexpr size_t kRecordsPerThread      = 4096;
+constexpr size_t kMaxArgs               = 2;
+constexpr size_t kMaxCopiedStringLength = 32;
+constexpr std::chrono::milliseconds kFlushInterval(100);
+
+// Names and argument names must be literals, except for names recorded with
+// TRACE_EVENT_FLAG_COPY. Copied names and strings are truncated to fit in the record.
+struct TraceRecord
+{
+    double timestamp;
+    const char *name;
+    unsigned long long id;
+    unsigned int threadId;
+    size_t categoryIndex;
+    char phase;
+    unsigned char flags;
+    int numArgs;
+    std::array<const char *, kMaxArgs> argNames;
+    std::array<unsigned char, kMaxArgs> argTypes;
+    std::array<unsigned long long, kMaxArgs> argValues;
+
+    std::array<char, kMaxCopiedStringLength> copiedName;
+    std::array<std::array<char, kMaxCopiedStringLength>, kMaxArgs> copiedArgs;
+};
+
+// A ring buffer with a single writer, the thread that owns it, and a single reader, the flush.
+// Buffers are never freed, and are reused by new threads once their thread exits.
+struct ThreadBuffer
+{
+    std::array<TraceRecord, kRecordsPerThread> records;
+    std::atomic<size_t> writeIndex{0};
+    std::atomic<size_t> readIndex{0};
+    std::atomic<size_t> droppedCount{0};
+    std::atomic<bool> inUse{false};
+};
+
+struct ThreadBufferHolder
+{
+    ~ThreadBufferHolder()
+    {
+        if (buffer)
+        {
+            buffer->inUse.store(false, std::memory_order_release);
+        }
+    }
+
+    ThreadBuffer *buffer  = nullptr;
+    unsigned int threadId = 0;
+};
+
+thread_local ThreadBufferHolder gThreadBuffer;
+
+void CopyString(const char *source, std::array<char, kMaxCopiedStringLength> *destination)
+{
+    strncpy(destination->data(), source, destination->size() - 1);
+    destination->back() = '\0';
+}
+
+void WriteTimestamp(std::ostream &stream, double timestamp)
+{
+    char formatted[32];
+    snprintf(formatted, sizeof(formatted), "%.3f", timestamp);
+    stream << formatted;
+}
+
+void WriteEscapedString(std::ostream &stream, const char *string)
+{
+    stream << '"';
+    for (const char *character = string; *character != '\0'; ++character)
+    {
+        switch (*character)
+        {
+            case '"':
+                stream << "\\\"";
+                break;
+            case '\\':
+                stream << "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(*character) < 0x20)
+                {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", *character);
+                    stream << escaped;
+                }
+                else
+                {
+                    stream << *character;
+                }
+                break;
+        }
+    }
+    stream << '"';
+}
+
+class TraceRecorder final : angle::NonCopyable
+{
+  public:
+    static TraceRecorder *GetInstance();
+
+    bool start(const std::string &path);
+    void stop();
+    void flush();
+
+    const unsigned char *getCategoryEnabledFlag(const char *categoryName);
+    bool isCategory(const unsigned char *categoryEnabledFlag) const;
+
+    void record(char phase,
+                const unsigned char *categoryEnabledFlag,
+                const char *name,
+                unsigned long long id,
+                int numArgs,
+                const char **argNames,
+                const unsigned char *argTypes,
+                const unsigned long long *argValues,
+                unsigned char flags);
+
+  private:
+    TraceRecorder();
+
+    static void FlushAtExit();
+
+    void setCategoriesEnabled(bool enabled);
+    double getTimestamp() const;
+    ThreadBuffer *acquireThreadBuffer();
+    std::vector<ThreadBuffer *> getThreadBuffers();
+    void flushThreadMain();
+
+    // These require mFlushMutex.
+    void discardEvents();
+    void writeEvents();
+    void writeRecord(const TraceRecord &record);
+
+    const std::chrono::steady_clock::time_point mStartTime;
+
+    std::mutex mCategoryMutex;
+    std::array<const char *, kMaxCategories> mCategoryNames;
+    std::array<unsigned char, kMaxCategories> mCategoryEnabled;
+    size_t mCategoryCount;
+    bool mRecording;
+
+    std::mutex mBufferMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> mBuffers;
+    std::atomic<unsigned int> mNextThreadId;
+
+    // Guards the file and the reading side of the buffers.
+    std::mutex mFlushMutex;
+    std::ofstream mFile;
+    bool mFirstEvent;
+    size_t mDroppedCount;
+
+    // Serializes start and stop.
+    std::mutex mStartMutex;
+    std::thread mFlushThread;
+
+    std::mutex mStopMutex;
+    std::condition_variable mStopCondition;
+    bool mStopping;
+};
+
+// static
+TraceRecorder *TraceRecorder::GetInstance()
+{
+    // Never deleted, since threads may record events until the process exits.
+    static TraceRecorder *instance = []() {
+        TraceRecorder *recorder = new TraceRecorder();
+        const char *path        = getenv("ANGLE_TRACE_FILE");
+        if (path != nullptr && path[0] != '\0')
+        {
+            if (!recorder->start(path))
+            {
+                WARN() << "Could not open the trace file " << path << ".";
+            }
+            atexit(&TraceRecorder::FlushAtExit);
+        }
+        return recorder;
+    }();
+
+    return instance;
+}
+
+TraceRecorder::TraceRecorder()
+    : mStartTime(std::chrono::steady_clock::now()),
+      mCategoryCount(0),
+      mRecording(false),
+      mNextThreadId(1),
+      mFirstEvent(true),
+      mDroppedCount(0),
+      mStopping(false)
+{
+    mCategoryNames.fill(nullptr);
+    mCategoryEnabled.fill(0);
+}
+
+bool TraceRecorder::start(const std::string &path)
+{
+    std::lock_guard<std::mutex> startLock(mStartMutex);
+    if (mFlushThread.joinable())
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> flushLock(mFlushMutex);
+        mFile.open(path, std::ios::out | std::ios::trunc);
+        if (!mFile)
+        {
+            return false;
+        }
+
+        // The closing bracket is optional in this format, so the file can be loaded even if the
+        // process exits without stopping the recorder.
+        mFile << "[\n";
+        mFirstEvent = true;
+        discardEvents();
+    }
+
+    mStopping    = false;
+    mFlushThread = std::thread(&TraceRecorder::flushThreadMain, this);
+
+    setCategoriesEnabled(true);
+    return true;
+}
+
+void TraceRecorder::stop()
+{
+    std::lock_guard<std::mutex> startLock(mStartMutex);
+    if (!mFlushThread.joinable())
+    {
+        return;
+    }
+
+    setCategoriesEnabled(false);
+
+    {
+        std::lock_guard<std::mutex> stopLock(mStopMutex);
+        mStopping = true;
+    }
+    mStopCondition.notify_all();
+    mFlushThread.join();
+
+    std::lock_guard<std::mutex> flushLock(mFlushMutex);
+    writeEvents();
+    mFile << "\n]\n";
+    mFile.close();
+}
+
+void TraceRecorder::flush()
+{
+    std::lock_guard<std::mutex> flushLock(mFlushMutex);
+    writeEvents();
+}
+
+// static
+void TraceRecorder::FlushAtExit()
+{
+    // The flush thread may have been terminated at any point while the process exits, so this
+    // doesn't wait for it.
+    TraceRecorder *recorder = GetInstance();
+    std::unique_lock<std::mutex> flushLock(recorder->mFlushMutex, std::try_to_lock);
+    if (flushLock.owns_lock())
+    {
+        recorder->writeEvents();
+    }
+}
+
+const unsigned char *TraceRecorder::getCategoryEnabledFlag(const char *categoryName)
+{
+    std::lock_guard<std::mutex> categoryLock(mCategoryMutex);
+    for (size_t categoryIndex = 0; categoryIndex < mCategoryCount; ++categoryIndex)
+    {
+        if (strcmp(mCategoryNames[categoryIndex], categoryName) == 0)
+        {
+            return &mCategoryEnabled[categoryIndex];
+        }
+    }
+
+    if (mCategoryCount == kMaxCategories)
+    {
+        static unsigned char disabled = 0;
+        return &disabled;
+    }
+
+    size_t categoryIndex            = mCategoryCount++;
+    mCategoryNames[categoryIndex]   = categoryName;
+    mCategoryEnabled[categoryIndex] = mRecording ? 1 : 0;
+    return &mCategoryEnabled[categoryIndex];
+}
+
+bool TraceRecorder::isCategory(const unsigned char *categoryEnabledFlag) const
+{
+    return categoryEnabledFlag >= mCategoryEnabled.data() &&
+           categoryEnabledFlag < mCategoryEnabled.data() + kMaxCategories;
+}
+
+void TraceRecorder::setCategoriesEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> categoryLock(mCategoryMutex);
+    mRecording = enabled;
+    for (size_t categoryIndex = 0; categoryIndex < mCategoryCount; ++categoryIndex)
+    {
+        mCategoryEnabled[categoryIndex] = enabled ? 1 : 0;
+    }
+}
+
+double TraceRecorder::getTimestamp() const
+{
+    std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - mStartTime;
+    return elapsed.count();
+}
+
+void TraceRecorder::record(char phase,
+                           const unsigned char *categoryEnabledFlag,
+                           const char *name,
+                           unsigned long long id,
+                           int numArgs,
+                           const char **argNames,
+                           const unsigned char *argTypes,
+                           const unsigned long long *argValues,
+                           unsigned char flags)
+{
+    ASSERT(isCategory(categoryEnabledFlag));
+    ASSERT(numArgs >= 0 && static_cast<size_t>(numArgs) <= kMaxArgs);
+
+    ThreadBuffer *buffer = gThreadBuffer.buffer;
+    if (!buffer)
+    {
+        buffer                 = acquireThreadBuffer();
+        gThreadBuffer.buffer   = buffer;
+        gThreadBuffer.threadId = mNextThreadId++;
+    }
+
+    size_t writeIndex = buffer->writeIndex.load(std::memory_order_relaxed);
+    if (writeIndex - buffer->readIndex.load(std::memory_order_acquire) == kRecordsPerThread)
+    {
+        buffer->droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    TraceRecord &record  = buffer->records[writeIndex % kRecordsPerThread];
+    record.timestamp     = getTimestamp();
+    record.name          = name;
+    record.id            = id;
+    record.threadId      = gThreadBuffer.threadId;
+    record.categoryIndex = static_cast<size_t>(categoryEnabledFlag - mCategoryEnabled.data());
+    record.phase         = phase;
+    record.flags         = flags;
+    record.numArgs       = numArgs;
+
+    if ((flags & TRACE_EVENT_FLAG_COPY) != 0)
+    {
+        CopyString(name, &record.copiedName);
+    }
+
+    for (int argIndex = 0; argIndex < numArgs; ++argIndex)
+    {
+        record.argNames[argIndex]  = argNames[argIndex];
+        record.argTypes[argIndex]  = argTypes[argIndex];
+        record.argValues[argIndex] = argValues[argIndex];
+
+        if (argTypes[argIndex] == TRACE_VALUE_TYPE_COPY_STRING)
+        {
+            CopyString(reinterpret_cast<const char *>(argValues[argIndex]),
+                       &record.copiedArgs[argIndex]);
+        }
+    }
+
+    buffer->writeIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+ThreadBuffer *TraceRecorder::acquireThreadBuffer()
+{
+    std::lock_guard<std::mutex> bufferLock(mBufferMutex);
+    for (std::unique_ptr<ThreadBuffer> &buffer : mBuffers)
+    {
+        bool inUse = false;
+        if (buffer->inUse.compare_exchange_strong(inUse, true, std::memory_order_acq_rel))
+        {
+            return buffer.get();
+        }
+    }
+
+    mBuffers.emplace_back(new ThreadBuffer());
+    mBuffers.back()->inUse = true;
+    return mBuffers.back().get();
+}
+
+std::vector<ThreadBuffer *> TraceRecorder::getThreadBuffers()
+{
+    std::lock_guard<std::mutex> bufferLock(mBufferMutex);
+    std::vector<ThreadBuffer *> buffers;
+    for (std::unique_ptr<ThreadBuffer> &buffer : mBuffers)
+    {
+        buffers.push_back(buffer.get());
+    }
+    return buffers;
+}
+
+void TraceRecorder::flushThreadMain()
+{
+    std::unique_lock<std::mutex> stopLock(mStopMutex);
+    while (!mStopping)
+    {
+        mStopCondition.wait_for(stopLock, kFlushInterval);
+
+        stopLock.unlock();
+        flush();
+        stopLock.lock();
+    }
+}
+
+void TraceRecorder::discardEvents()
+{
+    mDroppedCount = 0;
+    for (ThreadBuffer *buffer : getThreadBuffers())
+    {
+        buffer->readIndex.store(buffer->writeIndex.load(std::memory_order_acquire),
+                                std::memory_order_release);
+        buffer->droppedCount.exchange(0, std::memory_order_relaxed);
+    }
+}
+
+void TraceRecorder::writeEvents()
+{
+    if (!mFile.is_open())
+    {
+        return;
+    }
+
+    size_t droppedCount = mDroppedCount;
+    for (ThreadBuffer *buffer : getThreadBuffers())
+    {
+        size_t readIndex  = buffer->readIndex.load(std::memory_order_relaxed);
+        size_t writeIndex = buffer->writeIndex.load(std::memory_order_acquire);
+        for (; readIndex != writeIndex; ++readIndex)
+        {
+            writeRecord(buffer->records[readIndex % kRecordsPerThread]);
+        }
+        buffer->readIndex.store(writeIndex, std::memory_order_release);
+
+        droppedCount += buffer->droppedCount.exchange(0, std::memory_order_relaxed);
+    }
+
+    // The counter is the number of events dropped since the recorder started.
+    if (droppedCount != mDroppedCount)
+    {
+        mDroppedCount = droppedCount;
+
+        mFile << (mFirstEvent ? "" : ",\n");
+        mFile << "{\"name\":\"TraceRecorder dropped events\",\"ph\":\"C\",\"ts\":";
+        WriteTimestamp(mFile, getTimestamp());
+        mFile << ",\"pid\":1,\"tid\":0,\"args\":{\"count\":" << droppedCount << "}}";
+        mFirstEvent = false;
+    }
+
+    mFile.flush();
+}
+
+void TraceRecorder::writeRecord(const TraceRecord &record)
+{
+    mFile << (mFirstEvent ? "" : ",\n");
+    mFirstEvent = false;
+
+    const bool copyName = (record.flags & TRACE_EVENT_FLAG_COPY) != 0;
+
+    mFile << "{\"name\":";
+    WriteEscapedString(mFile, copyName ? record.copiedName.data() : record.name);
+    mFile << ",\"cat\":";
+    WriteEscapedString(mFile, mCategoryNames[record.categoryIndex]);
+    mFile << ",\"ph\":\"" << record.phase << "\",\"ts\":";
+    WriteTimestamp(mFile, record.timestamp);
+    mFile << ",\"pid\":1,\"tid\":" << record.threadId;
+
+    if ((record.flags & TRACE_EVENT_FLAG_HAS_ID) != 0)
+    {
+        char id[32];
+        snprintf(id, sizeof(id), "0x%llx", record.id);
+        mFile << ",\"id\":\"" << id << "\"";
+    }
+
+    if (record.phase == TRACE_EVENT_PHASE_INSTANT)
+    {
+        mFile << ",\"s\":\"t\"";
+    }
+
+    if (record.numArgs > 0)
+    {
+        mFile << ",\"args\":{";
+        for (int argIndex = 0; argIndex < record.numArgs; ++argIndex)
+        {
+            if (argIndex > 0)
+            {
+                mFile << ",";
+            }
+            WriteEscapedString(mFile, record.argNames[argIndex]);
+            mFile << ":";
+
+            gl::TraceEvent::TraceValueUnion value;
+            value.m_uint = record.argValues[argIndex];
+            switch (record.argTypes[argIndex])
+            {
+                case TRACE_VALUE_TYPE_BOOL:
+                    mFile << (value.m_bool ? "true" : "false");
+                    break;
+                case TRACE_VALUE_TYPE_UINT:
+                    mFile << value.m_uint;
+                    break;
+                case TRACE_VALUE_TYPE_INT:
+                    mFile << value.m_int;
+                    break;
+                case TRACE_VALUE_TYPE_DOUBLE:
+                    mFile << value.m_double;
+                    break;
+                case TRACE_VALUE_TYPE_POINTER:
+                {
+                    char pointer[32];
+                    snprintf(pointer, sizeof(pointer), "\"0x%llx\"", value.m_uint);
+                    mFile << pointer;
+                    break;
+                }
+                case TRACE_VALUE_TYPE_STRING:
+                    WriteEscapedString(mFile, value.m_string);
+                    break;
+                case TRACE_VALUE_TYPE_COPY_STRING:
+                    WriteEscapedString(mFile, record.copiedArgs[argIndex].data());
+                    break;
+                default:
+                    UNREACHABLE();
+                    mFile << "null";
+                    break;
+            }
+        }
+        mFile << "}";
+    }
+
+    mFile << "}";
+}
+
+}  // anonymous namespace
+
+bool StartTraceRecorder(const std::string &path)
+{
+    return TraceRecorder::GetInstance()->start(path);
+}
+
+void StopTraceRecorder()
+{
+    TraceRecorder::GetInstance()->stop();
+}
+
+void FlushTraceRecorder()
+{
+    TraceRecorder::GetInstance()->flush();
+}
+
+const unsigned char *GetTraceRecorderCategoryEnabledFlag(const char *categoryName)
+{
+    return TraceRecorder::GetInstance()->getCategoryEnabledFlag(categoryName);
+}
+
+bool IsTraceRecorderCategory(const unsigned char *categoryEnabledFlag)
+{
+    return TraceRecorder::GetInstance()->isCategory(categoryEnabledFlag);
+}
+
+void RecordTraceEvent(char phase,
+                      const unsigned char *categoryEnabledFlag,
+                      const char *name,
+                      unsigned long long id,
+                      int numArgs,
+                      const char **argNames,
+                      const unsigned char *argTypes,
+                      const unsigned long long *argValues,
+                      unsigned char flags)
+{
+    TraceRecorder::GetInstance()->record(phase, categoryEnabledFlag, name, id, numArgs, argNames,
+                                         argTypes, argValues, flags);
+}
+
+}  // namespace angle
@@ -0,0 +1,52 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TraceRecorder:
+//   A built-in recorder for the TRACE_EVENT macros, used when the platform doesn't trace. Every
+//   thread records its events into its own ring buffer without taking locks, and a background
+//   thread writes them to a file in the Chrome JSON trace format, which can be loaded by
+//   about:tracing and by Perfetto. Setting the ANGLE_TRACE_FILE environment variable to the path
+//   of the file starts the recorder when the first trace category is looked up.
+//
+
+#ifndef COMMON_TRACERECORDER_H_
+#define COMMON_TRACERECORDER_H_
+
+#include <string>
+
+namespace angle
+{
+
+// Starts recording to the file at path, replacing its contents. Returns false if the recorder is
+// already started or if the file can't be opened.
+bool StartTraceRecorder(const std::string &path);
+
+// Stops recording, and writes the recorded events to the file before closing it.
+void StopTraceRecorder();
+
+// Writes the recorded events to the file without waiting for the background thread.
+void FlushTraceRecorder();
+
+// Returns the enabled flag of a category, which is non-zero while the recorder is started.
+const unsigned char *GetTraceRecorderCategoryEnabledFlag(const char *categoryName);
+
+// Returns true if the flag was returned by GetTraceRecorderCategoryEnabledFlag.
+bool IsTraceRecorderCategory(const unsigned char *categoryEnabledFlag);
+
+// Records an event in the buffer of the current thread. Events are dropped when the buffer is
+// full, and the number of dropped events is written to the file as a counter.
+void RecordTraceEvent(char phase,
+                      const unsigned char *categoryEnabledFlag,
+                      const char *name,
+                      unsigned long long id,
+                      int numArgs,
+                      const char **argNames,
+                      const unsigned char *argTypes,
+                      const unsigned long long *argValues,
+                      unsigned char flags);
+
+}  // namespace angle
+
+#endif  // COMMON_TRACERECORDER_H_
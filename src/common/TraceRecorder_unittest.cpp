@@ -0,0 +1,140 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TraceRecorder_unittest:
+//   Tests of the built-in trace recorder and of the trace files it writes.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "common/TraceRecorder.h"
+#include "third_party/trace_event/trace_event.h"
+
+using namespace angle;
+
+namespace
+{
+
+constexpr char kTracePath[] = "angle_trace_recorder_test.json";
+
+class TraceRecorderTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override { std::remove(kTracePath); }
+
+    void TearDown() override
+    {
+        StopTraceRecorder();
+        std::remove(kTracePath);
+    }
+
+    std::string readTrace() const
+    {
+        std::ifstream file(kTracePath);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+};
+
+size_t CountOccurrences(const std::string &string, const std::string &pattern)
+{
+    size_t count    = 0;
+    size_t position = string.find(pattern);
+    while (position != std::string::npos)
+    {
+        count++;
+        position = string.find(pattern, position + pattern.size());
+    }
+    return count;
+}
+
+// Tests that the trace event macros are recorded while the recorder is started, and only then.
+TEST_F(TraceRecorderTest, RecordsTraceEvents)
+{
+    ASSERT_TRUE(StartTraceRecorder(kTracePath));
+    {
+        TRACE_EVENT0("angle.test", "ScopedEvent");
+        TRACE_EVENT_INSTANT1("angle.test", "InstantEvent", "value", 42);
+        TRACE_COUNTER1("angle.test", "Counter", 7);
+    }
+    StopTraceRecorder();
+
+    TRACE_EVENT_INSTANT0("angle.test", "StoppedEvent");
+
+    std::string trace = readTrace();
+    EXPECT_EQ('[', trace.front());
+    EXPECT_NE(std::string::npos, trace.rfind("]"));
+    EXPECT_EQ(2u, CountOccurrences(trace, "\"name\":\"ScopedEvent\""));
+    EXPECT_EQ(1u, CountOccurrences(trace, "\"ph\":\"B\""));
+    EXPECT_EQ(1u, CountOccurrences(trace, "\"ph\":\"E\""));
+    EXPECT_EQ(1u, CountOccurrences(trace, "\"args\":{\"value\":42}"));
+    EXPECT_EQ(1u, CountOccurrences(trace, "\"ph\":\"C\""));
+    EXPECT_EQ(1u, CountOccurrences(trace, "\"cat\":\"angle.test\",\"ph\":\"C\""));
+    EXPECT_EQ(0u, CountOccurrences(trace, "StoppedEvent"));
+}
+
+// Tests that every thread records its events.
+TEST_F(TraceRecorderTest, RecordsFromManyThreads)
+{
+    constexpr int kThreadCount = 4;
+    constexpr int kEventCount  = 1000;
+
+    ASSERT_TRUE(StartTraceRecorder(kTracePath));
+
+    std::vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([]() {
+            for (int eventIndex = 0; eventIndex < kEventCount; ++eventIndex)
+            {
+                TRACE_EVENT0("angle.test", "ThreadEvent");
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    StopTraceRecorder();
+
+    // The events that didn't fit in the buffers before they were flushed are counted instead.
+    std::string trace   = readTrace();
+    size_t droppedCount = 0;
+    size_t countIndex   = trace.rfind("\"count\":");
+    if (countIndex != std::string::npos)
+    {
+        droppedCount = std::stoul(trace.substr(countIndex + strlen("\"count\":")));
+    }
+    EXPECT_EQ(static_cast<size_t>(2 * kThreadCount * kEventCount),
+              CountOccurrences(trace, "\"name\":\"ThreadEvent\"") + droppedCount);
+}
+
+// Tests that copied names and strings are written even though the caller's strings are gone.
+TEST_F(TraceRecorderTest, CopiesStrings)
+{
+    ASSERT_TRUE(StartTraceRecorder(kTracePath));
+    {
+        std::string name   = "Copied\"Name";
+        std::string string = "CopiedString";
+        TRACE_EVENT_COPY_INSTANT1("angle.test", name.c_str(), "string", string);
+        name[0]   = 'X';
+        string[0] = 'X';
+    }
+    StopTraceRecorder();
+
+    std::string trace = readTrace();
+    EXPECT_EQ(1u, CountOccurrences(trace, "\"name\":\"Copied\\\"Name\""));
+    EXPECT_EQ(1u, CountOccurrences(trace, "\"string\":\"CopiedString\""));
+}
+
+}  // anonymous namespace
@@ -0,0 +1,531 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// WorkerThread:
+//   Task running thread for ANGLE, similar to a TaskRunner in Chromium.
+//   Might be implemented differently depending on platform.
+//
+
+#include "common/WorkerThread.h"
+
+#if ANGLE_THREAD_POOL_WORKERS
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif  // ANGLE_THREAD_POOL_WORKERS
+
+namespace angle
+{
+
+namespace priv
+{
+// SingleThreadedWorkerPool implementation.
+SingleThreadedWorkerPool::SingleThreadedWorkerPool(size_t maxThreads)
+    : WorkerThreadPoolBase(maxThreads)
+{
+}
+
+SingleThreadedWorkerPool::~SingleThreadedWorkerPool()
+{
+}
+
+SingleThreadedWaitableEvent SingleThreadedWorkerPool::postWorkerTaskImpl(TaskFunction function,
+                                                                         void *userData,
+                                                                         TaskPriority priority)
+{
+    function(userData);
+    return SingleThreadedWaitableEvent(EventResetPolicy::Automatic, EventInitialState::Signaled);
+}
+
+// SingleThreadedWaitableEvent implementation.
+SingleThreadedWaitableEvent::SingleThreadedWaitableEvent()
+    : SingleThreadedWaitableEvent(EventResetPolicy::Automatic, EventInitialState::NonSignaled)
+{
+}
+
+SingleThreadedWaitableEvent::SingleThreadedWaitableEvent(EventResetPolicy resetPolicy,
+                                                         EventInitialState initialState)
+    : WaitableEventBase(resetPolicy, initialState)
+{
+}
+
+SingleThreadedWaitableEvent::~SingleThreadedWaitableEvent()
+{
+}
+
+SingleThreadedWaitableEvent::SingleThreadedWaitableEvent(SingleThreadedWaitableEvent &&other)
+    : WaitableEventBase(std::move(other))
+{
+}
+
+SingleThreadedWaitableEvent &SingleThreadedWaitableEvent::operator=(
+    SingleThreadedWaitableEvent &&other)
+{
+    return copyBase(std::move(other));
+}
+
+void SingleThreadedWaitableEvent::resetImpl()
+{
+    mSignaled = false;
+}
+
+void SingleThreadedWaitableEvent::waitImpl()
+{
+}
+
+bool SingleThreadedWaitableEvent::isReadyImpl() const
+{
+    return true;
+}
+
+void SingleThreadedWaitableEvent::signalImpl()
+{
+    mSignaled = true;
+}
+
+#if ANGLE_THREAD_POOL_WORKERS
+// A posted task, shared by its event and the worker that runs it. Tasks are recycled by the pool,
+// so that posting doesn't allocate once the pool has warmed up.
+struct ThreadPoolTask
+{
+    TaskFunction function;
+    void *userData;
+    std::atomic<bool> done;
+    std::atomic<unsigned int> refCount;
+
+    // Keeps the pool's state alive while the task is in use.
+    std::shared_ptr<ThreadPoolState> pool;
+    ThreadPoolTask *nextFree;
+};
+
+class ThreadPoolState : public std::enable_shared_from_this<ThreadPoolState>, angle::NonCopyable
+{
+  public:
+    explicit ThreadPoolState(size_t threadCount);
+    ~ThreadPoolState();
+
+    void start();
+    void stop();
+
+    ThreadPoolTask *post(TaskFunction function, void *userData, TaskPriority priority);
+    size_t waitAny(ThreadPoolTask *const *tasks, size_t count);
+
+    static void Release(ThreadPoolTask *task);
+
+  private:
+    static constexpr size_t kPriorityCount = static_cast<size_t>(TaskPriority::EnumCount);
+
+    struct WorkerQueues
+    {
+        std::mutex mutex;
+        std::array<std::deque<ThreadPoolTask *>, kPriorityCount> tasks;
+    };
+
+    void workerMain(size_t workerIndex);
+    ThreadPoolTask *takeTask(size_t workerIndex);
+    void finishTask(ThreadPoolTask *task);
+    void recycle(ThreadPoolTask *task);
+
+    std::vector<std::unique_ptr<WorkerQueues>> mQueues;
+    std::vector<std::thread> mThreads;
+    std::atomic<size_t> mNextQueue;
+
+    // Idle workers sleep until tasks are queued or the pool stops.
+    std::mutex mIdleMutex;
+    std::condition_variable mIdleCondition;
+    std::atomic<size_t> mQueuedCount;
+    std::atomic<size_t> mIdleCount;
+    bool mStopping;
+
+    // Threads that wait on tasks are woken up whenever any task finishes.
+    std::mutex mCompletionMutex;
+    std::condition_variable mCompletionCondition;
+    std::atomic<size_t> mWaiterCount;
+
+    std::mutex mFreeListMutex;
+    ThreadPoolTask *mFreeList;
+};
+
+namespace
+{
+// The pool and worker of the current thread, when it is one of the workers.
+thread_local const ThreadPoolState *gCurrentPool = nullptr;
+thread_local size_t gCurrentWorker               = 0;
+}  // anonymous namespace
+
+ThreadPoolState::ThreadPoolState(size_t threadCount)
+    : mNextQueue(0),
+      mQueuedCount(0),
+      mIdleCount(0),
+      mStopping(false),
+      mWaiterCount(0),
+      mFreeList(nullptr)
+{
+    ASSERT(threadCount > 0);
+    for (size_t index = 0; index < threadCount; ++index)
+    {
+        mQueues.emplace_back(new WorkerQueues());
+    }
+}
+
+ThreadPoolState::~ThreadPoolState()
+{
+    ASSERT(mThreads.empty());
+    while (mFreeList)
+    {
+        ThreadPoolTask *task = mFreeList;
+        mFreeList            = task->nextFree;
+        delete task;
+    }
+}
+
+void ThreadPoolState::start()
+{
+    for (size_t index = 0; index < mQueues.size(); ++index)
+    {
+        mThreads.emplace_back(&ThreadPoolState::workerMain, this, index);
+    }
+}
+
+void ThreadPoolState::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mIdleMutex);
+        mStopping = true;
+    }
+    mIdleCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+    mThreads.clear();
+}
+
+ThreadPoolTask *ThreadPoolState::post(TaskFunction function, void *userData, TaskPriority priority)
+{
+    ThreadPoolTask *task = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mFreeListMutex);
+        if (mFreeList)
+        {
+            task      = mFreeList;
+            mFreeList = task->nextFree;
+        }
+    }
+    if (!task)
+    {
+        task = new ThreadPoolTask();
+    }
+
+    task->function = function;
+    task->userData = userData;
+    task->done     = false;
+    task->nextFree = nullptr;
+    task->pool     = shared_from_this();
+
+    // One reference for the event and one for the worker.
+    task->refCount = 2;
+
+    bool fromWorker      = (gCurrentPool == this);
+    size_t queueIndex    = fromWorker ? gCurrentWorker : mNextQueue++ % mQueues.size();
+    WorkerQueues &queues = *mQueues[queueIndex];
+    size_t priorityIndex = static_cast<size_t>(priority);
+
+    // Counted before the task is visible, so that a worker taking it can't decrement the count
+    // below zero.
+    mQueuedCount++;
+    {
+        std::lock_guard<std::mutex> lock(queues.mutex);
+        if (fromWorker)
+        {
+            queues.tasks[priorityIndex].push_front(task);
+        }
+        else
+        {
+            queues.tasks[priorityIndex].push_back(task);
+        }
+    }
+
+    if (mIdleCount > 0)
+    {
+        std::lock_guard<std::mutex> lock(mIdleMutex);
+        mIdleCondition.notify_one();
+    }
+
+    return task;
+}
+
+ThreadPoolTask *ThreadPoolState::takeTask(size_t workerIndex)
+{
+    const size_t queueCount = mQueues.size();
+    for (size_t priorityIndex = 0; priorityIndex < kPriorityCount; ++priorityIndex)
+    {
+        // The worker's own queue first, then the others starting with the next worker's.
+        for (size_t offset = 0; offset < queueCount; ++offset)
+        {
+            WorkerQueues &queues                = *mQueues[(workerIndex + offset) % queueCount];
+            std::deque<ThreadPoolTask *> &tasks = queues.tasks[priorityIndex];
+
+            std::lock_guard<std::mutex> lock(queues.mutex);
+            if (tasks.empty())
+            {
+                continue;
+            }
+
+            ThreadPoolTask *task = nullptr;
+            if (offset == 0)
+            {
+                task = tasks.front();
+                tasks.pop_front();
+            }
+            else
+            {
+                task = tasks.back();
+                tasks.pop_back();
+            }
+
+            mQueuedCount--;
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+void ThreadPoolState::workerMain(size_t workerIndex)
+{
+    gCurrentPool   = this;
+    gCurrentWorker = workerIndex;
+
+    while (true)
+    {
+        ThreadPoolTask *task = takeTask(workerIndex);
+        if (task)
+        {
+            task->function(task->userData);
+            finishTask(task);
+            continue;
+        }
+
+        // The count is checked after registering as idle, so that a task posted in between
+        // either is seen here or wakes this worker up.
+        std::unique_lock<std::mutex> lock(mIdleMutex);
+        mIdleCount++;
+        mIdleCondition.wait(lock, [this] { return mQueuedCount > 0 || mStopping; });
+        mIdleCount--;
+
+        // The posted tasks are finished before the pool stops.
+        if (mStopping && mQueuedCount == 0)
+        {
+            return;
+        }
+    }
+}
+
+void ThreadPoolState::finishTask(ThreadPoolTask *task)
+{
+    task->done = true;
+    if (mWaiterCount > 0)
+    {
+        std::lock_guard<std::mutex> lock(mCompletionMutex);
+        mCompletionCondition.notify_all();
+    }
+
+    Release(task);
+}
+
+size_t ThreadPoolState::waitAny(ThreadPoolTask *const *tasks, size_t count)
+{
+    auto findDoneTask = [tasks, count]() {
+        for (size_t index = 0; index < count; ++index)
+        {
+            if (tasks[index]->done)
+            {
+                return index;
+            }
+        }
+        return count;
+    };
+
+    size_t doneIndex = findDoneTask();
+    if (doneIndex < count)
+    {
+        return doneIndex;
+    }
+
+    // A worker runs the queued tasks while it waits, so that tasks can wait on the tasks they post
+    // without blocking all of the workers. Once the queues are empty, the tasks are running.
+    if (gCurrentPool == this)
+    {
+        while (ThreadPoolTask *task = takeTask(gCurrentWorker))
+        {
+            task->function(task->userData);
+            finishTask(task);
+
+            doneIndex = findDoneTask();
+            if (doneIndex < count)
+            {
+                return doneIndex;
+            }
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mCompletionMutex);
+    mWaiterCount++;
+    mCompletionCondition.wait(lock, [&doneIndex, &findDoneTask, count]() {
+        doneIndex = findDoneTask();
+        return doneIndex < count;
+    });
+    mWaiterCount--;
+
+    return doneIndex;
+}
+
+// static
+void ThreadPoolState::Release(ThreadPoolTask *task)
+{
+    if (--task->refCount > 0)
+    {
+        return;
+    }
+
+    // This may be the last reference to the pool's state, which deletes the recycled tasks.
+    std::shared_ptr<ThreadPoolState> pool = std::move(task->pool);
+    pool->recycle(task);
+}
+
+void ThreadPoolState::recycle(ThreadPoolTask *task)
+{
+    std::lock_guard<std::mutex> lock(mFreeListMutex);
+    task->nextFree = mFreeList;
+    mFreeList      = task;
+}
+
+// ThreadPoolWorkerPool implementation.
+ThreadPoolWorkerPool::ThreadPoolWorkerPool(size_t maxThreads)
+    : WorkerThreadPoolBase(maxThreads),
+      mState(std::make_shared<ThreadPoolState>(std::max<size_t>(maxThreads, 1)))
+{
+    mState->start();
+}
+
+ThreadPoolWorkerPool::~ThreadPoolWorkerPool()
+{
+    mState->stop();
+}
+
+ThreadPoolWaitableEvent ThreadPoolWorkerPool::postWorkerTaskImpl(TaskFunction function,
+                                                                 void *userData,
+                                                                 TaskPriority priority)
+{
+    return ThreadPoolWaitableEvent(mState->post(function, userData, priority));
+}
+
+// ThreadPoolWaitableEvent implementation.
+ThreadPoolWaitableEvent::ThreadPoolWaitableEvent()
+    : ThreadPoolWaitableEvent(EventResetPolicy::Automatic, EventInitialState::NonSignaled)
+{
+}
+
+ThreadPoolWaitableEvent::ThreadPoolWaitableEvent(EventResetPolicy resetPolicy,
+                                                 EventInitialState initialState)
+    : WaitableEventBase(resetPolicy, initialState), mTask(nullptr)
+{
+}
+
+ThreadPoolWaitableEvent::ThreadPoolWaitableEvent(ThreadPoolTask *task)
+    : WaitableEventBase(EventResetPolicy::Automatic, EventInitialState::NonSignaled), mTask(task)
+{
+}
+
+ThreadPoolWaitableEvent::~ThreadPoolWaitableEvent()
+{
+    if (mTask)
+    {
+        mTask->pool->waitAny(&mTask, 1);
+        ThreadPoolState::Release(mTask);
+    }
+}
+
+ThreadPoolWaitableEvent::ThreadPoolWaitableEvent(ThreadPoolWaitableEvent &&other)
+    : WaitableEventBase(std::move(other)), mTask(other.mTask)
+{
+    other.mTask = nullptr;
+}
+
+ThreadPoolWaitableEvent &ThreadPoolWaitableEvent::operator=(ThreadPoolWaitableEvent &&other)
+{
+    std::swap(mTask, other.mTask);
+    return copyBase(std::move(other));
+}
+
+void ThreadPoolWaitableEvent::resetImpl()
+{
+    mSignaled = false;
+    if (mTask)
+    {
+        mTask->pool->waitAny(&mTask, 1);
+        ThreadPoolState::Release(mTask);
+        mTask = nullptr;
+    }
+}
+
+void ThreadPoolWaitableEvent::waitImpl()
+{
+    if (mSignaled || !mTask)
+    {
+        return;
+    }
+
+    mTask->pool->waitAny(&mTask, 1);
+    signal();
+}
+
+bool ThreadPoolWaitableEvent::isReadyImpl() const
+{
+    return mSignaled || !mTask || mTask->done;
+}
+
+void ThreadPoolWaitableEvent::signalImpl()
+{
+    mSignaled = true;
+
+    if (mResetPolicy == EventResetPolicy::Automatic)
+    {
+        reset();
+    }
+}
+
+// static
+size_t ThreadPoolWaitableEvent::WaitAny(ThreadPoolWaitableEvent *waitables, size_t count)
+{
+    ASSERT(count > 0);
+
+    // Events without a task don't need to wait.
+    std::vector<ThreadPoolTask *> tasks(count, nullptr);
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (waitables[index].isReady())
+        {
+            waitables[index].wait();
+            return index;
+        }
+        tasks[index] = waitables[index].mTask;
+        ASSERT(tasks[index]->pool == tasks[0]->pool);
+    }
+
+    size_t doneIndex = tasks[0]->pool->waitAny(tasks.data(), count);
+    waitables[doneIndex].wait();
+    return doneIndex;
+}
+#endif  // ANGLE_THREAD_POOL_WORKERS
+
+}  // namespace priv
+
+}  // namespace angle
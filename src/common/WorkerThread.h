@@ -8,18 +8,25 @@
 //   Can be implemented as different targets, depending on platform.
 //
 
-#ifndef LIBANGLE_WORKER_THREAD_H_
-#define LIBANGLE_WORKER_THREAD_H_
+#ifndef COMMON_WORKERTHREAD_H_
+#define COMMON_WORKERTHREAD_H_
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "common/debug.h"
-#include "libANGLE/features.h"
+#include "common/platform.h"
 
-#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
-#include <future>
-#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// Controls if our threading code uses a pool of worker threads or falls back to single-threaded
+// operations.
+#if !defined(ANGLE_THREAD_POOL_WORKERS)
+#if defined(ANGLE_PLATFORM_WINDOWS) || defined(ANGLE_PLATFORM_LINUX)
+#define ANGLE_THREAD_POOL_WORKERS 1
+#else
+#define ANGLE_THREAD_POOL_WORKERS 0
+#endif  // defined(ANGLE_PLATFORM_WINDOWS) || defined(ANGLE_PLATFORM_LINUX)
+#endif  // !defined(ANGLE_THREAD_POOL_WORKERS)
 
 namespace angle
 {
@@ -46,6 +53,19 @@ class Closure
     virtual void operator()() = 0;
 };
 
+// A task posted as a function and its argument, which runs without a virtual call.
+using TaskFunction = void (*)(void *userData);
+
+// Workers start the queued tasks of a higher priority first. High is for work that the caller is
+// going to wait on soon, like compiles and links. Low is for work that can wait for idle workers.
+enum class TaskPriority
+{
+    High,
+    Low,
+
+    EnumCount
+};
+
 namespace priv
 {
 // An event that we can wait on, useful for joining worker threads.
@@ -63,6 +83,9 @@ class WaitableEventBase : angle::NonCopyable
     // Waits indefinitely for the event to be signaled.
     void wait();
 
+    // Returns true if wait() would return without blocking.
+    bool isReady() const;
+
     // Puts the event in the signaled state, causing any thread blocked on Wait to be woken up.
     // The event state is reset to non-signaled after a waiting thread has been released.
     void signal();
@@ -70,9 +93,6 @@ class WaitableEventBase : angle::NonCopyable
   protected:
     Impl &copyBase(Impl &&other);
 
-    template <size_t Count>
-    static size_t WaitManyBase(std::array<Impl, Count> *waitables);
-
     EventResetPolicy mResetPolicy;
     bool mSignaled;
 };
@@ -103,24 +123,15 @@ void WaitableEventBase<Impl>::wait()
 }
 
 template <typename Impl>
-void WaitableEventBase<Impl>::signal()
+bool WaitableEventBase<Impl>::isReady() const
 {
-    static_cast<Impl *>(this)->signalImpl();
+    return static_cast<const Impl *>(this)->isReadyImpl();
 }
 
 template <typename Impl>
-template <size_t Count>
-// static
-size_t WaitableEventBase<Impl>::WaitManyBase(std::array<Impl, Count> *waitables)
+void WaitableEventBase<Impl>::signal()
 {
-    ASSERT(Count > 0);
-
-    for (size_t index = 0; index < Count; ++index)
-    {
-        (*waitables)[index].wait();
-    }
-
-    return 0;
+    static_cast<Impl *>(this)->signalImpl();
 }
 
 template <typename Impl>
@@ -143,6 +154,7 @@ class SingleThreadedWaitableEvent : public WaitableEventBase<SingleThreadedWaita
 
     void resetImpl();
     void waitImpl();
+    bool isReadyImpl() const;
     void signalImpl();
 
     // Wait, synchronously, on multiple events.
@@ -156,43 +168,54 @@ template <size_t Count>
 size_t SingleThreadedWaitableEvent::WaitMany(
     std::array<SingleThreadedWaitableEvent, Count> *waitables)
 {
-    return WaitableEventBase<SingleThreadedWaitableEvent>::WaitManyBase(waitables);
+    // The tasks ran when they were posted.
+    ASSERT(Count > 0);
+    return 0;
 }
 
-#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
-class AsyncWaitableEvent : public WaitableEventBase<AsyncWaitableEvent>
+#if ANGLE_THREAD_POOL_WORKERS
+struct ThreadPoolTask;
+class ThreadPoolState;
+
+class ThreadPoolWaitableEvent : public WaitableEventBase<ThreadPoolWaitableEvent>
 {
   public:
-    AsyncWaitableEvent();
-    AsyncWaitableEvent(EventResetPolicy resetPolicy, EventInitialState initialState);
-    ~AsyncWaitableEvent();
+    ThreadPoolWaitableEvent();
+    ThreadPoolWaitableEvent(EventResetPolicy resetPolicy, EventInitialState initialState);
 
-    AsyncWaitableEvent(AsyncWaitableEvent &&other);
-    AsyncWaitableEvent &operator=(AsyncWaitableEvent &&other);
+    // Waits for the task, so that it can't outlive its closure.
+    ~ThreadPoolWaitableEvent();
+
+    ThreadPoolWaitableEvent(ThreadPoolWaitableEvent &&other);
+    ThreadPoolWaitableEvent &operator=(ThreadPoolWaitableEvent &&other);
 
     void resetImpl();
     void waitImpl();
+    bool isReadyImpl() const;
     void signalImpl();
 
     // Wait, synchronously, on multiple events.
     // returns the index of a WaitableEvent which has been signaled.
     template <size_t Count>
-    static size_t WaitMany(std::array<AsyncWaitableEvent, Count> *waitables);
+    static size_t WaitMany(std::array<ThreadPoolWaitableEvent, Count> *waitables);
 
   private:
-    friend class AsyncWorkerPool;
-    void setFuture(std::future<void> &&future);
+    friend class ThreadPoolWorkerPool;
+    explicit ThreadPoolWaitableEvent(ThreadPoolTask *task);
+
+    // All the events must come from the same pool.
+    static size_t WaitAny(ThreadPoolWaitableEvent *waitables, size_t count);
 
-    std::future<void> mFuture;
+    ThreadPoolTask *mTask;
 };
 
 template <size_t Count>
 // static
-size_t AsyncWaitableEvent::WaitMany(std::array<AsyncWaitableEvent, Count> *waitables)
+size_t ThreadPoolWaitableEvent::WaitMany(std::array<ThreadPoolWaitableEvent, Count> *waitables)
 {
-    return WaitableEventBase<AsyncWaitableEvent>::WaitManyBase(waitables);
+    return WaitAny(waitables->data(), Count);
 }
-#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#endif  // ANGLE_THREAD_POOL_WORKERS
 
 // The traits class allows the the thread pool to return the "Typed" waitable event from postTask.
 // Otherwise postTask would always think it returns the current active type, so the unit tests
@@ -207,14 +230,14 @@ struct WorkerThreadPoolTraits<SingleThreadedWorkerPool>
     using WaitableEventType = SingleThreadedWaitableEvent;
 };
 
-#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
-class AsyncWorkerPool;
+#if ANGLE_THREAD_POOL_WORKERS
+class ThreadPoolWorkerPool;
 template <>
-struct WorkerThreadPoolTraits<AsyncWorkerPool>
+struct WorkerThreadPoolTraits<ThreadPoolWorkerPool>
 {
-    using WaitableEventType = AsyncWaitableEvent;
+    using WaitableEventType = ThreadPoolWaitableEvent;
 };
-#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#endif  // ANGLE_THREAD_POOL_WORKERS
 
 // Request WorkerThreads from the WorkerThreadPool. Each pool can keep worker threads around so
 // we avoid the costly spin up and spin down time.
@@ -227,9 +250,14 @@ class WorkerThreadPoolBase : angle::NonCopyable
 
     using WaitableEventType = typename WorkerThreadPoolTraits<Impl>::WaitableEventType;
 
-    // Returns an event to wait on for the task to finish.
-    // If the pool fails to create the task, returns null.
-    WaitableEventType postWorkerTask(Closure *task);
+    // Returns an event to wait on for the task to finish. The task must stay alive until then.
+    WaitableEventType postWorkerTask(Closure *task, TaskPriority priority = TaskPriority::High);
+    WaitableEventType postWorkerTask(TaskFunction function,
+                                     void *userData,
+                                     TaskPriority priority = TaskPriority::High);
+
+  private:
+    static void RunClosure(void *closure);
 };
 
 template <typename Impl>
@@ -244,9 +272,26 @@ WorkerThreadPoolBase<Impl>::~WorkerThreadPoolBase()
 
 template <typename Impl>
 typename WorkerThreadPoolBase<Impl>::WaitableEventType WorkerThreadPoolBase<Impl>::postWorkerTask(
-    Closure *task)
+    Closure *task,
+    TaskPriority priority)
 {
-    return static_cast<Impl *>(this)->postWorkerTaskImpl(task);
+    return postWorkerTask(&RunClosure, task, priority);
+}
+
+template <typename Impl>
+typename WorkerThreadPoolBase<Impl>::WaitableEventType WorkerThreadPoolBase<Impl>::postWorkerTask(
+    TaskFunction function,
+    void *userData,
+    TaskPriority priority)
+{
+    return static_cast<Impl *>(this)->postWorkerTaskImpl(function, userData, priority);
+}
+
+template <typename Impl>
+// static
+void WorkerThreadPoolBase<Impl>::RunClosure(void *closure)
+{
+    (*static_cast<Closure *>(closure))();
 }
 
 class SingleThreadedWorkerPool : public WorkerThreadPoolBase<SingleThreadedWorkerPool>
@@ -255,30 +300,44 @@ class SingleThreadedWorkerPool : public WorkerThreadPoolBase<SingleThreadedWorke
     SingleThreadedWorkerPool(size_t maxThreads);
     ~SingleThreadedWorkerPool();
 
-    SingleThreadedWaitableEvent postWorkerTaskImpl(Closure *task);
+    SingleThreadedWaitableEvent postWorkerTaskImpl(TaskFunction function,
+                                                   void *userData,
+                                                   TaskPriority priority);
 };
 
-#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
-class AsyncWorkerPool : public WorkerThreadPoolBase<AsyncWorkerPool>
+#if ANGLE_THREAD_POOL_WORKERS
+// Starts maxThreads worker threads, which run until the pool is destroyed. Each worker has its own
+// queues, one per priority. Tasks posted from outside of the pool are spread over the workers,
+// and the tasks posted by a worker go to the front of its own queues, so that they run next.
+// Workers that run out of tasks steal the most recently posted tasks of the others, and workers
+// that wait on events run queued tasks meanwhile. The pool finishes all of the posted tasks before
+// it is destroyed.
+class ThreadPoolWorkerPool : public WorkerThreadPoolBase<ThreadPoolWorkerPool>
 {
   public:
-    AsyncWorkerPool(size_t maxThreads);
-    ~AsyncWorkerPool();
+    ThreadPoolWorkerPool(size_t maxThreads);
+    ~ThreadPoolWorkerPool();
 
-    AsyncWaitableEvent postWorkerTaskImpl(Closure *task);
+    ThreadPoolWaitableEvent postWorkerTaskImpl(TaskFunction function,
+                                               void *userData,
+                                               TaskPriority priority);
+
+  private:
+    // Shared with the tasks, which may outlive the pool through their events.
+    std::shared_ptr<ThreadPoolState> mState;
 };
-#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#endif  // ANGLE_THREAD_POOL_WORKERS
 
 }  // namespace priv
 
-#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
-using WaitableEvent    = priv::AsyncWaitableEvent;
-using WorkerThreadPool = priv::AsyncWorkerPool;
+#if ANGLE_THREAD_POOL_WORKERS
+using WaitableEvent    = priv::ThreadPoolWaitableEvent;
+using WorkerThreadPool = priv::ThreadPoolWorkerPool;
 #else
 using WaitableEvent    = priv::SingleThreadedWaitableEvent;
 using WorkerThreadPool = priv::SingleThreadedWorkerPool;
-#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#endif  // ANGLE_THREAD_POOL_WORKERS
 
 }  // namespace angle
 
-#endif  // LIBANGLE_WORKER_THREAD_H_
+#endif  // COMMON_WORKERTHREAD_H_
@@ -0,0 +1,295 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// WorkerThread_unittest:
+//   Simple tests for the worker thread class.
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "common/WorkerThread.h"
+
+using namespace angle;
+
+namespace
+{
+
+template <typename T>
+class WorkerPoolTest : public ::testing::Test
+{
+  public:
+    T workerPool = {4};
+};
+
+#if ANGLE_THREAD_POOL_WORKERS
+using WorkerPoolTypes =
+    ::testing::Types<priv::ThreadPoolWorkerPool, priv::SingleThreadedWorkerPool>;
+#else
+using WorkerPoolTypes = ::testing::Types<priv::SingleThreadedWorkerPool>;
+#endif  // ANGLE_THREAD_POOL_WORKERS
+
+void IncrementCounter(void *counter)
+{
+    (*static_cast<std::atomic<int> *>(counter))++;
+}
+
+TYPED_TEST_CASE(WorkerPoolTest, WorkerPoolTypes);
+
+// Tests simple worker pool application.
+TYPED_TEST(WorkerPoolTest, SimpleTask)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    std::array<TestTask, 4> tasks;
+    std::array<typename TypeParam::WaitableEventType, 4> waitables = {{
+        this->workerPool.postWorkerTask(&tasks[0]), this->workerPool.postWorkerTask(&tasks[1]),
+        this->workerPool.postWorkerTask(&tasks[2]), this->workerPool.postWorkerTask(&tasks[3]),
+    }};
+
+    for (auto &waitable : waitables)
+    {
+        waitable.wait();
+    }
+
+    for (const auto &task : tasks)
+    {
+        EXPECT_TRUE(task.fired);
+    }
+}
+
+// Tests that WaitMany returns the index of a finished task.
+TYPED_TEST(WorkerPoolTest, WaitMany)
+{
+    std::atomic<int> counter(0);
+    std::array<typename TypeParam::WaitableEventType, 2> waitables = {{
+        this->workerPool.postWorkerTask(&IncrementCounter, &counter),
+        this->workerPool.postWorkerTask(&IncrementCounter, &counter),
+    }};
+
+    size_t index = TypeParam::WaitableEventType::WaitMany(&waitables);
+    ASSERT_LT(index, waitables.size());
+    EXPECT_TRUE(waitables[index].isReady());
+    EXPECT_GE(counter, 1);
+}
+
+// Tests that an event is ready once the task is done.
+TYPED_TEST(WorkerPoolTest, IsReadyAfterWait)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    TestTask task;
+    typename TypeParam::WaitableEventType waitable = this->workerPool.postWorkerTask(&task);
+    waitable.wait();
+
+    EXPECT_TRUE(waitable.isReady());
+    EXPECT_TRUE(task.fired);
+}
+
+// Tests that many small tasks all run once.
+TYPED_TEST(WorkerPoolTest, ManyTasks)
+{
+    constexpr int kTaskCount = 10000;
+
+    std::atomic<int> counter(0);
+    std::vector<typename TypeParam::WaitableEventType> waitables;
+    for (int taskIndex = 0; taskIndex < kTaskCount; ++taskIndex)
+    {
+        waitables.push_back(this->workerPool.postWorkerTask(&IncrementCounter, &counter));
+    }
+
+    for (auto &waitable : waitables)
+    {
+        waitable.wait();
+    }
+
+    EXPECT_EQ(kTaskCount, counter);
+}
+
+// Tests that tasks can post and wait on more tasks, which the other workers can steal.
+TYPED_TEST(WorkerPoolTest, NestedTasks)
+{
+    constexpr int kTaskCount    = 64;
+    constexpr int kSubtaskCount = 16;
+
+    struct Context
+    {
+        TypeParam *workerPool;
+        std::atomic<int> counter;
+    };
+
+    auto runTask = [](void *userData) {
+        Context *context = static_cast<Context *>(userData);
+        std::vector<typename TypeParam::WaitableEventType> waitables;
+        for (int subtaskIndex = 0; subtaskIndex < kSubtaskCount; ++subtaskIndex)
+        {
+            waitables.push_back(
+                context->workerPool->postWorkerTask(&IncrementCounter, &context->counter));
+        }
+        for (auto &waitable : waitables)
+        {
+            waitable.wait();
+        }
+    };
+
+    Context context;
+    context.workerPool = &this->workerPool;
+    context.counter    = 0;
+
+    std::vector<typename TypeParam::WaitableEventType> waitables;
+    for (int taskIndex = 0; taskIndex < kTaskCount; ++taskIndex)
+    {
+        waitables.push_back(this->workerPool.postWorkerTask(runTask, &context));
+    }
+
+    for (auto &waitable : waitables)
+    {
+        waitable.wait();
+    }
+
+    EXPECT_EQ(kTaskCount * kSubtaskCount, context.counter);
+}
+
+// Tests that several threads can post to the same pool.
+TYPED_TEST(WorkerPoolTest, ConcurrentPosts)
+{
+    constexpr int kThreadCount = 4;
+    constexpr int kTaskCount   = 1000;
+
+    std::atomic<int> counter(0);
+    std::vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([this, &counter]() {
+            for (int taskIndex = 0; taskIndex < kTaskCount; ++taskIndex)
+            {
+                this->workerPool.postWorkerTask(&IncrementCounter, &counter).wait();
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(kThreadCount * kTaskCount, counter);
+}
+
+// Tests that destroying the event of a task waits for the task.
+TYPED_TEST(WorkerPoolTest, DestroyEventWaits)
+{
+    std::atomic<int> counter(0);
+    for (int taskIndex = 0; taskIndex < 100; ++taskIndex)
+    {
+        this->workerPool.postWorkerTask(&IncrementCounter, &counter);
+    }
+
+    EXPECT_EQ(100, counter);
+}
+
+#if ANGLE_THREAD_POOL_WORKERS
+// Blocks a worker until the test opens the gate.
+struct Gate
+{
+    std::atomic<bool> started;
+    std::atomic<bool> open;
+};
+
+void WaitForGate(void *userData)
+{
+    Gate *gate    = static_cast<Gate *>(userData);
+    gate->started = true;
+    while (!gate->open)
+    {
+        std::this_thread::yield();
+    }
+}
+
+// Tests that WaitMany returns while other tasks are still running.
+TEST(ThreadPoolWorkerPoolTest, WaitManyReturnsFirstFinishedTask)
+{
+    priv::ThreadPoolWorkerPool workerPool(2);
+
+    Gate gate;
+    gate.started = false;
+    gate.open    = false;
+
+    std::atomic<int> counter(0);
+    std::array<priv::ThreadPoolWaitableEvent, 2> waitables = {{
+        workerPool.postWorkerTask(&WaitForGate, &gate),
+        workerPool.postWorkerTask(&IncrementCounter, &counter),
+    }};
+
+    EXPECT_EQ(1u, priv::ThreadPoolWaitableEvent::WaitMany(&waitables));
+    EXPECT_FALSE(waitables[0].isReady());
+
+    gate.open = true;
+    waitables[0].wait();
+}
+
+// Tests that the queued tasks of a high priority run before the ones of a low priority.
+TEST(ThreadPoolWorkerPoolTest, HighPriorityRunsFirst)
+{
+    priv::ThreadPoolWorkerPool workerPool(1);
+
+    Gate gate;
+    gate.started = false;
+    gate.open    = false;
+    priv::ThreadPoolWaitableEvent gateWaitable = workerPool.postWorkerTask(&WaitForGate, &gate);
+    while (!gate.started)
+    {
+        std::this_thread::yield();
+    }
+
+    struct Order
+    {
+        std::atomic<int> next;
+        int low;
+        int high;
+    };
+    Order order;
+    order.next = 0;
+    order.low  = -1;
+    order.high = -1;
+
+    auto runLow = [](void *userData) {
+        Order *order = static_cast<Order *>(userData);
+        order->low   = order->next++;
+    };
+    auto runHigh = [](void *userData) {
+        Order *order = static_cast<Order *>(userData);
+        order->high  = order->next++;
+    };
+
+    priv::ThreadPoolWaitableEvent lowWaitable =
+        workerPool.postWorkerTask(runLow, &order, TaskPriority::Low);
+    priv::ThreadPoolWaitableEvent highWaitable =
+        workerPool.postWorkerTask(runHigh, &order, TaskPriority::High);
+
+    gate.open = true;
+    lowWaitable.wait();
+    highWaitable.wait();
+
+    EXPECT_EQ(0, order.high);
+    EXPECT_EQ(1, order.low);
+}
+#endif  // ANGLE_THREAD_POOL_WORKERS
+
+}  // anonymous namespace
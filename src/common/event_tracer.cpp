@@ -4,6 +4,7 @@
 
 #include "common/event_tracer.h"
 
+#include "common/TraceRecorder.h"
 #include "common/debug.h"
 
 namespace angle
@@ -11,6 +12,14 @@ namespace angle
 
 const unsigned char *GetTraceCategoryEnabledFlag(const char *name)
 {
+    // The built-in recorder takes the categories over while it is started. Otherwise its flags are
+    // only used when the platform doesn't trace, so that the recorder can be started later.
+    const unsigned char *recorderEnabledFlag = GetTraceRecorderCategoryEnabledFlag(name);
+    if (*recorderEnabledFlag)
+    {
+        return recorderEnabledFlag;
+    }
+
     auto *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
 
@@ -21,8 +30,7 @@ const unsigned char *GetTraceCategoryEnabledFlag(const char *name)
         return categoryEnabledFlag;
     }
 
-    static unsigned char disabled = 0;
-    return &disabled;
+    return recorderEnabledFlag;
 }
 
 angle::TraceEventHandle AddTraceEvent(char phase,
@@ -35,6 +43,13 @@ angle::TraceEventHandle AddTraceEvent(char phase,
                                       const unsigned long long *argValues,
                                       unsigned char flags)
 {
+    if (IsTraceRecorderCategory(categoryGroupEnabled))
+    {
+        RecordTraceEvent(phase, categoryGroupEnabled, name, id, numArgs, argNames, argTypes,
+                         argValues, flags);
+        return static_cast<angle::TraceEventHandle>(0);
+    }
+
     auto *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
 
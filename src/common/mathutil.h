@@ -147,6 +147,80 @@ inline bool supportsSSE2()
             supports = (info[3] >> 26) & 1;
         }
     }
+#elif defined(__GNUC__)
+    supports = __builtin_cpu_supports("sse2");
+#endif  // defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
+    checked = true;
+    return supports;
+#else  // defined(ANGLE_USE_SSE)
+    return false;
+#endif
+}
+
+inline bool supportsSSE41()
+{
+#if defined(ANGLE_USE_SSE)
+    static bool checked = false;
+    static bool supports = false;
+
+    if (checked)
+    {
+        return supports;
+    }
+
+#if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
+    {
+        int info[4];
+        __cpuid(info, 0);
+
+        if (info[0] >= 1)
+        {
+            __cpuid(info, 1);
+
+            supports = (info[2] >> 19) & 1;
+        }
+    }
+#elif defined(__GNUC__)
+    supports = __builtin_cpu_supports("sse4.1");
+#endif  // defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
+    checked = true;
+    return supports;
+#else  // defined(ANGLE_USE_SSE)
+    return false;
+#endif
+}
+
+inline bool supportsAVX2()
+{
+#if defined(ANGLE_USE_SSE)
+    static bool checked = false;
+    static bool supports = false;
+
+    if (checked)
+    {
+        return supports;
+    }
+
+#if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
+    {
+        int info[4];
+        __cpuid(info, 0);
+
+        if (info[0] >= 7)
+        {
+            __cpuid(info, 1);
+
+            // AVX needs both CPU support and the OS saving the YMM registers (OSXSAVE + XCR0).
+            bool supportsAVX = ((info[2] >> 27) & 1) && ((info[2] >> 28) & 1) &&
+                               (_xgetbv(0) & 0x6) == 0x6;
+
+            __cpuidex(info, 7, 0);
+
+            supports = supportsAVX && ((info[1] >> 5) & 1);
+        }
+    }
+#elif defined(__GNUC__)
+    supports = __builtin_cpu_supports("avx2");
 #endif  // defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
     checked = true;
     return supports;
@@ -45,6 +45,7 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                 minIndex = indices[i];
                 maxIndex = indices[i];
                 nonPrimitiveRestartIndices++;
+                i++;
                 break;
             }
         }
@@ -89,6 +90,325 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                           nonPrimitiveRestartIndices);
 }
 
+#if defined(ANGLE_USE_SSE)
+
+// The vector kernels are compiled for their instruction set with a target attribute so they can
+// live next to the scalar code; they only run after the matching supportsXXX() check.
+#if defined(__GNUC__)
+#define ANGLE_TARGET_SSE2 __attribute__((target("sse2")))
+#define ANGLE_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define ANGLE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define ANGLE_TARGET_SSE2
+#define ANGLE_TARGET_SSE41
+#define ANGLE_TARGET_AVX2
+#endif
+
+// Each kernel scans a multiple of its lane count and returns the number of primitive restart
+// indices it saw. The restart index is always the largest value of the index type, so it can
+// never lower the minimum: it is only masked to zero for the maximum.
+template <class IndexType>
+using IndexRangeKernelFunc = size_t (*)(const IndexType *indices,
+                                        size_t count,
+                                        bool primitiveRestartEnabled,
+                                        IndexType *minIndexOut,
+                                        IndexType *maxIndexOut);
+
+// SSE2 has no unsigned 16 and 32-bit min/max. Those types are flipped into the signed range
+// with Order() before being compared, and flipped back before the final reduction.
+struct SSE2UbyteOps
+{
+    using IndexType = GLubyte;
+    ANGLE_TARGET_SSE2 static __m128i Order(__m128i v) { return v; }
+    ANGLE_TARGET_SSE2 static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+    ANGLE_TARGET_SSE2 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    ANGLE_TARGET_SSE2 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+};
+
+struct SSE2UshortOps
+{
+    using IndexType = GLushort;
+    ANGLE_TARGET_SSE2 static __m128i Order(__m128i v)
+    {
+        return _mm_xor_si128(v, _mm_set1_epi16(-0x8000));
+    }
+    ANGLE_TARGET_SSE2 static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+    ANGLE_TARGET_SSE2 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+    ANGLE_TARGET_SSE2 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+};
+
+struct SSE2UintOps
+{
+    using IndexType = GLuint;
+    ANGLE_TARGET_SSE2 static __m128i Order(__m128i v)
+    {
+        return _mm_xor_si128(v, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+    }
+    ANGLE_TARGET_SSE2 static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+    ANGLE_TARGET_SSE2 static __m128i Min(__m128i a, __m128i b)
+    {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+    }
+    ANGLE_TARGET_SSE2 static __m128i Max(__m128i a, __m128i b)
+    {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+};
+
+struct SSE41UshortOps
+{
+    using IndexType = GLushort;
+    ANGLE_TARGET_SSE41 static __m128i Order(__m128i v) { return v; }
+    ANGLE_TARGET_SSE41 static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+    ANGLE_TARGET_SSE41 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu16(a, b); }
+    ANGLE_TARGET_SSE41 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu16(a, b); }
+};
+
+struct SSE41UintOps
+{
+    using IndexType = GLuint;
+    ANGLE_TARGET_SSE41 static __m128i Order(__m128i v) { return v; }
+    ANGLE_TARGET_SSE41 static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+    ANGLE_TARGET_SSE41 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu32(a, b); }
+    ANGLE_TARGET_SSE41 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu32(a, b); }
+};
+
+struct AVX2UbyteOps
+{
+    using IndexType = GLubyte;
+    ANGLE_TARGET_AVX2 static __m256i Equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi8(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu8(a, b); }
+};
+
+struct AVX2UshortOps
+{
+    using IndexType = GLushort;
+    ANGLE_TARGET_AVX2 static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+    ANGLE_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu16(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu16(a, b); }
+};
+
+struct AVX2UintOps
+{
+    using IndexType = GLuint;
+    ANGLE_TARGET_AVX2 static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+    ANGLE_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu32(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu32(a, b); }
+};
+
+template <class IndexType>
+void ReduceIndexLanes(const IndexType *minLanes,
+                      const IndexType *maxLanes,
+                      size_t laneCount,
+                      IndexType *minIndexOut,
+                      IndexType *maxIndexOut)
+{
+    *minIndexOut = *std::min_element(minLanes, minLanes + laneCount);
+    *maxIndexOut = *std::max_element(maxLanes, maxLanes + laneCount);
+}
+
+// Sums the 0xFF bytes of a compare mask into 64-bit lanes, which cannot overflow.
+ANGLE_TARGET_SSE2 inline __m128i CountSetBytes(__m128i mask)
+{
+    return _mm_sad_epu8(_mm_and_si128(mask, _mm_set1_epi8(1)), _mm_setzero_si128());
+}
+
+ANGLE_TARGET_AVX2 inline __m256i CountSetBytes(__m256i mask)
+{
+    return _mm256_sad_epu8(_mm256_and_si256(mask, _mm256_set1_epi8(1)), _mm256_setzero_si256());
+}
+
+// SSE2 and SSE4.1 share the same loop, but each copy needs its own target attribute.
+template <class Ops>
+ANGLE_TARGET_SSE2 size_t ComputeIndexRangeSSE2(const typename Ops::IndexType *indices,
+                                               size_t count,
+                                               bool primitiveRestartEnabled,
+                                               typename Ops::IndexType *minIndexOut,
+                                               typename Ops::IndexType *maxIndexOut)
+{
+    using IndexType            = typename Ops::IndexType;
+    constexpr size_t kLanes    = sizeof(__m128i) / sizeof(IndexType);
+    const __m128i restartIndex = _mm_set1_epi32(-1);
+    __m128i minVec             = Ops::Order(restartIndex);
+    __m128i maxVec             = Ops::Order(_mm_setzero_si128());
+    __m128i restartByteCounts  = _mm_setzero_si128();
+
+    for (size_t i = 0; i < count; i += kLanes)
+    {
+        __m128i indexVec     = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        __m128i maxCandidate = indexVec;
+        if (primitiveRestartEnabled)
+        {
+            __m128i restartMask = Ops::Equal(indexVec, restartIndex);
+            maxCandidate        = _mm_andnot_si128(restartMask, indexVec);
+            restartByteCounts   = _mm_add_epi64(restartByteCounts, CountSetBytes(restartMask));
+        }
+        minVec = Ops::Min(minVec, Ops::Order(indexVec));
+        maxVec = Ops::Max(maxVec, Ops::Order(maxCandidate));
+    }
+
+    IndexType minLanes[kLanes];
+    IndexType maxLanes[kLanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(minLanes), Ops::Order(minVec));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(maxLanes), Ops::Order(maxVec));
+    ReduceIndexLanes(minLanes, maxLanes, kLanes, minIndexOut, maxIndexOut);
+
+    uint64_t byteCounts[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(byteCounts), restartByteCounts);
+    return static_cast<size_t>(byteCounts[0] + byteCounts[1]) / sizeof(IndexType);
+}
+
+template <class Ops>
+ANGLE_TARGET_SSE41 size_t ComputeIndexRangeSSE41(const typename Ops::IndexType *indices,
+                                                 size_t count,
+                                                 bool primitiveRestartEnabled,
+                                                 typename Ops::IndexType *minIndexOut,
+                                                 typename Ops::IndexType *maxIndexOut)
+{
+    using IndexType            = typename Ops::IndexType;
+    constexpr size_t kLanes    = sizeof(__m128i) / sizeof(IndexType);
+    const __m128i restartIndex = _mm_set1_epi32(-1);
+    __m128i minVec             = restartIndex;
+    __m128i maxVec             = _mm_setzero_si128();
+    __m128i restartByteCounts  = _mm_setzero_si128();
+
+    for (size_t i = 0; i < count; i += kLanes)
+    {
+        __m128i indexVec     = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        __m128i maxCandidate = indexVec;
+        if (primitiveRestartEnabled)
+        {
+            __m128i restartMask = Ops::Equal(indexVec, restartIndex);
+            maxCandidate        = _mm_andnot_si128(restartMask, indexVec);
+            restartByteCounts   = _mm_add_epi64(restartByteCounts, CountSetBytes(restartMask));
+        }
+        minVec = Ops::Min(minVec, indexVec);
+        maxVec = Ops::Max(maxVec, maxCandidate);
+    }
+
+    IndexType minLanes[kLanes];
+    IndexType maxLanes[kLanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(minLanes), minVec);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(maxLanes), maxVec);
+    ReduceIndexLanes(minLanes, maxLanes, kLanes, minIndexOut, maxIndexOut);
+
+    uint64_t byteCounts[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(byteCounts), restartByteCounts);
+    return static_cast<size_t>(byteCounts[0] + byteCounts[1]) / sizeof(IndexType);
+}
+
+template <class Ops>
+ANGLE_TARGET_AVX2 size_t ComputeIndexRangeAVX2(const typename Ops::IndexType *indices,
+                                               size_t count,
+                                               bool primitiveRestartEnabled,
+                                               typename Ops::IndexType *minIndexOut,
+                                               typename Ops::IndexType *maxIndexOut)
+{
+    using IndexType            = typename Ops::IndexType;
+    constexpr size_t kLanes    = sizeof(__m256i) / sizeof(IndexType);
+    const __m256i restartIndex = _mm256_set1_epi32(-1);
+    __m256i minVec             = restartIndex;
+    __m256i maxVec             = _mm256_setzero_si256();
+    __m256i restartByteCounts  = _mm256_setzero_si256();
+
+    for (size_t i = 0; i < count; i += kLanes)
+    {
+        __m256i indexVec     = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+        __m256i maxCandidate = indexVec;
+        if (primitiveRestartEnabled)
+        {
+            __m256i restartMask = Ops::Equal(indexVec, restartIndex);
+            maxCandidate        = _mm256_andnot_si256(restartMask, indexVec);
+            restartByteCounts   = _mm256_add_epi64(restartByteCounts, CountSetBytes(restartMask));
+        }
+        minVec = Ops::Min(minVec, indexVec);
+        maxVec = Ops::Max(maxVec, maxCandidate);
+    }
+
+    IndexType minLanes[kLanes];
+    IndexType maxLanes[kLanes];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(minLanes), minVec);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(maxLanes), maxVec);
+    ReduceIndexLanes(minLanes, maxLanes, kLanes, minIndexOut, maxIndexOut);
+
+    uint64_t byteCounts[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(byteCounts), restartByteCounts);
+    return static_cast<size_t>(byteCounts[0] + byteCounts[1] + byteCounts[2] + byteCounts[3]) /
+           sizeof(IndexType);
+}
+
+// Runs |kernel| over the largest multiple of |laneCount| indices and finishes the remainder with
+// scalar code. Produces the same result as ComputeTypedIndexRange.
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRangeVectorized(const IndexType *indices,
+                                                size_t count,
+                                                bool primitiveRestartEnabled,
+                                                GLuint primitiveRestartIndex,
+                                                size_t laneCount,
+                                                IndexRangeKernelFunc<IndexType> kernel)
+{
+    ASSERT(count > 0);
+
+    IndexType minIndex           = std::numeric_limits<IndexType>::max();
+    IndexType maxIndex           = 0;
+    size_t primitiveRestartCount = 0;
+
+    size_t vectorCount = count - (count % laneCount);
+    if (vectorCount > 0)
+    {
+        primitiveRestartCount =
+            kernel(indices, vectorCount, primitiveRestartEnabled, &minIndex, &maxIndex);
+    }
+
+    for (size_t i = vectorCount; i < count; i++)
+    {
+        if (primitiveRestartEnabled && indices[i] == primitiveRestartIndex)
+        {
+            primitiveRestartCount++;
+            continue;
+        }
+        minIndex = std::min(minIndex, indices[i]);
+        maxIndex = std::max(maxIndex, indices[i]);
+    }
+
+    size_t nonPrimitiveRestartIndices = count - primitiveRestartCount;
+    if (nonPrimitiveRestartIndices == 0)
+    {
+        return gl::IndexRange();
+    }
+
+    return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
+                          nonPrimitiveRestartIndices);
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
+gl::IndexRangeKernel GetFastestIndexRangeKernel()
+{
+    if (gl::supportsAVX2())
+    {
+        return gl::IndexRangeKernel::AVX2;
+    }
+    if (gl::supportsSSE41())
+    {
+        return gl::IndexRangeKernel::SSE41;
+    }
+    if (gl::supportsSSE2())
+    {
+        return gl::IndexRangeKernel::SSE2;
+    }
+    return gl::IndexRangeKernel::Scalar;
+}
+
 }  // anonymous namespace
 
 namespace gl
@@ -562,6 +882,102 @@ IndexRange ComputeIndexRange(GLenum indexType,
                              size_t count,
                              bool primitiveRestartEnabled)
 {
+    static const IndexRangeKernel kernel = GetFastestIndexRangeKernel();
+    return ComputeIndexRangeWithKernel(kernel, indexType, indices, count, primitiveRestartEnabled);
+}
+
+bool IsIndexRangeKernelSupported(IndexRangeKernel kernel)
+{
+    switch (kernel)
+    {
+        case IndexRangeKernel::Scalar:
+            return true;
+        case IndexRangeKernel::SSE2:
+            return supportsSSE2();
+        case IndexRangeKernel::SSE41:
+            return supportsSSE41();
+        case IndexRangeKernel::AVX2:
+            return supportsAVX2();
+        default:
+            UNREACHABLE();
+            return false;
+    }
+}
+
+IndexRange ComputeIndexRangeWithKernel(IndexRangeKernel kernel,
+                                       GLenum indexType,
+                                       const GLvoid *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled)
+{
+    ASSERT(IsIndexRangeKernelSupported(kernel));
+
+#if defined(ANGLE_USE_SSE)
+    const GLuint primitiveRestartIndex = GetPrimitiveRestartIndex(indexType);
+    switch (kernel)
+    {
+        case IndexRangeKernel::Scalar:
+            break;
+
+        case IndexRangeKernel::SSE2:
+        case IndexRangeKernel::SSE41:
+        {
+            // SSE4.1 only adds unsigned 16 and 32-bit min/max; bytes always use the SSE2 kernel.
+            bool useSSE41 = (kernel == IndexRangeKernel::SSE41);
+            switch (indexType)
+            {
+                case GL_UNSIGNED_BYTE:
+                    return ComputeTypedIndexRangeVectorized(
+                        static_cast<const GLubyte *>(indices), count, primitiveRestartEnabled,
+                        primitiveRestartIndex, sizeof(__m128i),
+                        ComputeIndexRangeSSE2<SSE2UbyteOps>);
+                case GL_UNSIGNED_SHORT:
+                    return ComputeTypedIndexRangeVectorized(
+                        static_cast<const GLushort *>(indices), count, primitiveRestartEnabled,
+                        primitiveRestartIndex, sizeof(__m128i) / sizeof(GLushort),
+                        useSSE41 ? ComputeIndexRangeSSE41<SSE41UshortOps>
+                                 : ComputeIndexRangeSSE2<SSE2UshortOps>);
+                case GL_UNSIGNED_INT:
+                    return ComputeTypedIndexRangeVectorized(
+                        static_cast<const GLuint *>(indices), count, primitiveRestartEnabled,
+                        primitiveRestartIndex, sizeof(__m128i) / sizeof(GLuint),
+                        useSSE41 ? ComputeIndexRangeSSE41<SSE41UintOps>
+                                 : ComputeIndexRangeSSE2<SSE2UintOps>);
+                default:
+                    UNREACHABLE();
+                    return IndexRange();
+            }
+        }
+
+        case IndexRangeKernel::AVX2:
+            switch (indexType)
+            {
+                case GL_UNSIGNED_BYTE:
+                    return ComputeTypedIndexRangeVectorized(
+                        static_cast<const GLubyte *>(indices), count, primitiveRestartEnabled,
+                        primitiveRestartIndex, sizeof(__m256i),
+                        ComputeIndexRangeAVX2<AVX2UbyteOps>);
+                case GL_UNSIGNED_SHORT:
+                    return ComputeTypedIndexRangeVectorized(
+                        static_cast<const GLushort *>(indices), count, primitiveRestartEnabled,
+                        primitiveRestartIndex, sizeof(__m256i) / sizeof(GLushort),
+                        ComputeIndexRangeAVX2<AVX2UshortOps>);
+                case GL_UNSIGNED_INT:
+                    return ComputeTypedIndexRangeVectorized(
+                        static_cast<const GLuint *>(indices), count, primitiveRestartEnabled,
+                        primitiveRestartIndex, sizeof(__m256i) / sizeof(GLuint),
+                        ComputeIndexRangeAVX2<AVX2UintOps>);
+                default:
+                    UNREACHABLE();
+                    return IndexRange();
+            }
+
+        default:
+            UNREACHABLE();
+            break;
+    }
+#endif  // defined(ANGLE_USE_SSE)
+
     switch (indexType)
     {
         case GL_UNSIGNED_BYTE:
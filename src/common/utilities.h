@@ -60,6 +60,23 @@ IndexRange ComputeIndexRange(GLenum indexType,
                              size_t count,
                              bool primitiveRestartEnabled);
 
+// The implementations of ComputeIndexRange. ComputeIndexRange picks the fastest one the CPU
+// supports; the others are exposed so tests and benchmarks can compare them.
+enum class IndexRangeKernel
+{
+    Scalar,
+    SSE2,
+    SSE41,
+    AVX2,
+};
+
+bool IsIndexRangeKernelSupported(IndexRangeKernel kernel);
+IndexRange ComputeIndexRangeWithKernel(IndexRangeKernel kernel,
+                                       GLenum indexType,
+                                       const GLvoid *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled);
+
 // Get the primitive restart index value for the given index type.
 GLuint GetPrimitiveRestartIndex(GLenum indexType);
 
@@ -5,6 +5,9 @@
 
 // utilities_unittest.cpp: Unit tests for ANGLE's GL utility functions
 
+#include <random>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -52,4 +55,100 @@ TEST(ParseResourceName, TrailingWhitespace)
     EXPECT_EQ(GL_INVALID_INDEX, index);
 }
 
+
+const gl::IndexRangeKernel kIndexRangeKernels[] = {
+    gl::IndexRangeKernel::SSE2, gl::IndexRangeKernel::SSE41, gl::IndexRangeKernel::AVX2,
+};
+
+// Checks every supported vector kernel against the scalar one, for every prefix of |indices|
+// and with and without primitive restart.
+template <typename IndexType>
+void CheckIndexRangeKernels(GLenum indexType, const std::vector<IndexType> &indices)
+{
+    for (gl::IndexRangeKernel kernel : kIndexRangeKernels)
+    {
+        if (!gl::IsIndexRangeKernelSupported(kernel))
+        {
+            continue;
+        }
+
+        for (size_t count = 1; count <= indices.size(); ++count)
+        {
+            for (bool primitiveRestart : {false, true})
+            {
+                gl::IndexRange expected = gl::ComputeIndexRangeWithKernel(
+                    gl::IndexRangeKernel::Scalar, indexType, indices.data(), count,
+                    primitiveRestart);
+                gl::IndexRange actual = gl::ComputeIndexRangeWithKernel(
+                    kernel, indexType, indices.data(), count, primitiveRestart);
+
+                EXPECT_EQ(expected.start, actual.start) << count;
+                EXPECT_EQ(expected.end, actual.end) << count;
+                EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount) << count;
+            }
+        }
+    }
+}
+
+// Random indices with a sprinkling of primitive restart values.
+template <typename IndexType>
+std::vector<IndexType> MakeRandomIndices(size_t count)
+{
+    std::mt19937 generator(1234u);
+    std::uniform_int_distribution<uint32_t> distribution(0, std::numeric_limits<IndexType>::max());
+
+    std::vector<IndexType> indices(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        indices[i] = (i % 7 == 3) ? std::numeric_limits<IndexType>::max()
+                                  : static_cast<IndexType>(distribution(generator));
+    }
+    return indices;
+}
+
+// Check the vector kernels match the scalar one on random ubyte indices.
+TEST(ComputeIndexRange, UnsignedByteKernels)
+{
+    CheckIndexRangeKernels(GL_UNSIGNED_BYTE, MakeRandomIndices<GLubyte>(100));
+}
+
+// Check the vector kernels match the scalar one on random ushort indices.
+TEST(ComputeIndexRange, UnsignedShortKernels)
+{
+    CheckIndexRangeKernels(GL_UNSIGNED_SHORT, MakeRandomIndices<GLushort>(100));
+}
+
+// Check the vector kernels match the scalar one on random uint indices, which exercise the
+// sign flipping in the SSE2 kernel.
+TEST(ComputeIndexRange, UnsignedIntKernels)
+{
+    CheckIndexRangeKernels(GL_UNSIGNED_INT, MakeRandomIndices<GLuint>(100));
+}
+
+// Check the edge cases: only restart indices, the restart value used as a regular index when
+// primitive restart is off, and a single valid index hidden among restart indices.
+TEST(ComputeIndexRange, PrimitiveRestartEdgeCases)
+{
+    std::vector<GLushort> allRestart(40, 0xFFFF);
+    CheckIndexRangeKernels(GL_UNSIGNED_SHORT, allRestart);
+
+    gl::IndexRange range =
+        gl::ComputeIndexRange(GL_UNSIGNED_SHORT, allRestart.data(), allRestart.size(), false);
+    EXPECT_EQ(0xFFFFu, range.start);
+    EXPECT_EQ(0xFFFFu, range.end);
+    EXPECT_EQ(40u, range.vertexIndexCount);
+
+    range = gl::ComputeIndexRange(GL_UNSIGNED_SHORT, allRestart.data(), allRestart.size(), true);
+    EXPECT_EQ(0u, range.vertexIndexCount);
+
+    std::vector<GLuint> oneValid(40, 0xFFFFFFFFu);
+    oneValid[37] = 5u;
+    CheckIndexRangeKernels(GL_UNSIGNED_INT, oneValid);
+
+    range = gl::ComputeIndexRange(GL_UNSIGNED_INT, oneValid.data(), oneValid.size(), true);
+    EXPECT_EQ(5u, range.start);
+    EXPECT_EQ(5u, range.end);
+    EXPECT_EQ(1u, range.vertexIndexCount);
+}
+
 }
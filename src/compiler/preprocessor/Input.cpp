@@ -49,64 +49,69 @@ const char *Input::skipChar()
 size_t Input::read(char *buf, size_t maxSize, int *lineNo)
 {
     size_t nRead = 0;
-    // The previous call to read might have stopped copying the string when encountering a line
-    // continuation. Check for this possibility first.
-    if (mReadLoc.sIndex < mCount && maxSize > 0)
+    // Returning without reading anything signals the end of the input, so keep going when only
+    // line continuations or empty strings were skipped.
+    while (nRead == 0 && maxSize > 0 && mReadLoc.sIndex < mCount)
     {
-        const char *c = mString[mReadLoc.sIndex] + mReadLoc.cIndex;
-        if ((*c) == '\\')
+        // The previous call to read might have stopped copying the string when encountering a line
+        // continuation. Check for this possibility first.
+        if (mReadLoc.cIndex < mLength[mReadLoc.sIndex])
         {
-            c = skipChar();
-            if (c != nullptr && (*c) == '\n')
+            const char *c = mString[mReadLoc.sIndex] + mReadLoc.cIndex;
+            if ((*c) == '\\')
             {
-                // Line continuation of backslash + newline.
-                skipChar();
-                ++(*lineNo);
-            }
-            else if (c != nullptr && (*c) == '\r')
-            {
-                // Line continuation. Could be backslash + '\r\n' or just backslash + '\r'.
                 c = skipChar();
                 if (c != nullptr && (*c) == '\n')
                 {
+                    // Line continuation of backslash + newline.
                     skipChar();
+                    ++(*lineNo);
+                }
+                else if (c != nullptr && (*c) == '\r')
+                {
+                    // Line continuation. Could be backslash + '\r\n' or just backslash + '\r'.
+                    c = skipChar();
+                    if (c != nullptr && (*c) == '\n')
+                    {
+                        skipChar();
+                    }
+                    ++(*lineNo);
+                }
+                else
+                {
+                    // Not line continuation, so write the skipped backslash to buf.
+                    *buf = '\\';
+                    ++nRead;
                 }
-                ++(*lineNo);
-            }
-            else
-            {
-                // Not line continuation, so write the skipped backslash to buf.
-                *buf = '\\';
-                ++nRead;
             }
         }
-    }
 
-    size_t maxRead = maxSize;
-    while ((nRead < maxRead) && (mReadLoc.sIndex < mCount))
-    {
-        size_t size = mLength[mReadLoc.sIndex] - mReadLoc.cIndex;
-        size        = std::min(size, maxSize);
-        for (size_t i = 0; i < size; ++i)
+        size_t maxRead = maxSize;
+        while ((nRead < maxRead) && (mReadLoc.sIndex < mCount))
         {
+            const char *begin = mString[mReadLoc.sIndex] + mReadLoc.cIndex;
+            size_t size       = mLength[mReadLoc.sIndex] - mReadLoc.cIndex;
+            size              = std::min(size, maxRead - nRead);
+
             // Stop if a possible line continuation is encountered.
             // It will be processed on the next call on input, which skips it
             // and increments line number if necessary.
-            if (*(mString[mReadLoc.sIndex] + mReadLoc.cIndex + i) == '\\')
+            const char *backslash = static_cast<const char *>(std::memchr(begin, '\\', size));
+            if (backslash != nullptr)
             {
-                size    = i;
+                size    = backslash - begin;
                 maxRead = nRead + size;  // Stop reading right before the backslash.
             }
-        }
-        std::memcpy(buf + nRead, mString[mReadLoc.sIndex] + mReadLoc.cIndex, size);
-        nRead += size;
-        mReadLoc.cIndex += size;
+            std::memcpy(buf + nRead, begin, size);
+            nRead += size;
+            mReadLoc.cIndex += size;
 
-        // Advance string if we reached the end of current string.
-        if (mReadLoc.cIndex == mLength[mReadLoc.sIndex])
-        {
-            ++mReadLoc.sIndex;
-            mReadLoc.cIndex = 0;
+            // Advance string if we reached the end of current string.
+            if (mReadLoc.cIndex == mLength[mReadLoc.sIndex])
+            {
+                ++mReadLoc.sIndex;
+                mReadLoc.cIndex = 0;
+            }
         }
     }
     return nRead;
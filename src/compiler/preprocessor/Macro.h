@@ -7,9 +7,9 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace pp
@@ -40,7 +40,7 @@ struct Macro
     Replacements replacements;
 };
 
-typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
+typedef std::unordered_map<std::string, std::shared_ptr<Macro>> MacroSet;
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value);
 
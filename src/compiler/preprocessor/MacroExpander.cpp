@@ -20,33 +20,30 @@ namespace
 
 const size_t kMaxContextTokens = 10000;
 
+// Lexes a range of tokens, moving them out of the range.
 class TokenLexer : public Lexer
 {
   public:
-    typedef std::vector<Token> TokenVector;
+    typedef std::vector<Token>::iterator TokenIterator;
 
-    TokenLexer(TokenVector *tokens)
-    {
-        tokens->swap(mTokens);
-        mIter = mTokens.begin();
-    }
+    TokenLexer(TokenIterator begin, TokenIterator end) : mIter(begin), mEnd(end) {}
 
     void lex(Token *token) override
     {
-        if (mIter == mTokens.end())
+        if (mIter == mEnd)
         {
             token->reset();
             token->type = Token::LAST;
         }
         else
         {
-            *token = *mIter++;
+            *token = std::move(*mIter++);
         }
     }
 
   private:
-    TokenVector mTokens;
-    TokenVector::const_iterator mIter;
+    TokenIterator mIter;
+    TokenIterator mEnd;
 };
 
 }  // anonymous namespace
@@ -87,6 +84,7 @@ MacroExpander::MacroExpander(Lexer *lexer,
     : mLexer(lexer),
       mMacroSet(macroSet),
       mDiagnostics(diagnostics),
+      mHasReserveToken(false),
       mTotalTokensInContexts(0),
       mAllowedMacroExpansionDepth(allowedMacroExpansionDepth),
       mDeferReenablingMacros(false)
@@ -143,10 +141,10 @@ void MacroExpander::lex(Token *token)
 
 void MacroExpander::getToken(Token *token)
 {
-    if (mReserveToken.get())
+    if (mHasReserveToken)
     {
-        *token = *mReserveToken;
-        mReserveToken.reset();
+        *token           = std::move(mReserveToken);
+        mHasReserveToken = false;
         return;
     }
 
@@ -158,7 +156,7 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back()->get();
+        mContextStack.back()->get(token);
     }
     else
     {
@@ -172,13 +170,13 @@ void MacroExpander::ungetToken(const Token &token)
     if (!mContextStack.empty())
     {
         MacroContext *context = mContextStack.back();
-        context->unget();
-        ASSERT(context->replacements[context->index] == token);
+        context->unget(token);
     }
     else
     {
-        ASSERT(!mReserveToken.get());
-        mReserveToken.reset(new Token(token));
+        ASSERT(!mHasReserveToken);
+        mReserveToken    = token;
+        mHasReserveToken = true;
     }
 }
 
@@ -200,18 +198,19 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    MacroContext *context = new MacroContext;
+    context->macro        = macro;
+    if (!expandMacro(*macro, identifier, context))
+    {
+        delete context;
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    MacroContext *context = new MacroContext;
-    context->macro        = macro;
-    context->replacements.swap(replacements);
     mContextStack.push_back(context);
-    mTotalTokensInContexts += context->replacements.size();
+    mTotalTokensInContexts += context->size();
     return true;
 }
 
@@ -234,70 +233,60 @@ void MacroExpander::popMacro()
         context->macro->disabled = false;
     }
     context->macro->expansionCount--;
-    mTotalTokensInContexts -= context->replacements.size();
+    mTotalTokensInContexts -= context->size();
     delete context;
 }
 
-bool MacroExpander::expandMacro(const Macro &macro,
-                                const Token &identifier,
-                                std::vector<Token> *replacements)
+bool MacroExpander::expandMacro(const Macro &macro, const Token &identifier, MacroContext *context)
 {
-    replacements->clear();
+    // The first token in the replacement list inherits the padding
+    // properties of the identifier token.
+    context->atStartOfLine   = identifier.atStartOfLine();
+    context->hasLeadingSpace = identifier.hasLeadingSpace();
 
     // In the case of an object-like macro, the replacement list gets its location
     // from the identifier, but in the case of a function-like macro, the replacement
     // list gets its location from the closing parenthesis of the macro invocation.
     // This is tested by dEQP-GLES3.functional.shaders.preprocessor.predefined_macros.*
-    SourceLocation replacementLocation = identifier.location;
+    context->location = identifier.location;
     if (macro.type == Macro::kTypeObj)
     {
-        replacements->assign(macro.replacements.begin(), macro.replacements.end());
+        context->replacements = &macro.replacements;
 
         if (macro.predefined)
         {
             const char kLine[] = "__LINE__";
             const char kFile[] = "__FILE__";
 
-            ASSERT(replacements->size() == 1);
-            Token &repl = replacements->front();
-            if (macro.name == kLine)
+            ASSERT(macro.replacements.size() == 1);
+            if (macro.name == kLine || macro.name == kFile)
             {
-                repl.text = ToString(identifier.location.line);
-            }
-            else if (macro.name == kFile)
-            {
-                repl.text = ToString(identifier.location.file);
+                Token repl = macro.replacements.front();
+                repl.text  = ToString(macro.name == kLine ? identifier.location.line
+                                                         : identifier.location.file);
+                context->ownedReplacements.push_back(std::move(repl));
+                context->replacements = &context->ownedReplacements;
             }
         }
     }
     else
     {
         ASSERT(macro.type == Macro::kTypeFunc);
+        std::vector<Token> argTokens;
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
+        if (!collectMacroArgs(macro, identifier, &argTokens, &args, &context->location))
             return false;
 
-        replaceMacroParams(macro, args, replacements);
-    }
-
-    for (std::size_t i = 0; i < replacements->size(); ++i)
-    {
-        Token &repl = replacements->at(i);
-        if (i == 0)
-        {
-            // The first token in the replacement list inherits the padding
-            // properties of the identifier token.
-            repl.setAtStartOfLine(identifier.atStartOfLine());
-            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
-        }
-        repl.location = replacementLocation;
+        replaceMacroParams(macro, argTokens, args, &context->ownedReplacements);
+        context->replacements = &context->ownedReplacements;
     }
     return true;
 }
 
 bool MacroExpander::collectMacroArgs(const Macro &macro,
                                      const Token &identifier,
+                                     std::vector<Token> *argTokens,
                                      std::vector<MacroArg> *args,
                                      SourceLocation *closingParenthesisLocation)
 {
@@ -305,7 +294,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
     getToken(&token);
     ASSERT(token.type == '(');
 
-    args->push_back(MacroArg());
+    args->push_back({0, 0});
 
     // Defer reenabling macros until args collection is finished to avoid the possibility of
     // infinite recursion. Otherwise infinite recursion might happen when expanding the args after
@@ -343,7 +332,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
                 // the comma tokens between matching inner parentheses do not
                 // seperate arguments.
                 if (openParens == 1)
-                    args->push_back(MacroArg());
+                    args->push_back({argTokens->size(), argTokens->size()});
                 isArg = openParens != 1;
                 break;
             default:
@@ -356,7 +345,8 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
             // Initial whitespace is not part of the argument.
             if (arg.empty())
                 token.setHasLeadingSpace(false);
-            arg.push_back(token);
+            argTokens->push_back(std::move(token));
+            arg.end = argTokens->size();
         }
     }
 
@@ -380,38 +370,79 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
     // This step expands each argument individually before they are
     // inserted into the macro body.
     size_t numTokens = 0;
+    std::vector<Token> expandedTokens;
+    expandedTokens.reserve(argTokens->size());
     for (auto &arg : *args)
     {
-        TokenLexer lexer(&arg);
         if (mAllowedMacroExpansionDepth < 1)
         {
             mDiagnostics->report(Diagnostics::PP_MACRO_INVOCATION_CHAIN_TOO_DEEP, token.location,
                                  token.text);
             return false;
         }
-        MacroExpander expander(&lexer, mMacroSet, mDiagnostics, mAllowedMacroExpansionDepth - 1);
 
-        arg.clear();
-        expander.lex(&token);
-        while (token.type != Token::LAST)
+        auto argBegin           = argTokens->begin() + arg.begin;
+        auto argEnd             = argTokens->begin() + arg.end;
+        size_t expandedArgBegin = expandedTokens.size();
+
+        // An argument without macro names expands to itself, so it is kept as is instead of being
+        // run through another MacroExpander.
+        if (!mayContainMacroInvocation(*argTokens, arg) &&
+            numTokens + arg.size() + mTotalTokensInContexts <= kMaxContextTokens)
         {
-            arg.push_back(token);
+            expandedTokens.insert(expandedTokens.end(), std::make_move_iterator(argBegin),
+                                  std::make_move_iterator(argEnd));
+            numTokens += arg.size();
+        }
+        else
+        {
+            TokenLexer lexer(argBegin, argEnd);
+            MacroExpander expander(&lexer, mMacroSet, mDiagnostics,
+                                   mAllowedMacroExpansionDepth - 1);
+
             expander.lex(&token);
-            numTokens++;
-            if (numTokens + mTotalTokensInContexts > kMaxContextTokens)
+            while (token.type != Token::LAST)
             {
-                mDiagnostics->report(Diagnostics::PP_OUT_OF_MEMORY, token.location, token.text);
-                return false;
+                expandedTokens.push_back(std::move(token));
+                expander.lex(&token);
+                numTokens++;
+                if (numTokens + mTotalTokensInContexts > kMaxContextTokens)
+                {
+                    mDiagnostics->report(Diagnostics::PP_OUT_OF_MEMORY, token.location,
+                                         token.text);
+                    return false;
+                }
             }
         }
+
+        arg.begin = expandedArgBegin;
+        arg.end   = expandedTokens.size();
     }
+    argTokens->swap(expandedTokens);
     return true;
 }
 
+bool MacroExpander::mayContainMacroInvocation(const std::vector<Token> &argTokens,
+                                              const MacroArg &arg) const
+{
+    for (std::size_t i = arg.begin; i < arg.end; ++i)
+    {
+        const Token &token = argTokens[i];
+        if (token.type == Token::IDENTIFIER && !token.expansionDisabled() &&
+            mMacroSet->find(token.text) != mMacroSet->end())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void MacroExpander::replaceMacroParams(const Macro &macro,
+                                       const std::vector<Token> &argTokens,
                                        const std::vector<MacroArg> &args,
                                        std::vector<Token> *replacements)
 {
+    replacements->reserve(macro.replacements.size() + argTokens.size());
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
     {
         if (!replacements->empty() &&
@@ -447,31 +478,52 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
             continue;
         }
         std::size_t iRepl = replacements->size();
-        replacements->insert(replacements->end(), arg.begin(), arg.end());
+        replacements->insert(replacements->end(), argTokens.begin() + arg.begin,
+                             argTokens.begin() + arg.end);
         // The replacement token inherits padding properties from
         // macro replacement token.
         replacements->at(iRepl).setHasLeadingSpace(repl.hasLeadingSpace());
     }
 }
 
-MacroExpander::MacroContext::MacroContext() : macro(0), index(0)
+MacroExpander::MacroContext::MacroContext()
+    : macro(0), index(0), replacements(nullptr), atStartOfLine(false), hasLeadingSpace(false)
 {
 }
 
 bool MacroExpander::MacroContext::empty() const
 {
-    return index == replacements.size();
+    return index == replacements->size();
+}
+
+std::size_t MacroExpander::MacroContext::size() const
+{
+    return replacements->size();
 }
 
-const Token &MacroExpander::MacroContext::get()
+void MacroExpander::MacroContext::get(Token *token)
 {
-    return replacements[index++];
+    // Tokens owned by the context are read only once, unless they are put back with unget().
+    if (replacements == &ownedReplacements)
+        *token = std::move(ownedReplacements[index]);
+    else
+        *token = (*replacements)[index];
+    if (index == 0)
+    {
+        token->setAtStartOfLine(atStartOfLine);
+        token->setHasLeadingSpace(hasLeadingSpace);
+    }
+    token->location = location;
+    ++index;
 }
 
-void MacroExpander::MacroContext::unget()
+void MacroExpander::MacroContext::unget(const Token &token)
 {
     ASSERT(index > 0);
     --index;
+    if (replacements == &ownedReplacements)
+        ownedReplacements[index] = token;
+    ASSERT((*replacements)[index].text == token.text);
 }
 
 }  // namespace pp
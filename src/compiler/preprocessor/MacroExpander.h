@@ -12,12 +12,12 @@
 
 #include "compiler/preprocessor/Lexer.h"
 #include "compiler/preprocessor/Macro.h"
+#include "compiler/preprocessor/Token.h"
 
 namespace pp
 {
 
 class Diagnostics;
-struct SourceLocation;
 
 class MacroExpander : public Lexer
 {
@@ -38,34 +38,59 @@ class MacroExpander : public Lexer
     bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
     void popMacro();
 
-    bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
+    struct MacroContext;
+    bool expandMacro(const Macro &macro, const Token &identifier, MacroContext *context);
 
-    typedef std::vector<Token> MacroArg;
+    // The tokens of all the arguments of an invocation are stored one after the other in a single
+    // vector, and every argument is a range of it.
+    struct MacroArg
+    {
+        bool empty() const { return begin == end; }
+        std::size_t size() const { return end - begin; }
+
+        std::size_t begin;
+        std::size_t end;
+    };
     bool collectMacroArgs(const Macro &macro,
                           const Token &identifier,
+                          std::vector<Token> *argTokens,
                           std::vector<MacroArg> *args,
                           SourceLocation *closingParenthesisLocation);
+    // Returns false if lexing |arg| through a MacroExpander would leave it unchanged.
+    bool mayContainMacroInvocation(const std::vector<Token> &argTokens, const MacroArg &arg) const;
     void replaceMacroParams(const Macro &macro,
+                            const std::vector<Token> &argTokens,
                             const std::vector<MacroArg> &args,
                             std::vector<Token> *replacements);
 
+    // The tokens of a macro expansion. They take the location of the invocation, and the first one
+    // the padding of the macro name, as they are read. This way the replacement list of an
+    // object-like macro is used as is instead of being copied for every expansion.
     struct MacroContext
     {
         MacroContext();
         bool empty() const;
-        const Token &get();
-        void unget();
+        std::size_t size() const;
+        void get(Token *token);
+        void unget(const Token &token);
 
         std::shared_ptr<Macro> macro;
         std::size_t index;
-        std::vector<Token> replacements;
+        // Points to either the replacement list of |macro| or to |ownedReplacements|.
+        const std::vector<Token> *replacements;
+        // Tokens made for this expansion only: substituted arguments, __LINE__ and __FILE__.
+        std::vector<Token> ownedReplacements;
+        SourceLocation location;
+        bool atStartOfLine;
+        bool hasLeadingSpace;
     };
 
     Lexer *mLexer;
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
 
-    std::unique_ptr<Token> mReserveToken;
+    Token mReserveToken;
+    bool mHasReserveToken;
     std::vector<MacroContext *> mContextStack;
     size_t mTotalTokensInContexts;
 
@@ -1,5 +1,5 @@
 //
-// Copyright (c) 2012-2014 The ANGLE Project Authors. All rights reserved.
+// Copyright (c) 2012-2017 The ANGLE Project Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
@@ -7,6 +7,9 @@
 #ifndef COMPILER_PREPROCESSOR_TOKENIZER_H_
 #define COMPILER_PREPROCESSOR_TOKENIZER_H_
 
+#include <string>
+#include <vector>
+
 #include "common/angleutils.h"
 #include "compiler/preprocessor/Input.h"
 #include "compiler/preprocessor/Lexer.h"
@@ -15,24 +18,11 @@ namespace pp
 {
 
 class Diagnostics;
+struct SourceLocation;
 
 class Tokenizer : public Lexer
 {
   public:
-    struct Context
-    {
-        Diagnostics *diagnostics;
-
-        Input input;
-        // The location where yytext points to. Token location should track
-        // scanLoc instead of Input::mReadLoc because they may not be the same
-        // if text is buffered up in the scanner input buffer.
-        Input::Location scanLoc;
-
-        bool leadingSpace;
-        bool lineStart;
-    };
-
     Tokenizer(Diagnostics *diagnostics);
     ~Tokenizer();
 
@@ -45,11 +35,45 @@ class Tokenizer : public Lexer
     void lex(Token *token) override;
 
   private:
-    bool initScanner();
-    void destroyScanner();
+    // Returns the type of the next token, skipping whitespace and comments.
+    int scanToken(std::string *text, SourceLocation *location);
+    int scanEndOfInput(std::string *text, SourceLocation *location);
+    void scanCommentPiece(int c, SourceLocation *location);
+    int scanOperator(int c, int doubledType, int assignType, size_t *length);
+    int scanNumber(size_t *length);
+    size_t scanExponent(size_t offset);
+    size_t scanNewline(size_t offset);
+
+    // Returns the character |offset| bytes after the cursor, or -1 if the input ends before it.
+    int peekChar(size_t offset);
+    // Returns the offset of the first character at or after |offset| that |skipChars| stops at.
+    // |skipChars| returns the length of the run it accepts at the start of [begin, end).
+    size_t skipRun(size_t offset, size_t (*skipChars)(const char *begin, const char *end));
+    // Moves the unscanned text to the start of the buffer and appends more input to it. Returns
+    // false at the end of the input.
+    bool fillBuffer();
+
+    // Moves the cursor past |length| characters, setting |location| to where they start.
+    void consume(size_t length, SourceLocation *location);
+    int matchToken(int type, size_t length, std::string *text, SourceLocation *location);
+
+    Diagnostics *mDiagnostics;
+    Input mInput;
+    // The location where the cursor points to. Token location should track mScanLoc instead of
+    // Input::mReadLoc because they may not be the same if text is buffered up in mBuffer.
+    Input::Location mScanLoc;
+
+    std::vector<char> mBuffer;
+    size_t mCursor;     // Start of the text that hasn't been scanned yet.
+    size_t mBufferEnd;  // End of the text read from the input.
+    bool mInputEnded;
+
+    int mFileNumber;
+    int mLineNumber;
+    bool mLeadingSpace;
+    bool mLineStart;
+    bool mInComment;
 
-    void *mHandle;         // Scanner handle.
-    Context mContext;      // Scanner extra.
     size_t mMaxTokenSize;  // Maximum token size
 };
 
@@ -7,6 +7,7 @@
 #include "compiler/translator/AddAndTrueToLoopCondition.h"
 
 #include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PassManager.h"
 
 namespace sh
 {
@@ -50,10 +51,17 @@ class AddAndTrueToLoopConditionTraverser : public TIntermTraverser
 
 }  // anonymous namespace
 
-void AddAndTrueToLoopCondition(TIntermNode *root)
+void QueueAddAndTrueToLoopCondition(TPassManager *passes)
 {
-    AddAndTrueToLoopConditionTraverser traverser;
-    root->traverse(&traverser);
+    // The loop condition becomes the left operand of the new node.
+    TPassTraits traits;
+    traits.visits               = kLoopNode;
+    traits.replaces             = 0;
+    traits.changes              = kLoopNode | kBinaryNode | kConstantUnionNode;
+    traits.changesInPlace       = true;
+    traits.usesTraversalContext = false;
+    passes->addRewrite("AddAndTrueToLoopCondition", traits,
+                       std::unique_ptr<TIntermTraverser>(new AddAndTrueToLoopConditionTraverser()));
 }
 
 }  // namespace sh
@@ -12,8 +12,10 @@
 class TIntermNode;
 namespace sh
 {
+class TPassManager;
 
-void AddAndTrueToLoopCondition(TIntermNode *root);
+// Queues the rewrite in |passes|, so that it can share a traversal with other passes.
+void QueueAddAndTrueToLoopCondition(TPassManager *passes);
 
 }  // namespace sh
 
@@ -245,6 +245,14 @@ void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TIntermNode *root
     root->traverse(&marker);
 }
 
+std::unique_ptr<TIntermTraverser> BuiltInFunctionEmulator::createMarker()
+{
+    if (mEmulatedFunctions.empty())
+        return nullptr;
+
+    return std::unique_ptr<TIntermTraverser>(new BuiltInFunctionEmulationMarker(*this));
+}
+
 void BuiltInFunctionEmulator::cleanup()
 {
     mFunctions.clear();
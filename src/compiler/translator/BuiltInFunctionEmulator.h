@@ -7,6 +7,8 @@
 #ifndef COMPILER_TRANSLATOR_BUILTINFUNCTIONEMULATOR_H_
 #define COMPILER_TRANSLATOR_BUILTINFUNCTIONEMULATOR_H_
 
+#include <memory>
+
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
 
@@ -25,6 +27,10 @@ class BuiltInFunctionEmulator
 
     void markBuiltInFunctionsForEmulation(TIntermNode *root);
 
+    // Returns the traverser used by markBuiltInFunctionsForEmulation, so that it can share a
+    // traversal with other passes. Returns null if no function needs emulation.
+    std::unique_ptr<TIntermTraverser> createMarker();
+
     void cleanup();
 
     // "name" gets written as "webgl_name_emu".
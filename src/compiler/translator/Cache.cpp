@@ -11,6 +11,8 @@
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "compiler/translator/Cache.h"
+#include "compiler/translator/Initialize.h"
+#include "compiler/translator/SymbolTable.h"
 
 namespace sh
 {
@@ -57,6 +59,14 @@ TCache::TypeKey::TypeKey(TBasicType basicType,
 
 TCache *TCache::sCache = nullptr;
 
+TCache::TCache()
+{
+}
+
+TCache::~TCache()
+{
+}
+
 void TCache::initialize()
 {
     if (sCache == nullptr)
@@ -76,6 +86,8 @@ const TType *TCache::getType(TBasicType basicType,
                              unsigned char primarySize,
                              unsigned char secondarySize)
 {
+    std::lock_guard<std::recursive_mutex> lock(sCache->mMutex);
+
     TypeKey key(basicType, precision, qualifier, primarySize, secondarySize);
     auto it = sCache->mTypes.find(key);
     if (it != sCache->mTypes.end())
@@ -92,4 +104,31 @@ const TType *TCache::getType(TBasicType basicType,
     return type;
 }
 
+const TSymbolTable *TCache::getBuiltInSymbolTable(sh::GLenum shaderType,
+                                                  ShShaderSpec spec,
+                                                  const ShBuiltInResources &resources,
+                                                  const std::string &resourceString)
+{
+    std::lock_guard<std::recursive_mutex> lock(sCache->mMutex);
+
+    BuiltInSymbolTableKey key(shaderType, spec, resourceString);
+    auto it = sCache->mBuiltInSymbolTables.find(key);
+    if (it != sCache->mBuiltInSymbolTables.end())
+    {
+        return it->second.get();
+    }
+
+    // The symbols outlive the compiler that first asks for them, so they go to the cache's pool.
+    TScopedAllocator scopedAllocator(&sCache->mAllocator);
+
+    std::unique_ptr<TSymbolTable> symbolTable(new TSymbolTable());
+    InitializeBuiltInSymbolTable(shaderType, spec, resources, *symbolTable);
+    symbolTable->realizeBuiltIns();
+
+    const TSymbolTable *builtIns = symbolTable.get();
+    sCache->mBuiltInSymbolTables.insert(std::make_pair(key, std::move(symbolTable)));
+
+    return builtIns;
+}
+
 }  // namespace sh
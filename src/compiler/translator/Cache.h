@@ -12,6 +12,10 @@
 #include <stdint.h>
 #include <string.h>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
 
 #include "compiler/translator/Types.h"
 #include "compiler/translator/PoolAlloc.h"
@@ -19,9 +23,13 @@
 namespace sh
 {
 
+class TSymbolTable;
+
 class TCache
 {
   public:
+    ~TCache();
+
     static void initialize();
     static void destroy();
 
@@ -48,8 +56,16 @@ class TCache
                                 unsigned char primarySize,
                                 unsigned char secondarySize);
 
+    // Returns the built-in levels for a shader type and spec, creating them the first time a given
+    // resource string is seen. The table is shared by every compiler in the process and must only
+    // be read. |resourceString| has to identify all the |resources| the built-ins depend on.
+    static const TSymbolTable *getBuiltInSymbolTable(sh::GLenum shaderType,
+                                                     ShShaderSpec spec,
+                                                     const ShBuiltInResources &resources,
+                                                     const std::string &resourceString);
+
   private:
-    TCache() {}
+    TCache();
 
     union TypeKey {
         TypeKey(TBasicType basicType,
@@ -73,9 +89,19 @@ class TCache
     };
     typedef std::map<TypeKey, const TType *> TypeMap;
 
+    typedef std::tuple<sh::GLenum, ShShaderSpec, std::string> BuiltInSymbolTableKey;
+    typedef std::map<BuiltInSymbolTableKey, std::unique_ptr<TSymbolTable>> BuiltInSymbolTableMap;
+
+    // Guards the whole cache, including its pool, for compilers running on several threads. It is
+    // recursive because building the built-in symbol tables looks up types.
+    std::recursive_mutex mMutex;
+
     TypeMap mTypes;
     TPoolAllocator mAllocator;
 
+    // Declared after the allocator so that the tables are destroyed while their memory is valid.
+    BuiltInSymbolTableMap mBuiltInSymbolTables;
+
     static TCache *sCache;
 };
 
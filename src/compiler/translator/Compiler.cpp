@@ -6,6 +6,7 @@
 
 #include "compiler/translator/Compiler.h"
 
+#include <chrono>
 #include <sstream>
 
 #include "angle_gl.h"
@@ -18,6 +19,7 @@
 #include "compiler/translator/EmulatePrecision.h"
 #include "compiler/translator/Initialize.h"
 #include "compiler/translator/InitializeVariables.h"
+#include "compiler/translator/OptimizeTree.h"
 #include "compiler/translator/ParseContext.h"
 #include "compiler/translator/PruneEmptyDeclarations.h"
 #include "compiler/translator/RegenerateStructNames.h"
@@ -137,19 +139,21 @@ namespace
 class TScopedPoolAllocator
 {
   public:
-    TScopedPoolAllocator(TPoolAllocator *allocator) : mAllocator(allocator)
+    TScopedPoolAllocator(TPoolAllocator *allocator)
+        : mAllocator(allocator), mPreviousAllocator(GetGlobalPoolAllocator())
     {
         mAllocator->push();
         SetGlobalPoolAllocator(mAllocator);
     }
     ~TScopedPoolAllocator()
     {
-        SetGlobalPoolAllocator(NULL);
+        SetGlobalPoolAllocator(mPreviousAllocator);
         mAllocator->pop();
     }
 
   private:
     TPoolAllocator *mAllocator;
+    TPoolAllocator *mPreviousAllocator;
 };
 
 class TScopedSymbolTableLevel
@@ -199,7 +203,12 @@ TShHandleBase::TShHandleBase()
 
 TShHandleBase::~TShHandleBase()
 {
-    SetGlobalPoolAllocator(NULL);
+    // The handle may be destroyed on another thread than the one it was last used on, only reset
+    // this thread's allocator if it is ours.
+    if (GetGlobalPoolAllocator() == &allocator)
+    {
+        SetGlobalPoolAllocator(NULL);
+    }
     allocator.popAll();
 }
 
@@ -218,7 +227,8 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mDiagnostics(infoSink.info),
       mSourcePath(NULL),
       mComputeShaderLocalSizeDeclared(false),
-      mTemporaryIndex(0)
+      mTemporaryIndex(0),
+      mCompileSeconds(0.0)
 {
     mComputeShaderLocalSize.fill(1);
 }
@@ -297,10 +307,27 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     // Start pushing the user-defined symbols at global level.
     TScopedSymbolTableLevel scopedSymbolLevel(&symbolTable);
 
+    std::vector<TPassStatistics> *statistics =
+        (compileOptions & SH_COMPILE_STATISTICS) ? &mCompileStatistics : nullptr;
+
     // Parse shader.
+    TPassMeasurement parseMeasurement(statistics);
     bool success = (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
                                    &parseContext) == 0) &&
                    (parseContext.getTreeRoot() != nullptr);
+    parseMeasurement.finish("Parse");
+
+    if (statistics)
+    {
+        // The lexer pulls tokens from the preprocessor while parsing, so the preprocessor time is
+        // measured on its own and taken out of the parse time. It doesn't use the pool allocator.
+        TPassStatistics preprocess;
+        preprocess.name           = "Preprocess";
+        preprocess.seconds        = parseContext.getPreprocessorSeconds();
+        preprocess.allocatedBytes = 0;
+        statistics->back().seconds -= preprocess.seconds;
+        statistics->insert(statistics->end() - 1, preprocess);
+    }
 
     shaderVersion = parseContext.getShaderVersion();
     if (success && MapSpecToShaderVersion(shaderSpec) < shaderVersion)
@@ -335,13 +362,18 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
             success = false;
         }
 
+        // Runs the passes below. The passes that it queues share a single traversal unless one of
+        // the passes that it runs on their own comes in between, or what they change conflicts.
+        TPassManager passes(root, statistics);
+
         // Disallow expressions deemed too complex.
         if (success && (compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY))
-            success = limitExpressionComplexity(root);
+            success = passes.run("LimitExpressionComplexity",
+                                 [this, root]() { return limitExpressionComplexity(root); });
 
         // Create the function DAG and check there is no recursion
         if (success)
-            success = initCallDag(root);
+            success = passes.run("CallDAG", [this, root]() { return initCallDag(root); });
 
         if (success && (compileOptions & SH_LIMIT_CALL_STACK_DEPTH))
             success = checkCallDepth();
@@ -355,25 +387,32 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         }
 
         if (success && !(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS))
-            success = pruneUnusedFunctions(root);
+            success = passes.run("PruneUnusedFunctions",
+                                 [this, root]() { return pruneUnusedFunctions(root); });
 
         // Prune empty declarations to work around driver bugs and to keep declaration output
         // simple.
         if (success)
-            PruneEmptyDeclarations(root);
+            passes.runTransform("PruneEmptyDeclarations",
+                                [root]() { PruneEmptyDeclarations(root); });
 
         if (success && shaderVersion == 300 && shaderType == GL_FRAGMENT_SHADER)
-            success = validateOutputs(root);
+            success =
+                passes.run("ValidateOutputs", [this, root]() { return validateOutputs(root); });
 
         if (success && shouldRunLoopAndIndexingValidation(compileOptions))
-            success =
-                ValidateLimitations(root, shaderType, symbolTable, shaderVersion, &mDiagnostics);
+            success = passes.run("ValidateLimitations", [this, root]() {
+                return ValidateLimitations(root, shaderType, symbolTable, shaderVersion,
+                                           &mDiagnostics);
+            });
 
         bool multiview2 = IsExtensionEnabled(extensionBehavior, "GL_OVR_multiview2");
         if (success && compileResources.OVR_multiview && IsWebGLBasedSpec(shaderSpec) &&
             (IsExtensionEnabled(extensionBehavior, "GL_OVR_multiview") || multiview2))
-            success = ValidateMultiviewWebGL(root, shaderType, symbolTable, shaderVersion,
-                                             multiview2, &mDiagnostics);
+            success = passes.run("ValidateMultiviewWebGL", [this, root, multiview2]() {
+                return ValidateMultiviewWebGL(root, shaderType, symbolTable, shaderVersion,
+                                              multiview2, &mDiagnostics);
+            });
 
         // Fail compilation if precision emulation not supported.
         if (success && getResources().WEBGL_debug_shader_precision &&
@@ -393,48 +432,63 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
             GetGlobalPoolAllocator()->lock();
             initBuiltInFunctionEmulator(&builtInFunctionEmulator, compileOptions);
             GetGlobalPoolAllocator()->unlock();
-            builtInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
         }
 
+        // An optimized tree is only searched for built-ins to emulate after the dead code is gone.
+        bool optimize = (compileOptions & SH_OPTIMIZE_TREE) != 0;
+        if (success && !optimize)
+            markBuiltInFunctionsForEmulation(&passes);
+
         // Clamping uniform array bounds needs to happen after validateLimitations pass.
         if (success && (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS))
-            arrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
+            passes.addAnalysis("ArrayBoundsClamping", kBinaryNode,
+                               arrayBoundsClamper.CreateIndirectArrayBoundsMarker());
 
         // gl_Position is always written in compatibility output mode
         if (success && shaderType == GL_VERTEX_SHADER &&
             ((compileOptions & SH_INIT_GL_POSITION) ||
              (outputType == SH_GLSL_COMPATIBILITY_OUTPUT)))
-            initializeGLPosition(root);
+            passes.runTransform("InitializeGLPosition",
+                                [this, root]() { initializeGLPosition(root); });
 
-        // This pass might emit short circuits so keep it before the short circuit unfolding
-        if (success && (compileOptions & SH_REWRITE_DO_WHILE_LOOPS))
-            RewriteDoWhile(root, getTemporaryIndex());
+        // The driver workaround rewrites run after the optimization when the tree is optimized,
+        // since constant propagation could bring back the patterns that they remove.
+        auto runWorkaroundRewrites = [this, root, compileOptions, &passes]() {
+            // This pass might emit short circuits so keep it before the short circuit unfolding
+            if (compileOptions & SH_REWRITE_DO_WHILE_LOOPS)
+                passes.runTransform("RewriteDoWhile",
+                                    [this, root]() { RewriteDoWhile(root, getTemporaryIndex()); });
 
-        if (success && (compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION))
-            sh::AddAndTrueToLoopCondition(root);
+            if (compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION)
+                QueueAddAndTrueToLoopCondition(&passes);
 
-        if (success && (compileOptions & SH_UNFOLD_SHORT_CIRCUIT))
-        {
-            UnfoldShortCircuitAST unfoldShortCircuit;
-            root->traverse(&unfoldShortCircuit);
-            unfoldShortCircuit.updateTree();
-        }
+            if (compileOptions & SH_UNFOLD_SHORT_CIRCUIT)
+            {
+                QueueUnfoldShortCircuitAST(&passes);
+            }
 
-        if (success && (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT))
-        {
-            RemovePow(root);
-        }
+            if (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT)
+            {
+                QueueRemovePow(&passes, root);
+            }
+        };
+
+        if (success && !optimize)
+            runWorkaroundRewrites();
 
         if (success && shouldCollectVariables(compileOptions))
         {
-            collectVariables(root);
+            collectVariables(&passes);
             if (compileOptions & SH_USE_UNUSED_STANDARD_SHARED_BLOCKS)
             {
-                useAllMembersInUnusedStandardAndSharedBlocks(root);
+                passes.runTransform("UseUnusedStandardAndSharedBlocks", [this, root]() {
+                    useAllMembersInUnusedStandardAndSharedBlocks(root);
+                });
             }
             if (compileOptions & SH_ENFORCE_PACKING_RESTRICTIONS)
             {
-                success = enforcePackingRestrictions();
+                success = passes.run("EnforcePackingRestrictions",
+                                     [this]() { return enforcePackingRestrictions(); });
                 if (!success)
                 {
                     mDiagnostics.globalError("too many uniforms");
@@ -442,37 +496,61 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
             }
             if (success && (compileOptions & SH_INIT_OUTPUT_VARIABLES))
             {
-                initializeOutputVariables(root);
+                passes.runTransform("InitializeOutputVariables",
+                                    [this, root]() { initializeOutputVariables(root); });
             }
         }
 
         // Removing invariant declarations must be done after collecting variables.
         // Otherwise, built-in invariant declarations don't apply.
         if (success && RemoveInvariant(shaderType, shaderVersion, outputType, compileOptions))
-            sh::RemoveInvariantDeclaration(root);
+            QueueRemoveInvariantDeclaration(&passes);
+
+        // Optimizing must be done after collecting variables, since the static use of variables
+        // depends on the code as it was written.
+        if (success && optimize)
+        {
+            success = passes.run("OptimizeTree", [this, root, compileOptions]() {
+                return optimizeTree(root, compileOptions);
+            });
+            if (success)
+            {
+                markBuiltInFunctionsForEmulation(&passes);
+                runWorkaroundRewrites();
+            }
+        }
 
         if (success && (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS))
         {
-            ScalarizeVecAndMatConstructorArgs(root, shaderType, fragmentPrecisionHigh,
-                                              &mTemporaryIndex);
+            passes.runTransform("ScalarizeVecAndMatConstructorArgs", [this, root]() {
+                ScalarizeVecAndMatConstructorArgs(root, shaderType, fragmentPrecisionHigh,
+                                                  &mTemporaryIndex);
+            });
         }
 
         if (success && (compileOptions & SH_REGENERATE_STRUCT_NAMES))
         {
-            RegenerateStructNames gen(symbolTable, shaderVersion);
-            root->traverse(&gen);
+            passes.runTransform("RegenerateStructNames", [this, root]() {
+                RegenerateStructNames gen(symbolTable, shaderVersion);
+                root->traverse(&gen);
+            });
         }
 
         if (success && shaderType == GL_FRAGMENT_SHADER && shaderVersion == 100 &&
             compileResources.EXT_draw_buffers && compileResources.MaxDrawBuffers > 1 &&
             IsExtensionEnabled(extensionBehavior, "GL_EXT_draw_buffers"))
         {
-            EmulateGLFragColorBroadcast(root, compileResources.MaxDrawBuffers, &outputVariables);
+            passes.runTransform("EmulateGLFragColorBroadcast", [this, root]() {
+                EmulateGLFragColorBroadcast(root, compileResources.MaxDrawBuffers,
+                                            &outputVariables);
+            });
         }
 
         if (success)
         {
-            DeferGlobalInitializers(root);
+            passes.runTransform("DeferGlobalInitializers",
+                                [root]() { DeferGlobalInitializers(root); });
+            passes.flush();
         }
     }
 
@@ -502,6 +580,8 @@ bool TCompiler::compile(const char *const shaderStrings[],
         compileOptions |= SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL;
     }
 
+    auto startTime = std::chrono::steady_clock::now();
+
     TScopedPoolAllocator scopedAlloc(&allocator);
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
@@ -511,13 +591,23 @@ bool TCompiler::compile(const char *const shaderStrings[],
             TIntermediate::outputTree(root, infoSink.info);
 
         if (compileOptions & SH_OBJECT_CODE)
+        {
+            TPassMeasurement measurement(
+                (compileOptions & SH_COMPILE_STATISTICS) ? &mCompileStatistics : nullptr);
             translate(root, compileOptions);
+            measurement.finish("Output");
+        }
+    }
 
-        // The IntermNode tree doesn't need to be deleted here, since the
-        // memory will be freed in a big chunk by the PoolAllocator.
-        return true;
+    if (compileOptions & SH_COMPILE_STATISTICS)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+        mCompileSeconds = elapsed.count();
     }
-    return false;
+
+    // The IntermNode tree doesn't need to be deleted here, since the
+    // memory will be freed in a big chunk by the PoolAllocator.
+    return root != nullptr;
 }
 
 bool TCompiler::InitBuiltInSymbolTable(const ShBuiltInResources &resources)
@@ -534,61 +624,15 @@ bool TCompiler::InitBuiltInSymbolTable(const ShBuiltInResources &resources)
     compileResources = resources;
     setResourceString();
 
-    assert(symbolTable.isEmpty());
-    symbolTable.push();  // COMMON_BUILTINS
-    symbolTable.push();  // ESSL1_BUILTINS
-    symbolTable.push();  // ESSL3_BUILTINS
-    symbolTable.push();  // ESSL3_1_BUILTINS
-
-    TPublicType integer;
-    integer.initializeBasicType(EbtInt);
-
-    TPublicType floatingPoint;
-    floatingPoint.initializeBasicType(EbtFloat);
-
-    switch (shaderType)
-    {
-        case GL_FRAGMENT_SHADER:
-            symbolTable.setDefaultPrecision(integer, EbpMedium);
-            break;
-        case GL_VERTEX_SHADER:
-            symbolTable.setDefaultPrecision(integer, EbpHigh);
-            symbolTable.setDefaultPrecision(floatingPoint, EbpHigh);
-            break;
-        case GL_COMPUTE_SHADER:
-            symbolTable.setDefaultPrecision(integer, EbpHigh);
-            symbolTable.setDefaultPrecision(floatingPoint, EbpHigh);
-            break;
-        default:
-            assert(false && "Language not supported");
-    }
-    // Set defaults for sampler types that have default precision, even those that are
-    // only available if an extension exists.
-    // New sampler types in ESSL3 don't have default precision. ESSL1 types do.
-    initSamplerDefaultPrecision(EbtSampler2D);
-    initSamplerDefaultPrecision(EbtSamplerCube);
-    // SamplerExternalOES is specified in the extension to have default precision.
-    initSamplerDefaultPrecision(EbtSamplerExternalOES);
-    // SamplerExternal2DY2YEXT is specified in the extension to have default precision.
-    initSamplerDefaultPrecision(EbtSamplerExternal2DY2YEXT);
-    // It isn't specified whether Sampler2DRect has default precision.
-    initSamplerDefaultPrecision(EbtSampler2DRect);
-
-    InsertBuiltInFunctions(shaderType, shaderSpec, resources, symbolTable);
-
-    IdentifyBuiltIns(shaderType, shaderSpec, resources, symbolTable);
+    // The built-in levels only depend on the shader type, the spec and the resources, so they are
+    // built once per process and shared by all compilers. Only the global level is owned here.
+    const TSymbolTable *builtIns =
+        TCache::getBuiltInSymbolTable(shaderType, shaderSpec, resources, builtInResourcesString);
+    symbolTable.shareBuiltInLevels(*builtIns);
 
     return true;
 }
 
-void TCompiler::initSamplerDefaultPrecision(TBasicType samplerType)
-{
-    ASSERT(samplerType > EbtGuardSamplerBegin && samplerType < EbtGuardSamplerEnd);
-    TPublicType sampler;
-    sampler.initializeBasicType(samplerType);
-    symbolTable.setDefaultPrecision(sampler, EbpLow);
-}
-
 void TCompiler::setResourceString()
 {
     std::ostringstream strstream;
@@ -625,6 +669,7 @@ void TCompiler::setResourceString()
         << ":MaxProgramTexelOffset:" << compileResources.MaxProgramTexelOffset
         << ":MaxDualSourceDrawBuffers:" << compileResources.MaxDualSourceDrawBuffers
         << ":NV_draw_buffers:" << compileResources.NV_draw_buffers
+        << ":OVR_multiview:" << compileResources.OVR_multiview
         << ":WEBGL_debug_shader_precision:" << compileResources.WEBGL_debug_shader_precision
         << ":MaxImageUnits:" << compileResources.MaxImageUnits
         << ":MaxVertexImageUniforms:" << compileResources.MaxVertexImageUniforms
@@ -679,6 +724,9 @@ void TCompiler::clearResults()
 
     mSourcePath     = NULL;
     mTemporaryIndex = 0;
+
+    mCompileStatistics.clear();
+    mCompileSeconds = 0.0;
 }
 
 bool TCompiler::initCallDag(TIntermNode *root)
@@ -844,6 +892,43 @@ bool TCompiler::pruneUnusedFunctions(TIntermBlock *root)
     return true;
 }
 
+bool TCompiler::optimizeTree(TIntermBlock *root, ShCompileOptions compileOptions)
+{
+    OptimizeTree(root, symbolTable, shaderVersion);
+    if (compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS)
+    {
+        return true;
+    }
+
+    // The optimization may have removed the last calls to some functions.
+    size_t statementCount = root->getSequence()->size();
+    if (!initCallDag(root))
+    {
+        return false;
+    }
+    functionMetadata.clear();
+    functionMetadata.resize(mCallDag.size());
+    if (!tagUsedFunctions() || !pruneUnusedFunctions(root))
+    {
+        return false;
+    }
+
+    // The pruned functions may have been the only ones to use some global variables.
+    if (root->getSequence()->size() < statementCount)
+    {
+        OptimizeTree(root, symbolTable, shaderVersion);
+    }
+    return true;
+}
+
+void TCompiler::markBuiltInFunctionsForEmulation(TPassManager *passes)
+{
+    std::unique_ptr<TIntermTraverser> marker = builtInFunctionEmulator.createMarker();
+    if (marker)
+        passes->addAnalysis("BuiltInFunctionEmulation", kUnaryNode | kAggregateNode,
+                            std::move(marker));
+}
+
 bool TCompiler::validateOutputs(TIntermNode *root)
 {
     ValidateOutputs validateOutputs(getExtensionBehavior(), compileResources.MaxDrawBuffers);
@@ -872,17 +957,20 @@ bool TCompiler::limitExpressionComplexity(TIntermNode *root)
     return true;
 }
 
-void TCompiler::collectVariables(TIntermNode *root)
+void TCompiler::collectVariables(TPassManager *passes)
 {
     if (!variablesCollected)
     {
-        sh::CollectVariables collect(&attributes, &outputVariables, &uniforms, &varyings,
+        std::unique_ptr<TIntermTraverser> collect(
+            new sh::CollectVariables(&attributes, &outputVariables, &uniforms, &varyings,
                                      &interfaceBlocks, hashFunction, symbolTable,
-                                     extensionBehavior);
-        root->traverse(&collect);
-
-        // This is for enforcePackingRestriction().
-        sh::ExpandUniforms(uniforms, &expandedUniforms);
+                                     extensionBehavior));
+        // The field index of an interface block access is looked at too.
+        TNodeKinds visits = kSymbolNode | kDeclarationNode | kBinaryNode | kConstantUnionNode;
+        passes->addAnalysis("CollectVariables", visits, std::move(collect), [this]() {
+            // This is for enforcePackingRestriction().
+            sh::ExpandUniforms(uniforms, &expandedUniforms);
+        });
         variablesCollected = true;
     }
 }
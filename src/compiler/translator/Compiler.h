@@ -20,6 +20,7 @@
 #include "compiler/translator/ExtensionBehavior.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/InfoSink.h"
+#include "compiler/translator/PassManager.h"
 #include "compiler/translator/Pragma.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/VariableInfo.h"
@@ -62,6 +63,7 @@ class TShHandleBase
     TShHandleBase();
     virtual ~TShHandleBase();
     virtual TCompiler *getAsCompiler() { return 0; }
+    const TPoolAllocator &getAllocator() const { return allocator; }
 #ifdef ANGLE_ENABLE_HLSL
     virtual TranslatorHLSL *getAsTranslatorHLSL() { return 0; }
 #endif  // ANGLE_ENABLE_HLSL
@@ -103,6 +105,10 @@ class TCompiler : public TShHandleBase
     bool isComputeShaderLocalSizeDeclared() const { return mComputeShaderLocalSizeDeclared; }
     const sh::WorkGroupSize &getComputeShaderLocalSize() const { return mComputeShaderLocalSize; }
     int getNumViews() const { return mNumViews; }
+    // Cost of each stage of the last compilation and its total time. Only recorded when it used
+    // SH_COMPILE_STATISTICS.
+    const std::vector<TPassStatistics> &getCompileStatistics() const { return mCompileStatistics; }
+    double getCompileSeconds() const { return mCompileSeconds; }
 
     // Clears the results from the previous compilation.
     void clearResults();
@@ -188,10 +194,8 @@ class TCompiler : public TShHandleBase
     bool tagUsedFunctions();
     void internalTagUsedFunction(size_t index);
 
-    void initSamplerDefaultPrecision(TBasicType samplerType);
-
     // Collect info for all attribs, uniforms, varyings.
-    void collectVariables(TIntermNode *root);
+    void collectVariables(TPassManager *passes);
 
     bool variablesCollected;
 
@@ -199,6 +203,13 @@ class TCompiler : public TShHandleBase
     class UnusedPredicate;
     bool pruneUnusedFunctions(TIntermBlock *root);
 
+    // Propagates constants and removes dead code, including the functions that are no longer
+    // called.
+    bool optimizeTree(TIntermBlock *root, ShCompileOptions compileOptions);
+
+    // Queues the analysis that finds the built-in functions to emulate.
+    void markBuiltInFunctionsForEmulation(TPassManager *passes);
+
     TIntermBlock *compileTreeImpl(const char *const shaderStrings[],
                                   size_t numStrings,
                                   const ShCompileOptions compileOptions);
@@ -255,6 +266,9 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     unsigned int mTemporaryIndex;
+
+    std::vector<TPassStatistics> mCompileStatistics;
+    double mCompileSeconds;
 };
 
 //
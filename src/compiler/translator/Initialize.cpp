@@ -19,6 +19,69 @@
 namespace sh
 {
 
+namespace
+{
+
+void InitSamplerDefaultPrecision(TBasicType samplerType, TSymbolTable &symbolTable)
+{
+    ASSERT(samplerType > EbtGuardSamplerBegin && samplerType < EbtGuardSamplerEnd);
+    TPublicType sampler;
+    sampler.initializeBasicType(samplerType);
+    symbolTable.setDefaultPrecision(sampler, EbpLow);
+}
+
+}  // anonymous namespace
+
+void InitializeBuiltInSymbolTable(sh::GLenum type,
+                                  ShShaderSpec spec,
+                                  const ShBuiltInResources &resources,
+                                  TSymbolTable &symbolTable)
+{
+    ASSERT(symbolTable.isEmpty());
+    symbolTable.push();  // COMMON_BUILTINS
+    symbolTable.push();  // ESSL1_BUILTINS
+    symbolTable.push();  // ESSL3_BUILTINS
+    symbolTable.push();  // ESSL3_1_BUILTINS
+
+    TPublicType integer;
+    integer.initializeBasicType(EbtInt);
+
+    TPublicType floatingPoint;
+    floatingPoint.initializeBasicType(EbtFloat);
+
+    switch (type)
+    {
+        case GL_FRAGMENT_SHADER:
+            symbolTable.setDefaultPrecision(integer, EbpMedium);
+            break;
+        case GL_VERTEX_SHADER:
+            symbolTable.setDefaultPrecision(integer, EbpHigh);
+            symbolTable.setDefaultPrecision(floatingPoint, EbpHigh);
+            break;
+        case GL_COMPUTE_SHADER:
+            symbolTable.setDefaultPrecision(integer, EbpHigh);
+            symbolTable.setDefaultPrecision(floatingPoint, EbpHigh);
+            break;
+        default:
+            assert(false && "Language not supported");
+    }
+    // Set defaults for sampler types that have default precision, even those that are
+    // only available if an extension exists.
+    // New sampler types in ESSL3 don't have default precision. ESSL1 types do.
+    InitSamplerDefaultPrecision(EbtSampler2D, symbolTable);
+    InitSamplerDefaultPrecision(EbtSamplerCube, symbolTable);
+    // SamplerExternalOES is specified in the extension to have default precision.
+    InitSamplerDefaultPrecision(EbtSamplerExternalOES, symbolTable);
+    // SamplerExternal2DY2YEXT is specified in the extension to have default precision.
+    InitSamplerDefaultPrecision(EbtSamplerExternal2DY2YEXT, symbolTable);
+    // It isn't specified whether Sampler2DRect has default precision.
+    InitSamplerDefaultPrecision(EbtSampler2DRect, symbolTable);
+
+    InsertBuiltInFunctions(type, spec, resources, symbolTable);
+
+    IdentifyBuiltIns(type, spec, resources, symbolTable);
+}
+
 void InsertBuiltInFunctions(sh::GLenum type,
                             ShShaderSpec spec,
                             const ShBuiltInResources &resources,
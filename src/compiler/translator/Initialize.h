@@ -14,6 +14,13 @@
 namespace sh
 {
 
+// Pushes the built-in levels to an empty symbol table and fills them with the default precisions,
+// functions and variables of the given shader type.
+void InitializeBuiltInSymbolTable(sh::GLenum type,
+                                  ShShaderSpec spec,
+                                  const ShBuiltInResources &resources,
+                                  TSymbolTable &symbolTable);
+
 void InsertBuiltInFunctions(sh::GLenum type,
                             ShShaderSpec spec,
                             const ShBuiltInResources &resources,
@@ -980,6 +980,10 @@ class TIntermTraverser : angle::NonCopyable
 
     int getMaxDepth() const { return mMaxDepth; }
 
+    bool hasPreVisit() const { return preVisit; }
+    bool hasInVisit() const { return inVisit; }
+    bool hasPostVisit() const { return postVisit; }
+
     // Return the original name if hash function pointer is NULL;
     // otherwise return the hashed name.
     static TString hash(const TString &name, ShHashFunction64 hashFunction);
@@ -1193,6 +1197,9 @@ class TIntermTraverser : angle::NonCopyable
     std::vector<ParentBlock> mParentBlockStack;
 
     unsigned int *mTemporaryIndex;
+
+    // Keeps the traversal context of the traversers that it runs together up to date.
+    friend class TFusedTraverser;
 };
 
 // Traverser parent class that tracks where a node is a destination of a write operation and so is
@@ -0,0 +1,588 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeTree propagates the values of variables that are initialized with a constant and never
+// written to, folds the expressions that become constant and removes the code that can't affect
+// the result of the shader.
+//
+
+#include "compiler/translator/OptimizeTree.h"
+
+#include <map>
+
+#include "compiler/translator/Diagnostics.h"
+#include "compiler/translator/InfoSink.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/Intermediate.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Every round propagates chains of constant variables completely, so another round is only needed
+// when removing code leaves a variable without writes.
+const int kMaxRounds = 8;
+
+// Variables of struct types aren't tracked, since their declaration may also define the struct.
+bool IsTrackedVariable(const TIntermSymbol *symbol)
+{
+    const TType &type = symbol->getType();
+    switch (type.getQualifier())
+    {
+        case EvqTemporary:
+        case EvqGlobal:
+        case EvqConst:
+            return type.getBasicType() != EbtStruct && !symbol->getSymbol().empty();
+        default:
+            return false;
+    }
+}
+
+bool IsBuiltInWithSideEffects(TOperator op)
+{
+    switch (op)
+    {
+        // Write to their out parameters.
+        case EOpModf:
+        case EOpFrexp:
+        case EOpUaddCarry:
+        case EOpUsubBorrow:
+        case EOpUmulExtended:
+        case EOpImulExtended:
+        // Order memory accesses between invocations.
+        case EOpBarrier:
+        case EOpMemoryBarrier:
+        case EOpMemoryBarrierAtomicCounter:
+        case EOpMemoryBarrierBuffer:
+        case EOpMemoryBarrierImage:
+        case EOpMemoryBarrierShared:
+        case EOpGroupMemoryBarrier:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Unlike TIntermTyped::hasSideEffects, treats constructors and the built-ins that have their own
+// operator as free of side effects, so that the variables initialized with them can be removed.
+// Calls are assumed to have side effects. Declarations only declare variables that are local to
+// the searched node.
+class SideEffectsTraverser : public TIntermTraverser
+{
+  public:
+    SideEffectsTraverser() : TIntermTraverser(true, false, false), mFound(false) {}
+
+    bool visitBinary(Visit, TIntermBinary *node) override { return check(node->isAssignment()); }
+    bool visitUnary(Visit, TIntermUnary *node) override { return check(node->isAssignment()); }
+    bool visitAggregate(Visit, TIntermAggregate *node) override
+    {
+        return check(node->isFunctionCall() || IsBuiltInWithSideEffects(node->getOp()));
+    }
+
+    bool found() const { return mFound; }
+
+  private:
+    bool check(bool sideEffects)
+    {
+        mFound = mFound || sideEffects;
+        return !mFound;
+    }
+
+    bool mFound;
+};
+
+bool HasSideEffects(TIntermNode *node)
+{
+    if (node == nullptr)
+    {
+        return false;
+    }
+    SideEffectsTraverser traverser;
+    node->traverse(&traverser);
+    return traverser.found();
+}
+
+bool IsEmpty(TIntermBlock *block)
+{
+    return block == nullptr || block->getSequence()->empty();
+}
+
+struct VariableUsage
+{
+    VariableUsage()
+        : declaration(nullptr),
+          declarationParent(nullptr),
+          declarator(nullptr),
+          initializer(nullptr),
+          readCount(0),
+          hasOtherWrites(false)
+    {
+    }
+
+    bool isNeverWritten() const { return stores.empty() && !hasOtherWrites; }
+
+    TIntermDeclaration *declaration;
+    // Only set when the declaration is a statement of a block, where it can be removed.
+    TIntermBlock *declarationParent;
+    TIntermNode *declarator;
+    TIntermTyped *initializer;
+
+    size_t readCount;
+    // Statements that assign to the whole variable. They are dead if the variable isn't read.
+    std::vector<std::pair<TIntermBlock *, TIntermBinary *>> stores;
+    // Compound assignments, increments, writes through indexing or swizzles and out parameters.
+    bool hasOtherWrites;
+};
+
+// Maps the symbol ids of the variables declared in the tree to their usage.
+using VariableUsageMap = std::map<int, VariableUsage>;
+
+// Finds the reads and writes of every variable, and queues the removal of the variables that are
+// never read, of the stores to them and of the statements that do nothing.
+class VariableUsageTraverser : public TLValueTrackingTraverser
+{
+  public:
+    VariableUsageTraverser(const TSymbolTable &symbolTable, int shaderVersion);
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
+    void visitSymbol(TIntermSymbol *node) override;
+    bool visitBlock(Visit visit, TIntermBlock *node) override;
+
+    // Returns true if any code is queued for removal.
+    bool removeDeadCode();
+
+    const VariableUsageMap &getVariables() const { return mVariables; }
+
+  private:
+    void removeStatement(TIntermBlock *parent, TIntermNode *statement);
+
+    VariableUsageMap mVariables;
+};
+
+VariableUsageTraverser::VariableUsageTraverser(const TSymbolTable &symbolTable, int shaderVersion)
+    : TLValueTrackingTraverser(true, false, false, symbolTable, shaderVersion)
+{
+}
+
+bool VariableUsageTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
+{
+    TIntermBlock *parentBlock = getParentNode()->getAsBlock();
+    for (TIntermNode *declarator : *node->getSequence())
+    {
+        TIntermSymbol *symbol     = declarator->getAsSymbolNode();
+        TIntermTyped *initializer = nullptr;
+        if (symbol == nullptr)
+        {
+            TIntermBinary *initNode = declarator->getAsBinaryNode();
+            ASSERT(initNode != nullptr && initNode->getOp() == EOpInitialize);
+            symbol      = initNode->getLeft()->getAsSymbolNode();
+            initializer = initNode->getRight();
+        }
+        ASSERT(symbol != nullptr);
+        if (IsTrackedVariable(symbol))
+        {
+            VariableUsage &usage    = mVariables[symbol->getId()];
+            usage.declaration       = node;
+            usage.declarationParent = parentBlock;
+            usage.declarator        = declarator;
+            usage.initializer       = initializer;
+        }
+    }
+    return true;
+}
+
+void VariableUsageTraverser::visitSymbol(TIntermSymbol *node)
+{
+    auto iter = mVariables.find(node->getId());
+    if (iter == mVariables.end())
+    {
+        return;
+    }
+
+    // Skip the declarators.
+    TIntermNode *parent         = getParentNode();
+    TIntermBinary *parentBinary = parent->getAsBinaryNode();
+    if (parent->getAsDeclarationNode() != nullptr ||
+        (parentBinary != nullptr && parentBinary->getOp() == EOpInitialize &&
+         parentBinary->getLeft() == node))
+    {
+        return;
+    }
+
+    VariableUsage &usage = iter->second;
+    if (!isLValueRequiredHere())
+    {
+        ++usage.readCount;
+        return;
+    }
+
+    TIntermNode *statementParent = getAncestorNode(1);
+    if (parentBinary != nullptr && parentBinary->getOp() == EOpAssign &&
+        parentBinary->getLeft() == node && statementParent != nullptr &&
+        statementParent->getAsBlock() != nullptr)
+    {
+        usage.stores.push_back(std::make_pair(statementParent->getAsBlock(), parentBinary));
+    }
+    else
+    {
+        usage.hasOtherWrites = true;
+    }
+}
+
+bool VariableUsageTraverser::visitBlock(Visit visit, TIntermBlock *node)
+{
+    for (TIntermNode *statement : *node->getSequence())
+    {
+        // Expression statements without side effects and empty nested blocks do nothing.
+        TIntermTyped *expression = statement->getAsTyped();
+        TIntermBlock *block      = statement->getAsBlock();
+        if ((expression != nullptr && expression->getAsFunctionPrototypeNode() == nullptr &&
+             expression->getAsRawNode() == nullptr && !HasSideEffects(expression)) ||
+            (block != nullptr && block->getSequence()->empty()))
+        {
+            removeStatement(node, statement);
+        }
+    }
+    return true;
+}
+
+bool VariableUsageTraverser::removeDeadCode()
+{
+    // The declarators to remove, grouped by their declaration.
+    std::map<TIntermDeclaration *, TIntermSequence> deadDeclarators;
+    std::map<TIntermDeclaration *, TIntermBlock *> declarationParents;
+
+    for (const auto &variable : mVariables)
+    {
+        const VariableUsage &usage = variable.second;
+        if (usage.readCount > 0 || usage.hasOtherWrites)
+        {
+            continue;
+        }
+
+        for (const auto &store : usage.stores)
+        {
+            TIntermTyped *value = store.second->getRight();
+            TIntermSequence replacements;
+            if (HasSideEffects(value))
+            {
+                replacements.push_back(value);
+            }
+            mMultiReplacements.push_back(
+                NodeReplaceWithMultipleEntry(store.first, store.second, replacements));
+        }
+
+        if (usage.declarationParent != nullptr && !HasSideEffects(usage.initializer))
+        {
+            deadDeclarators[usage.declaration].push_back(usage.declarator);
+            declarationParents[usage.declaration] = usage.declarationParent;
+        }
+    }
+
+    for (const auto &dead : deadDeclarators)
+    {
+        TIntermDeclaration *declaration = dead.first;
+        if (dead.second.size() == declaration->getSequence()->size())
+        {
+            removeStatement(declarationParents[declaration], declaration);
+            continue;
+        }
+        for (TIntermNode *declarator : dead.second)
+        {
+            mMultiReplacements.push_back(
+                NodeReplaceWithMultipleEntry(declaration, declarator, TIntermSequence()));
+        }
+    }
+
+    return !mMultiReplacements.empty();
+}
+
+void VariableUsageTraverser::removeStatement(TIntermBlock *parent, TIntermNode *statement)
+{
+    mMultiReplacements.push_back(NodeReplaceWithMultipleEntry(parent, statement, TIntermSequence()));
+}
+
+// Replaces the reads of the variables that are initialized with a constant and never written to
+// with the constant, and folds the expressions that become constant. Expressions are replaced
+// right away, so that their parent sees the folded value when it is visited after its children.
+// Statements are replaced when the tree is updated: branches and loops with a constant condition
+// are replaced by the code that runs, and statements after a jump are removed.
+class PropagateConstantsTraverser : public TIntermTraverser
+{
+  public:
+    PropagateConstantsTraverser(const VariableUsageMap &variables);
+
+    void visitSymbol(TIntermSymbol *node) override;
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+    bool visitUnary(Visit visit, TIntermUnary *node) override;
+    bool visitTernary(Visit visit, TIntermTernary *node) override;
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override;
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override;
+    bool visitLoop(Visit visit, TIntermLoop *node) override;
+    bool visitBlock(Visit visit, TIntermBlock *node) override;
+
+    bool hasChanged() const { return mChanged; }
+
+  private:
+    void replaceExpression(TIntermTyped *node, TIntermTyped *replacement);
+    void removeStatement(TIntermNode *node);
+
+    const VariableUsageMap &mVariables;
+    std::map<int, TIntermConstantUnion *> mConstants;
+
+    // Folding reports overflows and the like as warnings. Whether they are printed was already
+    // decided when the code was parsed.
+    TInfoSinkBase mDiscardedDiagnostics;
+    TDiagnostics mDiagnostics;
+    TIntermediate mIntermediate;
+
+    bool mChanged;
+};
+
+PropagateConstantsTraverser::PropagateConstantsTraverser(const VariableUsageMap &variables)
+    : TIntermTraverser(true, false, true),
+      mVariables(variables),
+      mDiagnostics(mDiscardedDiagnostics),
+      mChanged(false)
+{
+}
+
+void PropagateConstantsTraverser::visitSymbol(TIntermSymbol *node)
+{
+    auto constant = mConstants.find(node->getId());
+    if (constant == mConstants.end())
+    {
+        return;
+    }
+
+    TType type(node->getType());
+    type.setQualifier(EvqConst);
+    TIntermConstantUnion *replacement =
+        new TIntermConstantUnion(constant->second->getUnionArrayPointer(), type);
+    replacement->setLine(node->getLine());
+    replaceExpression(node, replacement);
+}
+
+bool PropagateConstantsTraverser::visitSwizzle(Visit visit, TIntermSwizzle *node)
+{
+    if (visit == PostVisit)
+    {
+        TIntermTyped *folded = node->fold();
+        if (folded)
+        {
+            replaceExpression(node, folded);
+        }
+    }
+    return true;
+}
+
+bool PropagateConstantsTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    TOperator op = node->getOp();
+    if (visit != PostVisit || node->isAssignment() || op == EOpInitialize || op == EOpComma)
+    {
+        return true;
+    }
+
+    // The right operand of a logical operator is only evaluated when the left one doesn't decide
+    // the result.
+    TIntermConstantUnion *left = node->getLeft()->getAsConstantUnion();
+    if (left != nullptr && (op == EOpLogicalAnd || op == EOpLogicalOr) &&
+        node->getRight()->getAsConstantUnion() == nullptr)
+    {
+        bool evaluatesRight = left->getBConst(0) == (op == EOpLogicalAnd);
+        replaceExpression(node, evaluatesRight ? node->getRight() : left);
+        return true;
+    }
+
+    TIntermTyped *folded = node->fold(&mDiagnostics);
+    if (folded)
+    {
+        replaceExpression(node, folded);
+    }
+    return true;
+}
+
+bool PropagateConstantsTraverser::visitUnary(Visit visit, TIntermUnary *node)
+{
+    if (visit == PostVisit && !node->isAssignment())
+    {
+        TIntermTyped *folded = node->fold(&mDiagnostics);
+        if (folded)
+        {
+            replaceExpression(node, folded);
+        }
+    }
+    return true;
+}
+
+bool PropagateConstantsTraverser::visitTernary(Visit visit, TIntermTernary *node)
+{
+    TIntermConstantUnion *condition = node->getCondition()->getAsConstantUnion();
+    if (visit == PostVisit && condition != nullptr)
+    {
+        replaceExpression(node, condition->getBConst(0) ? node->getTrueExpression()
+                                                        : node->getFalseExpression());
+    }
+    return true;
+}
+
+bool PropagateConstantsTraverser::visitAggregate(Visit visit, TIntermAggregate *node)
+{
+    if (visit == PostVisit && !node->isFunctionCall())
+    {
+        TIntermTyped *folded = mIntermediate.foldAggregateBuiltIn(node, &mDiagnostics);
+        if (folded)
+        {
+            replaceExpression(node, folded);
+        }
+    }
+    return true;
+}
+
+bool PropagateConstantsTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
+{
+    if (visit != PostVisit)
+    {
+        return true;
+    }
+
+    // The initializers have been folded already, and the later reads are visited after this.
+    for (TIntermNode *declarator : *node->getSequence())
+    {
+        TIntermBinary *initNode = declarator->getAsBinaryNode();
+        if (initNode == nullptr)
+        {
+            continue;
+        }
+        TIntermSymbol *symbol            = initNode->getLeft()->getAsSymbolNode();
+        TIntermConstantUnion *initializer = initNode->getRight()->getAsConstantUnion();
+        auto usage                        = mVariables.find(symbol->getId());
+        if (initializer != nullptr && !symbol->isArray() && usage != mVariables.end() &&
+            usage->second.isNeverWritten())
+        {
+            mConstants[symbol->getId()] = initializer;
+        }
+    }
+    return true;
+}
+
+bool PropagateConstantsTraverser::visitIfElse(Visit visit, TIntermIfElse *node)
+{
+    if (visit != PostVisit)
+    {
+        return true;
+    }
+
+    TIntermBlock *taken             = nullptr;
+    TIntermConstantUnion *condition = node->getCondition()->getAsConstantUnion();
+    if (condition != nullptr)
+    {
+        taken = condition->getBConst(0) ? node->getTrueBlock() : node->getFalseBlock();
+    }
+    else if (!IsEmpty(node->getTrueBlock()) || !IsEmpty(node->getFalseBlock()) ||
+             HasSideEffects(node->getCondition()))
+    {
+        return true;
+    }
+
+    if (IsEmpty(taken))
+    {
+        removeStatement(node);
+    }
+    else
+    {
+        // Keep the block to keep the scope of its declarations.
+        queueReplacement(node, taken, OriginalNode::IS_DROPPED);
+        mChanged = true;
+    }
+    return true;
+}
+
+bool PropagateConstantsTraverser::visitLoop(Visit visit, TIntermLoop *node)
+{
+    if (visit != PostVisit || node->getType() == ELoopDoWhile)
+    {
+        return true;
+    }
+
+    TIntermConstantUnion *condition = node->getCondition() != nullptr
+                                          ? node->getCondition()->getAsConstantUnion()
+                                          : nullptr;
+    if (condition != nullptr && !condition->getBConst(0) && !HasSideEffects(node->getInit()))
+    {
+        removeStatement(node);
+    }
+    return true;
+}
+
+bool PropagateConstantsTraverser::visitBlock(Visit visit, TIntermBlock *node)
+{
+    // Case labels make the statements after a jump in a switch reachable.
+    TIntermNode *parent = getParentNode();
+    if (visit != PreVisit || (parent != nullptr && parent->getAsSwitchNode() != nullptr))
+    {
+        return true;
+    }
+
+    // The statements after a jump are removed before they are traversed, so that nothing is
+    // queued for them.
+    TIntermSequence *statements = node->getSequence();
+    for (size_t index = 0; index + 1 < statements->size(); ++index)
+    {
+        if ((*statements)[index]->getAsBranchNode() != nullptr)
+        {
+            statements->erase(statements->begin() + index + 1, statements->end());
+            mChanged = true;
+            break;
+        }
+    }
+    return true;
+}
+
+void PropagateConstantsTraverser::replaceExpression(TIntermTyped *node, TIntermTyped *replacement)
+{
+    bool replaced = getParentNode()->replaceChildNode(node, replacement);
+    ASSERT(replaced);
+    mChanged = true;
+}
+
+void PropagateConstantsTraverser::removeStatement(TIntermNode *node)
+{
+    TIntermBlock *parentBlock = getParentNode()->getAsBlock();
+    if (parentBlock != nullptr)
+    {
+        mMultiReplacements.push_back(
+            NodeReplaceWithMultipleEntry(parentBlock, node, TIntermSequence()));
+        mChanged = true;
+    }
+}
+
+}  // anonymous namespace
+
+void OptimizeTree(TIntermBlock *root, const TSymbolTable &symbolTable, int shaderVersion)
+{
+    bool changed = true;
+    for (int round = 0; changed && round < kMaxRounds; ++round)
+    {
+        VariableUsageTraverser usage(symbolTable, shaderVersion);
+        root->traverse(&usage);
+        changed = usage.removeDeadCode();
+        usage.updateTree();
+
+        // Removing code only removes reads and writes, so the variables that weren't written to
+        // before still aren't.
+        PropagateConstantsTraverser propagate(usage.getVariables());
+        root->traverse(&propagate);
+        propagate.updateTree();
+        changed = changed || propagate.hasChanged();
+    }
+}
+
+}  // namespace sh
@@ -0,0 +1,26 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeTree propagates the values of variables that are initialized with a constant and never
+// written to, folds the expressions that become constant and removes the code that can't affect
+// the result of the shader: branches and loops with constant conditions, statements after a jump,
+// variables that are never read and the assignments to them. Removing code can leave more
+// variables unread or unwritten, so it repeats until the tree doesn't change any more.
+//
+// Unused functions aren't removed here since that needs the call graph of the shader.
+//
+
+#ifndef COMPILER_TRANSLATOR_OPTIMIZETREE_H_
+#define COMPILER_TRANSLATOR_OPTIMIZETREE_H_
+
+namespace sh
+{
+class TIntermBlock;
+class TSymbolTable;
+
+void OptimizeTree(TIntermBlock *root, const TSymbolTable &symbolTable, int shaderVersion);
+}
+
+#endif  // COMPILER_TRANSLATOR_OPTIMIZETREE_H_
@@ -10,6 +10,7 @@
 #include "common/mathutil.h"
 
 #include <cfloat>
+#include <cmath>
 
 namespace sh
 {
@@ -114,6 +115,237 @@ TInfoSinkBase &operator<<(TInfoSinkBase &out, CommaSeparatedListItemPrefixGenera
     return out;
 }
 
+// Precedence of the operators as listed in the ESSL 3.00 spec section 5.1, from the one that binds
+// the tightest. Primary expressions are treated as postfix expressions.
+enum Precedence
+{
+    PrecedencePostfix = 2,
+    PrecedenceUnary,
+    PrecedenceMultiplicative,
+    PrecedenceAdditive,
+    PrecedenceShift,
+    PrecedenceRelational,
+    PrecedenceEquality,
+    PrecedenceBitwiseAnd,
+    PrecedenceBitwiseXor,
+    PrecedenceBitwiseOr,
+    PrecedenceLogicalAnd,
+    PrecedenceLogicalXor,
+    PrecedenceLogicalOr,
+    PrecedenceTernary,
+    PrecedenceAssignment,
+    PrecedenceComma
+};
+
+bool IsPrefixOperator(TOperator op)
+{
+    switch (op)
+    {
+        case EOpNegative:
+        case EOpPositive:
+        case EOpLogicalNot:
+        case EOpBitwiseNot:
+        case EOpPreIncrement:
+        case EOpPreDecrement:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool IsNegativeScalar(const TIntermConstantUnion *node)
+{
+    if (node->getType().getObjectSize() != 1)
+    {
+        return false;
+    }
+    switch (node->getBasicType())
+    {
+        case EbtFloat:
+            return std::signbit(node->getFConst(0));
+        case EbtInt:
+            return node->getIConst(0) < 0;
+        default:
+            return false;
+    }
+}
+
+Precedence GetPrecedence(TIntermTyped *node)
+{
+    TIntermBinary *binary = node->getAsBinaryNode();
+    if (binary != nullptr)
+    {
+        if (binary->isAssignment())
+        {
+            return PrecedenceAssignment;
+        }
+        switch (binary->getOp())
+        {
+            case EOpComma:
+                return PrecedenceComma;
+            case EOpMul:
+            case EOpDiv:
+            case EOpIMod:
+            case EOpVectorTimesScalar:
+            case EOpVectorTimesMatrix:
+            case EOpMatrixTimesVector:
+            case EOpMatrixTimesScalar:
+            case EOpMatrixTimesMatrix:
+                return PrecedenceMultiplicative;
+            case EOpAdd:
+            case EOpSub:
+                return PrecedenceAdditive;
+            case EOpBitShiftLeft:
+            case EOpBitShiftRight:
+                return PrecedenceShift;
+            case EOpLessThan:
+            case EOpGreaterThan:
+            case EOpLessThanEqual:
+            case EOpGreaterThanEqual:
+                return PrecedenceRelational;
+            case EOpEqual:
+            case EOpNotEqual:
+                return PrecedenceEquality;
+            case EOpBitwiseAnd:
+                return PrecedenceBitwiseAnd;
+            case EOpBitwiseXor:
+                return PrecedenceBitwiseXor;
+            case EOpBitwiseOr:
+                return PrecedenceBitwiseOr;
+            case EOpLogicalAnd:
+                return PrecedenceLogicalAnd;
+            case EOpLogicalXor:
+                return PrecedenceLogicalXor;
+            case EOpLogicalOr:
+                return PrecedenceLogicalOr;
+            default:
+                return PrecedencePostfix;
+        }
+    }
+
+    TIntermUnary *unary = node->getAsUnaryNode();
+    if (unary != nullptr && IsPrefixOperator(unary->getOp()))
+    {
+        return PrecedenceUnary;
+    }
+    if (node->getAsTernaryNode() != nullptr)
+    {
+        return PrecedenceTernary;
+    }
+    // Negative constants are written with a minus sign.
+    TIntermConstantUnion *constant = node->getAsConstantUnion();
+    if (constant != nullptr && IsNegativeScalar(constant))
+    {
+        return PrecedenceUnary;
+    }
+    return PrecedencePostfix;
+}
+
+// Removes the parentheses and spaces around an operator.
+TString StripOperator(const char *str)
+{
+    TString stripped;
+    for (; str != nullptr && *str != '\0'; ++str)
+    {
+        if (*str != '(' && *str != ')' && *str != ' ')
+        {
+            stripped += *str;
+        }
+    }
+    return stripped;
+}
+
+// Variables of the same type that aren't part of the interface of the shader can be declared in
+// one statement, unless the declaration also declares a struct.
+bool CanMergeDeclarations(const TType &first, const TType &second)
+{
+    switch (first.getQualifier())
+    {
+        case EvqTemporary:
+        case EvqGlobal:
+        case EvqConst:
+            break;
+        default:
+            return false;
+    }
+    if (first.getBasicType() == EbtStruct || IsOpaqueType(first.getBasicType()))
+    {
+        return false;
+    }
+    return first.getBasicType() == second.getBasicType() &&
+           first.getQualifier() == second.getQualifier() &&
+           first.getPrecision() == second.getPrecision() &&
+           first.getNominalSize() == second.getNominalSize() &&
+           first.getSecondarySize() == second.getSecondarySize() &&
+           first.isInvariant() == second.isInvariant();
+}
+
+// Collects the names starting with an underscore, which the minified names could collide with.
+class UnderscoreNameCollector : public TIntermTraverser
+{
+  public:
+    UnderscoreNameCollector(std::set<TString> *names)
+        : TIntermTraverser(true, false, false), mNames(names)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        addName(node->getSymbol());
+        addTypeNames(node->getType());
+    }
+
+    bool visitFunctionPrototype(Visit visit, TIntermFunctionPrototype *node) override
+    {
+        addName(node->getFunctionSymbolInfo()->getName());
+        addTypeNames(node->getType());
+        return true;
+    }
+
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        if (node->isFunctionCall())
+        {
+            addName(node->getFunctionSymbolInfo()->getName());
+        }
+        addTypeNames(node->getType());
+        return true;
+    }
+
+  private:
+    void addName(const TString &name)
+    {
+        if (!name.empty() && name[0] == '_')
+        {
+            mNames->insert(name);
+        }
+    }
+
+    void addFieldNames(const TFieldListCollection *collection)
+    {
+        addName(collection->name());
+        for (const TField *field : collection->fields())
+        {
+            addName(field->name());
+            addTypeNames(*field->type());
+        }
+    }
+
+    void addTypeNames(const TType &type)
+    {
+        if (type.getStruct() != nullptr)
+        {
+            addFieldNames(type.getStruct());
+        }
+        if (type.getInterfaceBlock() != nullptr)
+        {
+            addFieldNames(type.getInterfaceBlock());
+        }
+    }
+
+    std::set<TString> *mNames;
+};
+
 }  // namespace
 
 TOutputGLSLBase::TOutputGLSLBase(TInfoSinkBase &objSink,
@@ -135,7 +367,10 @@ TOutputGLSLBase::TOutputGLSLBase(TInfoSinkBase &objSink,
       mShaderType(shaderType),
       mShaderVersion(shaderVersion),
       mOutput(output),
-      mCompileOptions(compileOptions)
+      mCompileOptions(compileOptions),
+      mMinify((compileOptions & SH_MINIFY_OUTPUT) != 0),
+      mMergingDeclaration(false),
+      mNextMinifiedName(0)
 {
 }
 
@@ -156,6 +391,10 @@ void TOutputGLSLBase::writeFloat(TInfoSinkBase &out, float f)
     }
     else
     {
+        if (std::signbit(f))
+        {
+            separateSign('-');
+        }
         out << std::min(FLT_MAX, std::max(-FLT_MAX, f));
     }
 }
@@ -174,6 +413,133 @@ void TOutputGLSLBase::writeTriplet(Visit visit,
         out << postStr;
 }
 
+void TOutputGLSLBase::writeOperatorTriplet(Visit visit,
+                                           TIntermTyped *node,
+                                           const char *preStr,
+                                           const char *inStr,
+                                           const char *postStr)
+{
+    if (!mMinify)
+    {
+        writeTriplet(visit, preStr, inStr, postStr);
+        return;
+    }
+
+    TInfoSinkBase &out = objSink();
+    if (visit == PreVisit)
+    {
+        bool parenthesize = needsParentheses(node);
+        TString op        = StripOperator(preStr);
+        if (parenthesize)
+        {
+            out << "(";
+        }
+        else if (!op.empty())
+        {
+            separateSign(op[0]);
+        }
+        out << op;
+    }
+    else if (visit == InVisit)
+    {
+        out << StripOperator(inStr);
+    }
+    else
+    {
+        out << StripOperator(postStr);
+        if (needsParentheses(node))
+        {
+            out << ")";
+        }
+    }
+}
+
+bool TOutputGLSLBase::needsParentheses(TIntermTyped *node)
+{
+    TIntermNode *parent = getParentNode();
+    if (parent == nullptr)
+    {
+        return false;
+    }
+    Precedence precedence = GetPrecedence(node);
+
+    TIntermBinary *parentBinary = parent->getAsBinaryNode();
+    if (parentBinary != nullptr)
+    {
+        switch (parentBinary->getOp())
+        {
+            case EOpInitialize:
+                return precedence == PrecedenceComma;
+            case EOpIndexDirect:
+            case EOpIndexIndirect:
+            case EOpIndexDirectStruct:
+            case EOpIndexDirectInterfaceBlock:
+                // The index is written in brackets.
+                return node == parentBinary->getLeft() && precedence > PrecedencePostfix;
+            default:
+                break;
+        }
+        Precedence parentPrecedence = GetPrecedence(parentBinary);
+        if (precedence != parentPrecedence)
+        {
+            return precedence > parentPrecedence;
+        }
+        // Assignments group right to left, the other binary operators left to right.
+        return parentBinary->isAssignment() ? node == parentBinary->getLeft()
+                                            : node == parentBinary->getRight();
+    }
+
+    TIntermUnary *parentUnary = parent->getAsUnaryNode();
+    if (parentUnary != nullptr)
+    {
+        switch (parentUnary->getOp())
+        {
+            case EOpPostIncrement:
+            case EOpPostDecrement:
+                return precedence > PrecedencePostfix;
+            default:
+                break;
+        }
+        // Nested prefix operators are parenthesized so that they aren't read as one operator.
+        if (IsPrefixOperator(parentUnary->getOp()))
+        {
+            return precedence >= PrecedenceUnary;
+        }
+        // Built-in functions take their argument in parentheses.
+        return precedence == PrecedenceComma;
+    }
+
+    TIntermTernary *parentTernary = parent->getAsTernaryNode();
+    if (parentTernary != nullptr)
+    {
+        if (node == parentTernary->getCondition())
+        {
+            return precedence >= PrecedenceTernary;
+        }
+        return precedence == PrecedenceComma;
+    }
+
+    if (parent->getAsSwizzleNode() != nullptr)
+    {
+        return precedence > PrecedencePostfix;
+    }
+    if (parent->getAsAggregate() != nullptr)
+    {
+        return precedence == PrecedenceComma;
+    }
+    // Statements and the conditions of control flow don't need parentheses.
+    return false;
+}
+
+void TOutputGLSLBase::separateSign(char sign)
+{
+    const TPersistString &written = objSink().str();
+    if (mMinify && (sign == '-' || sign == '+') && !written.empty() && written.back() == sign)
+    {
+        objSink() << " ";
+    }
+}
+
 void TOutputGLSLBase::writeBuiltInFunctionTriplet(Visit visit,
                                                   TOperator op,
                                                   bool useEmulatedFunction)
@@ -194,7 +560,7 @@ void TOutputGLSLBase::writeBuiltInFunctionTriplet(Visit visit,
     }
     else
     {
-        writeTriplet(visit, nullptr, ", ", ")");
+        writeTriplet(visit, nullptr, listSeparator(), ")");
     }
 }
 
@@ -374,13 +740,16 @@ void TOutputGLSLBase::writeFunctionParameters(const TIntermSequence &args)
         writeVariableType(type);
 
         if (!arg->getName().getString().empty())
-            out << " " << hashName(arg->getName());
+        {
+            const TName &name = arg->getName();
+            out << " " << (isMinifiedVariable(arg) ? minifyName(name) : hashName(name));
+        }
         if (type.isArray())
             out << arrayBrackets(type);
 
         // Put a comma if this is not the last argument.
         if (iter != args.end() - 1)
-            out << ", ";
+            out << listSeparator();
     }
 }
 
@@ -401,7 +770,7 @@ const TConstantUnion *TOutputGLSLBase::writeConstantUnion(const TType &type,
             ASSERT(fieldType != NULL);
             pConstUnion = writeConstantUnion(*fieldType, pConstUnion);
             if (i != fields.size() - 1)
-                out << ", ";
+                out << listSeparator();
         }
         out << ")";
     }
@@ -419,6 +788,10 @@ const TConstantUnion *TOutputGLSLBase::writeConstantUnion(const TType &type,
                     writeFloat(out, pConstUnion->getFConst());
                     break;
                 case EbtInt:
+                    if (pConstUnion->getIConst() < 0)
+                    {
+                        separateSign('-');
+                    }
                     out << pConstUnion->getIConst();
                     break;
                 case EbtUInt:
@@ -434,7 +807,7 @@ const TConstantUnion *TOutputGLSLBase::writeConstantUnion(const TType &type,
                     UNREACHABLE();
             }
             if (i != size - 1)
-                out << ", ";
+                out << listSeparator();
         }
         if (writeType)
             out << ")";
@@ -460,14 +833,17 @@ void TOutputGLSLBase::writeConstructorTriplet(Visit visit, const TType &type)
     }
     else
     {
-        writeTriplet(visit, nullptr, ", ", ")");
+        writeTriplet(visit, nullptr, listSeparator(), ")");
     }
 }
 
 void TOutputGLSLBase::visitSymbol(TIntermSymbol *node)
 {
     TInfoSinkBase &out = objSink();
-    out << hashVariableName(node->getName());
+    if (isMinifiedVariable(node))
+        out << minifyName(node->getName());
+    else
+        out << hashVariableName(node->getName());
 
     if (mDeclaringVariables && node->getType().isArray())
         out << arrayBrackets(node->getType());
@@ -475,7 +851,13 @@ void TOutputGLSLBase::visitSymbol(TIntermSymbol *node)
 
 void TOutputGLSLBase::visitConstantUnion(TIntermConstantUnion *node)
 {
+    TInfoSinkBase &out = objSink();
+    bool parenthesize  = mMinify && IsNegativeScalar(node) && needsParentheses(node);
+    if (parenthesize)
+        out << "(";
     writeConstantUnion(node->getType(), node->getUnionArrayPointer());
+    if (parenthesize)
+        out << ")";
 }
 
 bool TOutputGLSLBase::visitSwizzle(Visit visit, TIntermSwizzle *node)
@@ -496,30 +878,30 @@ bool TOutputGLSLBase::visitBinary(Visit visit, TIntermBinary *node)
     switch (node->getOp())
     {
         case EOpComma:
-            writeTriplet(visit, "(", ", ", ")");
+            writeOperatorTriplet(visit, node, "(", ", ", ")");
             break;
         case EOpInitialize:
             if (visit == InVisit)
             {
-                out << " = ";
+                out << (mMinify ? "=" : " = ");
                 // RHS of initialize is not being declared.
                 mDeclaringVariables = false;
             }
             break;
         case EOpAssign:
-            writeTriplet(visit, "(", " = ", ")");
+            writeOperatorTriplet(visit, node, "(", " = ", ")");
             break;
         case EOpAddAssign:
-            writeTriplet(visit, "(", " += ", ")");
+            writeOperatorTriplet(visit, node, "(", " += ", ")");
             break;
         case EOpSubAssign:
-            writeTriplet(visit, "(", " -= ", ")");
+            writeOperatorTriplet(visit, node, "(", " -= ", ")");
             break;
         case EOpDivAssign:
-            writeTriplet(visit, "(", " /= ", ")");
+            writeOperatorTriplet(visit, node, "(", " /= ", ")");
             break;
         case EOpIModAssign:
-            writeTriplet(visit, "(", " %= ", ")");
+            writeOperatorTriplet(visit, node, "(", " %= ", ")");
             break;
         // Notice the fall-through.
         case EOpMulAssign:
@@ -527,22 +909,22 @@ bool TOutputGLSLBase::visitBinary(Visit visit, TIntermBinary *node)
         case EOpVectorTimesScalarAssign:
         case EOpMatrixTimesScalarAssign:
         case EOpMatrixTimesMatrixAssign:
-            writeTriplet(visit, "(", " *= ", ")");
+            writeOperatorTriplet(visit, node, "(", " *= ", ")");
             break;
         case EOpBitShiftLeftAssign:
-            writeTriplet(visit, "(", " <<= ", ")");
+            writeOperatorTriplet(visit, node, "(", " <<= ", ")");
             break;
         case EOpBitShiftRightAssign:
-            writeTriplet(visit, "(", " >>= ", ")");
+            writeOperatorTriplet(visit, node, "(", " >>= ", ")");
             break;
         case EOpBitwiseAndAssign:
-            writeTriplet(visit, "(", " &= ", ")");
+            writeOperatorTriplet(visit, node, "(", " &= ", ")");
             break;
         case EOpBitwiseXorAssign:
-            writeTriplet(visit, "(", " ^= ", ")");
+            writeOperatorTriplet(visit, node, "(", " ^= ", ")");
             break;
         case EOpBitwiseOrAssign:
-            writeTriplet(visit, "(", " |= ", ")");
+            writeOperatorTriplet(visit, node, "(", " |= ", ")");
             break;
 
         case EOpIndexDirect:
@@ -625,53 +1007,53 @@ bool TOutputGLSLBase::visitBinary(Visit visit, TIntermBinary *node)
             break;
 
         case EOpAdd:
-            writeTriplet(visit, "(", " + ", ")");
+            writeOperatorTriplet(visit, node, "(", " + ", ")");
             break;
         case EOpSub:
-            writeTriplet(visit, "(", " - ", ")");
+            writeOperatorTriplet(visit, node, "(", " - ", ")");
             break;
         case EOpMul:
-            writeTriplet(visit, "(", " * ", ")");
+            writeOperatorTriplet(visit, node, "(", " * ", ")");
             break;
         case EOpDiv:
-            writeTriplet(visit, "(", " / ", ")");
+            writeOperatorTriplet(visit, node, "(", " / ", ")");
             break;
         case EOpIMod:
-            writeTriplet(visit, "(", " % ", ")");
+            writeOperatorTriplet(visit, node, "(", " % ", ")");
             break;
         case EOpBitShiftLeft:
-            writeTriplet(visit, "(", " << ", ")");
+            writeOperatorTriplet(visit, node, "(", " << ", ")");
             break;
         case EOpBitShiftRight:
-            writeTriplet(visit, "(", " >> ", ")");
+            writeOperatorTriplet(visit, node, "(", " >> ", ")");
             break;
         case EOpBitwiseAnd:
-            writeTriplet(visit, "(", " & ", ")");
+            writeOperatorTriplet(visit, node, "(", " & ", ")");
             break;
         case EOpBitwiseXor:
-            writeTriplet(visit, "(", " ^ ", ")");
+            writeOperatorTriplet(visit, node, "(", " ^ ", ")");
             break;
         case EOpBitwiseOr:
-            writeTriplet(visit, "(", " | ", ")");
+            writeOperatorTriplet(visit, node, "(", " | ", ")");
             break;
 
         case EOpEqual:
-            writeTriplet(visit, "(", " == ", ")");
+            writeOperatorTriplet(visit, node, "(", " == ", ")");
             break;
         case EOpNotEqual:
-            writeTriplet(visit, "(", " != ", ")");
+            writeOperatorTriplet(visit, node, "(", " != ", ")");
             break;
         case EOpLessThan:
-            writeTriplet(visit, "(", " < ", ")");
+            writeOperatorTriplet(visit, node, "(", " < ", ")");
             break;
         case EOpGreaterThan:
-            writeTriplet(visit, "(", " > ", ")");
+            writeOperatorTriplet(visit, node, "(", " > ", ")");
             break;
         case EOpLessThanEqual:
-            writeTriplet(visit, "(", " <= ", ")");
+            writeOperatorTriplet(visit, node, "(", " <= ", ")");
             break;
         case EOpGreaterThanEqual:
-            writeTriplet(visit, "(", " >= ", ")");
+            writeOperatorTriplet(visit, node, "(", " >= ", ")");
             break;
 
         // Notice the fall-through.
@@ -680,17 +1062,17 @@ bool TOutputGLSLBase::visitBinary(Visit visit, TIntermBinary *node)
         case EOpMatrixTimesVector:
         case EOpMatrixTimesScalar:
         case EOpMatrixTimesMatrix:
-            writeTriplet(visit, "(", " * ", ")");
+            writeOperatorTriplet(visit, node, "(", " * ", ")");
             break;
 
         case EOpLogicalOr:
-            writeTriplet(visit, "(", " || ", ")");
+            writeOperatorTriplet(visit, node, "(", " || ", ")");
             break;
         case EOpLogicalXor:
-            writeTriplet(visit, "(", " ^^ ", ")");
+            writeOperatorTriplet(visit, node, "(", " ^^ ", ")");
             break;
         case EOpLogicalAnd:
-            writeTriplet(visit, "(", " && ", ")");
+            writeOperatorTriplet(visit, node, "(", " && ", ")");
             break;
         default:
             UNREACHABLE();
@@ -799,7 +1181,7 @@ bool TOutputGLSLBase::visitUnary(Visit visit, TIntermUnary *node)
             UNREACHABLE();
     }
 
-    writeTriplet(visit, preString.c_str(), NULL, postString.c_str());
+    writeOperatorTriplet(visit, node, preString.c_str(), NULL, postString.c_str());
 
     return true;
 }
@@ -807,6 +1189,21 @@ bool TOutputGLSLBase::visitUnary(Visit visit, TIntermUnary *node)
 bool TOutputGLSLBase::visitTernary(Visit visit, TIntermTernary *node)
 {
     TInfoSinkBase &out = objSink();
+    if (mMinify)
+    {
+        bool parenthesize = needsParentheses(node);
+        if (parenthesize)
+            out << "(";
+        node->getCondition()->traverse(this);
+        out << "?";
+        node->getTrueExpression()->traverse(this);
+        out << ":";
+        node->getFalseExpression()->traverse(this);
+        if (parenthesize)
+            out << ")";
+        return false;
+    }
+
     // Notice two brackets at the beginning and end. The outer ones
     // encapsulate the whole ternary expression. This preserves the
     // order of precedence when ternary expressions are used in a
@@ -825,15 +1222,15 @@ bool TOutputGLSLBase::visitIfElse(Visit visit, TIntermIfElse *node)
 {
     TInfoSinkBase &out = objSink();
 
-    out << "if (";
+    out << (mMinify ? "if(" : "if (");
     node->getCondition()->traverse(this);
-    out << ")\n";
+    out << (mMinify ? ")" : ")\n");
 
     visitCodeBlock(node->getTrueBlock());
 
     if (node->getFalseBlock())
     {
-        out << "else\n";
+        out << (mMinify ? "else" : "else\n");
         visitCodeBlock(node->getFalseBlock());
     }
     return false;
@@ -843,13 +1240,14 @@ bool TOutputGLSLBase::visitSwitch(Visit visit, TIntermSwitch *node)
 {
     if (node->getStatementList())
     {
-        writeTriplet(visit, "switch (", ") ", nullptr);
+        writeTriplet(visit, mMinify ? "switch(" : "switch (", mMinify ? ")" : ") ", nullptr);
         // The curly braces get written when visiting the statementList aggregate
     }
     else
     {
         // No statementList, so it won't output curly braces
-        writeTriplet(visit, "switch (", ") {", "}\n");
+        writeTriplet(visit, mMinify ? "switch(" : "switch (", mMinify ? "){" : ") {",
+                     mMinify ? "}" : "}\n");
     }
     return true;
 }
@@ -858,13 +1256,13 @@ bool TOutputGLSLBase::visitCase(Visit visit, TIntermCase *node)
 {
     if (node->hasCondition())
     {
-        writeTriplet(visit, "case (", nullptr, "):\n");
+        writeTriplet(visit, mMinify ? "case(" : "case (", nullptr, mMinify ? "):" : "):\n");
         return true;
     }
     else
     {
         TInfoSinkBase &out = objSink();
-        out << "default:\n";
+        out << (mMinify ? "default:" : "default:\n");
         return false;
     }
 }
@@ -875,24 +1273,49 @@ bool TOutputGLSLBase::visitBlock(Visit visit, TIntermBlock *node)
     // Scope the blocks except when at the global scope.
     if (mDepth > 0)
     {
-        out << "{\n";
+        out << (mMinify ? "{" : "{\n");
+    }
+    else if (mMinify)
+    {
+        UnderscoreNameCollector collector(&mUsedUnderscoreNames);
+        node->traverse(&collector);
     }
 
+    // The semicolon after a statement is written when the next statement doesn't continue its
+    // declaration.
+    const char *statementEnd                = mMinify ? ";" : ";\n";
+    bool needsStatementEnd                  = false;
+    TIntermDeclaration *previousDeclaration = nullptr;
     for (TIntermSequence::const_iterator iter = node->getSequence()->begin();
          iter != node->getSequence()->end(); ++iter)
     {
         TIntermNode *curNode = *iter;
         ASSERT(curNode != nullptr);
+
+        TIntermDeclaration *declaration = curNode->getAsDeclarationNode();
+        mMergingDeclaration             = false;
+        if (mMinify && declaration != nullptr && previousDeclaration != nullptr)
+        {
+            const TType &previousType =
+                previousDeclaration->getSequence()->front()->getAsTyped()->getType();
+            const TType &type   = declaration->getSequence()->front()->getAsTyped()->getType();
+            mMergingDeclaration = CanMergeDeclarations(previousType, type);
+        }
+        if (needsStatementEnd && !mMergingDeclaration)
+            out << statementEnd;
+
         curNode->traverse(this);
 
-        if (isSingleStatement(curNode))
-            out << ";\n";
+        needsStatementEnd   = isSingleStatement(curNode);
+        previousDeclaration = declaration;
     }
+    if (needsStatementEnd)
+        out << statementEnd;
 
     // Scope the blocks except when at the global scope.
     if (mDepth > 0)
     {
-        out << "}\n";
+        out << (mMinify ? "}" : "}\n");
     }
     return false;
 }
@@ -958,7 +1381,7 @@ bool TOutputGLSLBase::visitAggregate(Visit visit, TIntermAggregate *node)
                 out << "(";
             }
             else if (visit == InVisit)
-                out << ", ";
+                out << listSeparator();
             else
                 out << ")";
             break;
@@ -1043,7 +1466,14 @@ bool TOutputGLSLBase::visitDeclaration(Visit visit, TIntermDeclaration *node)
     TInfoSinkBase &out = objSink();
 
     // Variable declaration.
-    if (visit == PreVisit)
+    if (visit == PreVisit && mMergingDeclaration)
+    {
+        // The declarators are added to the previous declaration.
+        out << ",";
+        mMergingDeclaration = false;
+        mDeclaringVariables = true;
+    }
+    else if (visit == PreVisit)
     {
         const TIntermSequence &sequence = *(node->getSequence());
         const TIntermTyped *variable    = sequence.front()->getAsTyped();
@@ -1054,7 +1484,7 @@ bool TOutputGLSLBase::visitDeclaration(Visit visit, TIntermDeclaration *node)
     }
     else if (visit == InVisit)
     {
-        out << ", ";
+        out << listSeparator();
         mDeclaringVariables = true;
     }
     else
@@ -1072,41 +1502,41 @@ bool TOutputGLSLBase::visitLoop(Visit visit, TIntermLoop *node)
 
     if (loopType == ELoopFor)  // for loop
     {
-        out << "for (";
+        out << (mMinify ? "for(" : "for (");
         if (node->getInit())
             node->getInit()->traverse(this);
-        out << "; ";
+        out << (mMinify ? ";" : "; ");
 
         if (node->getCondition())
             node->getCondition()->traverse(this);
-        out << "; ";
+        out << (mMinify ? ";" : "; ");
 
         if (node->getExpression())
             node->getExpression()->traverse(this);
-        out << ")\n";
+        out << (mMinify ? ")" : ")\n");
 
         visitCodeBlock(node->getBody());
     }
     else if (loopType == ELoopWhile)  // while loop
     {
-        out << "while (";
+        out << (mMinify ? "while(" : "while (");
         ASSERT(node->getCondition() != NULL);
         node->getCondition()->traverse(this);
-        out << ")\n";
+        out << (mMinify ? ")" : ")\n");
 
         visitCodeBlock(node->getBody());
     }
     else  // do-while loop
     {
         ASSERT(loopType == ELoopDoWhile);
-        out << "do\n";
+        out << (mMinify ? "do" : "do\n");
 
         visitCodeBlock(node->getBody());
 
-        out << "while (";
+        out << (mMinify ? "while(" : "while (");
         ASSERT(node->getCondition() != NULL);
         node->getCondition()->traverse(this);
-        out << ");\n";
+        out << (mMinify ? ");" : ");\n");
     }
 
     // No need to visit children. They have been already processed in
@@ -1146,11 +1576,11 @@ void TOutputGLSLBase::visitCodeBlock(TIntermBlock *node)
         // Single statements not part of a sequence need to be terminated
         // with semi-colon.
         if (isSingleStatement(node))
-            out << ";\n";
+            out << (mMinify ? ";" : ";\n");
     }
     else
     {
-        out << "{\n}\n";  // Empty code block.
+        out << (mMinify ? "{}" : "{\n}\n");  // Empty code block.
     }
 }
 
@@ -1214,12 +1644,71 @@ TString TOutputGLSLBase::hashFunctionNameIfNeeded(const TFunctionSymbolInfo &inf
         // to the output shader source that are not included in the AST at all.
         return info.getName();
     }
+    else if (mMinify)
+    {
+        return minifyName(info.getNameObj());
+    }
     else
     {
         return hashName(info.getNameObj());
     }
 }
 
+bool TOutputGLSLBase::isMinifiedVariable(const TIntermSymbol *symbol)
+{
+    if (!mMinify || symbol->getName().isInternal() || symbol->getSymbol().empty())
+    {
+        return false;
+    }
+    // Variables that are part of the interface of the shader keep their names, so that they match
+    // the other stages and the reflection info.
+    switch (symbol->getQualifier())
+    {
+        case EvqTemporary:
+        case EvqGlobal:
+        case EvqConst:
+        case EvqIn:
+        case EvqOut:
+        case EvqInOut:
+        case EvqConstReadOnly:
+            break;
+        default:
+            return false;
+    }
+    return mSymbolTable.findBuiltIn(symbol->getSymbol(), mShaderVersion) == nullptr;
+}
+
+TString TOutputGLSLBase::minifyName(const TName &name)
+{
+    // Variables with the same name in different scopes keep the same name, so renaming doesn't
+    // change which variable a name refers to.
+    auto minified = mMinifiedNames.find(name.getString());
+    if (minified != mMinifiedNames.end())
+    {
+        return minified->second;
+    }
+
+    // The names are assigned in the order they are written, so they are the same for every
+    // compile of the same shader.
+    static const char kNameCharacters[] =
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    const size_t kNameCharacterCount = sizeof(kNameCharacters) - 1;
+    TString shortName;
+    do
+    {
+        shortName        = "_";
+        size_t nameIndex = mNextMinifiedName++;
+        do
+        {
+            shortName += kNameCharacters[nameIndex % kNameCharacterCount];
+            nameIndex /= kNameCharacterCount;
+        } while (nameIndex > 0);
+    } while (mUsedUnderscoreNames.count(shortName) > 0);
+
+    mMinifiedNames[name.getString()] = shortName;
+    return shortName;
+}
+
 bool TOutputGLSLBase::structDeclared(const TStructure *structure) const
 {
     ASSERT(structure);
@@ -1235,7 +1724,7 @@ void TOutputGLSLBase::declareStruct(const TStructure *structure)
 {
     TInfoSinkBase &out = objSink();
 
-    out << "struct " << hashName(TName(structure->name())) << "{\n";
+    out << "struct " << hashName(TName(structure->name())) << (mMinify ? "{" : "{\n");
     const TFieldList &fields = structure->fields();
     for (size_t i = 0; i < fields.size(); ++i)
     {
@@ -1245,7 +1734,7 @@ void TOutputGLSLBase::declareStruct(const TStructure *structure)
         out << getTypeName(*field->type()) << " " << hashName(TName(field->name()));
         if (field->type()->isArray())
             out << arrayBrackets(*field->type());
-        out << ";\n";
+        out << (mMinify ? ";" : ";\n");
     }
     out << "}";
 }
@@ -1303,7 +1792,7 @@ void TOutputGLSLBase::declareInterfaceBlock(const TInterfaceBlock *interfaceBloc
 {
     TInfoSinkBase &out = objSink();
 
-    out << hashName(TName(interfaceBlock->name())) << "{\n";
+    out << hashName(TName(interfaceBlock->name())) << (mMinify ? "{" : "{\n");
     const TFieldList &fields = interfaceBlock->fields();
     for (size_t i = 0; i < fields.size(); ++i)
     {
@@ -1313,7 +1802,7 @@ void TOutputGLSLBase::declareInterfaceBlock(const TInterfaceBlock *interfaceBloc
         out << getTypeName(*field->type()) << " " << hashName(TName(field->name()));
         if (field->type()->isArray())
             out << arrayBrackets(*field->type());
-        out << ";\n";
+        out << (mMinify ? ";" : ";\n");
     }
     out << "}";
 }
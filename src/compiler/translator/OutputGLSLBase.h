@@ -7,6 +7,7 @@
 #ifndef COMPILER_TRANSLATOR_OUTPUTGLSLBASE_H_
 #define COMPILER_TRANSLATOR_OUTPUTGLSLBASE_H_
 
+#include <map>
 #include <set>
 
 #include "compiler/translator/IntermNode.h"
@@ -39,6 +40,13 @@ class TOutputGLSLBase : public TIntermTraverser
     TInfoSinkBase &objSink() { return mObjSink; }
     void writeFloat(TInfoSinkBase &out, float f);
     void writeTriplet(Visit visit, const char *preStr, const char *inStr, const char *postStr);
+    // Same as writeTriplet(), but for the operators that are written with parentheses around the
+    // whole expression. Minified output only keeps the parentheses that precedence needs.
+    void writeOperatorTriplet(Visit visit,
+                              TIntermTyped *node,
+                              const char *preStr,
+                              const char *inStr,
+                              const char *postStr);
     virtual void writeLayoutQualifier(const TType &type);
     void writeInvariantQualifier(const TType &type);
     void writeVariableType(const TType &type);
@@ -86,6 +94,18 @@ class TOutputGLSLBase : public TIntermTraverser
 
     const char *mapQualifierToString(TQualifier qialifier);
 
+    // Returns a short name for the variables and functions that can be renamed without changing
+    // the interface of the shader.
+    TString minifyName(const TName &name);
+    bool isMinifiedVariable(const TIntermSymbol *symbol);
+    // ", " or "," when minifying the output.
+    const char *listSeparator() const { return mMinify ? "," : ", "; }
+
+    bool needsParentheses(TIntermTyped *node);
+    // Writes a space if the sign would otherwise be joined with the previous character into an
+    // increment or decrement operator.
+    void separateSign(char sign);
+
     TInfoSinkBase &mObjSink;
     bool mDeclaringVariables;
 
@@ -108,6 +128,15 @@ class TOutputGLSLBase : public TIntermTraverser
     ShShaderOutput mOutput;
 
     ShCompileOptions mCompileOptions;
+
+    bool mMinify;
+    // Set when the declaration being written continues the previous declaration.
+    bool mMergingDeclaration;
+    // Short names of the minified variables and functions, indexed by their original name.
+    std::map<TString, TString> mMinifiedNames;
+    // Names starting with an underscore that the shader already uses.
+    std::set<TString> mUsedUnderscoreNames;
+    size_t mNextMinifiedName;
 };
 
 }  // namespace sh
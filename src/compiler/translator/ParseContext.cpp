@@ -8,6 +8,7 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <chrono>
 
 #include "compiler/preprocessor/SourceLocation.h"
 #include "compiler/translator/Cache.h"
@@ -118,6 +119,7 @@ TParseContext::TParseContext(TSymbolTable &symt,
                         mShaderType,
                         resources.WEBGL_debug_shader_precision == 1),
       mPreprocessor(mDiagnostics, &mDirectiveHandler, pp::PreprocessorSettings()),
+      mPreprocessorSeconds(0.0),
       mScanner(nullptr),
       mUsesFragData(false),
       mUsesFragColor(false),
@@ -240,6 +242,20 @@ bool TParseContext::parseVectorFields(const TString &compString,
     return true;
 }
 
+void TParseContext::lexPreprocessedToken(pp::Token *token)
+{
+    if ((mCompileOptions & SH_COMPILE_STATISTICS) == 0)
+    {
+        mPreprocessor.lex(token);
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    mPreprocessor.lex(token);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    mPreprocessorSeconds += elapsed.count();
+}
+
 ///////////////////////////////////////////////////////////////////////
 //
 // Errors
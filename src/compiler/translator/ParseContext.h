@@ -43,6 +43,10 @@ class TParseContext : angle::NonCopyable
 
     const pp::Preprocessor &getPreprocessor() const { return mPreprocessor; }
     pp::Preprocessor &getPreprocessor() { return mPreprocessor; }
+    // Gets the next token for the lexer from the preprocessor. The time this takes is added up
+    // when compiling with SH_COMPILE_STATISTICS.
+    void lexPreprocessedToken(pp::Token *token);
+    double getPreprocessorSeconds() const { return mPreprocessorSeconds; }
     void *getScanner() const { return mScanner; }
     void setScanner(void *scanner) { mScanner = scanner; }
     int getShaderVersion() const { return mShaderVersion; }
@@ -457,6 +461,7 @@ class TParseContext : angle::NonCopyable
     TDiagnostics *mDiagnostics;
     TDirectiveHandler mDirectiveHandler;
     pp::Preprocessor mPreprocessor;
+    double mPreprocessorSeconds;
     void *mScanner;
     bool mUsesFragData;  // track if we are using both gl_FragData and gl_FragColor
     bool mUsesFragColor;
@@ -0,0 +1,451 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PassManager.cpp: Implements TPassManager.
+//
+
+#include "compiler/translator/PassManager.h"
+
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PoolAlloc.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Returns true if |later| sees the tree as it would after |earlier| when they share a traversal,
+// and |earlier| sees the tree as it would before |later|.
+bool CanShareTraversal(const TPassTraits &earlier, const TPassTraits &later)
+{
+    TNodeKinds earlierChanges = earlier.replaces | earlier.changes;
+    TNodeKinds laterChanges   = later.replaces | later.changes;
+
+    // The later pass must not depend on what the earlier one changes.
+    if ((earlierChanges & later.visits) != 0)
+    {
+        return false;
+    }
+
+    // A pass that changes the tree during the traversal would show its changes to the visits of
+    // the earlier pass that follow.
+    if (later.changesInPlace && (laterChanges & earlier.visits) != 0)
+    {
+        return false;
+    }
+
+    // A queued replacement would be lost if the other pass replaced its parent or the node.
+    return (earlier.replaces & laterChanges) == 0 && (later.replaces & earlierChanges) == 0;
+}
+
+}  // anonymous namespace
+
+// Calls the visit functions of several traversers during a single walk of the tree. Every
+// traverser still sees the tree as if it walked it alone: when one of its visit functions returns
+// false, it doesn't see the children of that node nor its post-visit, while the others do. The
+// traversal context of the traversers that use it follows the walk as their own traverse
+// functions would.
+class TFusedTraverser : public TIntermTraverser
+{
+  public:
+    // |visits| are the nodes that the matching traverser declared to visit, it isn't called for
+    // the others. |postVisit| must be set if a traverser has post-visits or uses the context.
+    TFusedTraverser(bool postVisit,
+                    const std::vector<TIntermTraverser *> &traversers,
+                    const std::vector<TNodeKinds> &visits,
+                    const std::vector<TIntermTraverser *> &contextTraversers)
+        : TIntermTraverser(true, false, postVisit),
+          mTraversers(traversers),
+          mVisits(visits),
+          mContextTraversers(contextTraversers),
+          mSkippedSubtrees(traversers.size(), nullptr),
+          mSkippedDepths(traversers.size(), 0)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        visitLeaf(node, kSymbolNode, &TIntermTraverser::visitSymbol);
+    }
+    void visitRaw(TIntermRaw *node) override
+    {
+        visitLeaf(node, kRawNode, &TIntermTraverser::visitRaw);
+    }
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        visitLeaf(node, kConstantUnionNode, &TIntermTraverser::visitConstantUnion);
+    }
+
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        return visitNode(visit, node, kSwizzleNode, &TIntermTraverser::visitSwizzle);
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        return visitNode(visit, node, kBinaryNode, &TIntermTraverser::visitBinary);
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        return visitNode(visit, node, kUnaryNode, &TIntermTraverser::visitUnary);
+    }
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        return visitNode(visit, node, kTernaryNode, &TIntermTraverser::visitTernary);
+    }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        return visitNode(visit, node, kIfElseNode, &TIntermTraverser::visitIfElse);
+    }
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        return visitNode(visit, node, kSwitchNode, &TIntermTraverser::visitSwitch);
+    }
+    bool visitCase(Visit visit, TIntermCase *node) override
+    {
+        return visitNode(visit, node, kCaseNode, &TIntermTraverser::visitCase);
+    }
+    bool visitFunctionPrototype(Visit visit, TIntermFunctionPrototype *node) override
+    {
+        return visitNode(visit, node, kFunctionPrototypeNode,
+                         &TIntermTraverser::visitFunctionPrototype);
+    }
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        // The prototype and the body are out of the global scope, as in
+        // traverseFunctionDefinition().
+        if (visit == PostVisit)
+        {
+            setInGlobalScope(true);
+        }
+        visitNode(visit, node, kFunctionDefinitionNode,
+                  &TIntermTraverser::visitFunctionDefinition);
+        if (visit == PreVisit)
+        {
+            setInGlobalScope(false);
+        }
+        return true;
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        return visitNode(visit, node, kAggregateNode, &TIntermTraverser::visitAggregate);
+    }
+    bool visitInvariantDeclaration(Visit visit, TIntermInvariantDeclaration *node) override
+    {
+        return visitNode(visit, node, kInvariantDeclarationNode,
+                         &TIntermTraverser::visitInvariantDeclaration);
+    }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        return visitNode(visit, node, kDeclarationNode, &TIntermTraverser::visitDeclaration);
+    }
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        return visitNode(visit, node, kLoopNode, &TIntermTraverser::visitLoop);
+    }
+    bool visitBranch(Visit visit, TIntermBranch *node) override
+    {
+        return visitNode(visit, node, kBranchNode, &TIntermTraverser::visitBranch);
+    }
+
+    // Same as the default, but tracks the parent block of the traversers that use the context.
+    void traverseBlock(TIntermBlock *node) override
+    {
+        ScopedNodeInTraversalPath addToPath(this, node);
+        for (TIntermTraverser *traverser : mContextTraversers)
+        {
+            traverser->incrementDepth(node);
+            traverser->pushParentBlock(node);
+        }
+
+        dispatch(PreVisit, node, kBlockNode, &TIntermTraverser::visitBlock);
+        for (TIntermNode *child : *node->getSequence())
+        {
+            child->traverse(this);
+            for (TIntermTraverser *traverser : mContextTraversers)
+            {
+                traverser->incrementParentBlockPos();
+            }
+        }
+        if (postVisit)
+        {
+            dispatch(PostVisit, node, kBlockNode, &TIntermTraverser::visitBlock);
+        }
+
+        for (TIntermTraverser *traverser : mContextTraversers)
+        {
+            traverser->popParentBlock();
+            traverser->decrementDepth();
+        }
+    }
+
+  private:
+    void setInGlobalScope(bool inGlobalScope)
+    {
+        for (TIntermTraverser *traverser : mContextTraversers)
+        {
+            traverser->mInGlobalScope = inGlobalScope;
+        }
+    }
+
+    // Returns true if the traverser at |index| skips the current node. The traverser resumes
+    // once the walk leaves the node whose children it skipped, which is when the walk gets back to
+    // the depth of that node if there are no post-visits.
+    bool isSkipped(size_t index, Visit visit, TIntermNode *node)
+    {
+        if (mSkippedSubtrees[index] == nullptr)
+        {
+            return false;
+        }
+        if (visit == PostVisit && mSkippedSubtrees[index] == node)
+        {
+            mSkippedSubtrees[index] = nullptr;
+            return true;
+        }
+        if (mDepth > mSkippedDepths[index])
+        {
+            return true;
+        }
+        mSkippedSubtrees[index] = nullptr;
+        return false;
+    }
+
+    template <typename NodeT>
+    void visitLeaf(NodeT *node, TNodeKind kind, void (TIntermTraverser::*visitFunction)(NodeT *))
+    {
+        for (TIntermTraverser *traverser : mContextTraversers)
+        {
+            traverser->incrementDepth(node);
+        }
+
+        for (size_t index = 0; index < mTraversers.size(); ++index)
+        {
+            if ((mVisits[index] & kind) != 0 && !isSkipped(index, PreVisit, node))
+            {
+                (mTraversers[index]->*visitFunction)(node);
+            }
+        }
+
+        for (TIntermTraverser *traverser : mContextTraversers)
+        {
+            traverser->decrementDepth();
+        }
+    }
+
+    // The node enters the path of the traversers that use the context before its pre-visit and
+    // leaves it after its post-visit, which the fused traversal never skips when they exist.
+    template <typename NodeT>
+    bool visitNode(Visit visit,
+                   NodeT *node,
+                   TNodeKind kind,
+                   bool (TIntermTraverser::*visitFunction)(Visit, NodeT *))
+    {
+        if (visit == PreVisit)
+        {
+            for (TIntermTraverser *traverser : mContextTraversers)
+            {
+                traverser->incrementDepth(node);
+            }
+        }
+
+        dispatch(visit, node, kind, visitFunction);
+
+        if (visit == PostVisit)
+        {
+            for (TIntermTraverser *traverser : mContextTraversers)
+            {
+                traverser->decrementDepth();
+            }
+        }
+
+        // The fused traversal always visits the children, the traversers skip them individually.
+        return true;
+    }
+
+    template <typename NodeT>
+    void dispatch(Visit visit,
+                  NodeT *node,
+                  TNodeKind kind,
+                  bool (TIntermTraverser::*visitFunction)(Visit, NodeT *))
+    {
+        for (size_t index = 0; index < mTraversers.size(); ++index)
+        {
+            // The skipped subtrees are also tracked for the nodes that the traverser doesn't visit.
+            if (isSkipped(index, visit, node) || (mVisits[index] & kind) == 0)
+            {
+                continue;
+            }
+
+            TIntermTraverser *traverser = mTraversers[index];
+            if (visit == PreVisit && traverser->hasPreVisit())
+            {
+                if (!(traverser->*visitFunction)(visit, node))
+                {
+                    mSkippedSubtrees[index] = node;
+                    mSkippedDepths[index]   = mDepth;
+                }
+            }
+            else if (visit == PostVisit && traverser->hasPostVisit())
+            {
+                (traverser->*visitFunction)(visit, node);
+            }
+        }
+    }
+
+    const std::vector<TIntermTraverser *> &mTraversers;
+    const std::vector<TNodeKinds> &mVisits;
+    const std::vector<TIntermTraverser *> &mContextTraversers;
+    std::vector<TIntermNode *> mSkippedSubtrees;
+    std::vector<int> mSkippedDepths;
+};
+
+TPassMeasurement::TPassMeasurement(std::vector<TPassStatistics> *statistics)
+    : mStatistics(statistics), mStartBytes(0)
+{
+    if (mStatistics)
+    {
+        mStartBytes = GetGlobalPoolAllocator()->getAllocatedBytes();
+        mStartTime  = std::chrono::steady_clock::now();
+    }
+}
+
+void TPassMeasurement::finish(const std::string &name)
+{
+    if (mStatistics)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - mStartTime;
+
+        TPassStatistics pass;
+        pass.name           = name;
+        pass.seconds        = elapsed.count();
+        pass.allocatedBytes = GetGlobalPoolAllocator()->getAllocatedBytes() - mStartBytes;
+        mStatistics->push_back(pass);
+    }
+}
+
+TPassManager::TPassManager(TIntermBlock *root, std::vector<TPassStatistics> *statistics)
+    : mRoot(root), mStatistics(statistics)
+{
+}
+
+TPassManager::~TPassManager()
+{
+}
+
+void TPassManager::addRewrite(const char *name,
+                              const TPassTraits &traits,
+                              std::unique_ptr<TIntermTraverser> traverser,
+                              std::function<void()> onFinished)
+{
+    ASSERT(!traverser->hasInVisit());
+
+    for (const QueuedPass &queuedPass : mQueuedPasses)
+    {
+        if (!CanShareTraversal(queuedPass.traits, traits))
+        {
+            flush();
+            break;
+        }
+    }
+
+    QueuedPass pass;
+    pass.name       = name;
+    pass.traits     = traits;
+    pass.traverser  = std::move(traverser);
+    pass.onFinished = std::move(onFinished);
+    mQueuedPasses.push_back(std::move(pass));
+}
+
+void TPassManager::addAnalysis(const char *name,
+                               TNodeKinds visits,
+                               std::unique_ptr<TIntermTraverser> traverser,
+                               std::function<void()> onFinished)
+{
+    TPassTraits traits;
+    traits.visits               = visits;
+    traits.replaces             = 0;
+    traits.changes              = 0;
+    traits.changesInPlace       = false;
+    traits.usesTraversalContext = false;
+    addRewrite(name, traits, std::move(traverser), std::move(onFinished));
+}
+
+bool TPassManager::run(const char *name, const std::function<bool()> &pass)
+{
+    flush();
+
+    TPassMeasurement measurement(mStatistics);
+    bool result = pass();
+    measurement.finish(name);
+    return result;
+}
+
+void TPassManager::runTransform(const char *name, const std::function<void()> &pass)
+{
+    run(name, [&pass]() {
+        pass();
+        return true;
+    });
+}
+
+void TPassManager::flush()
+{
+    if (mQueuedPasses.empty())
+    {
+        return;
+    }
+
+    TPassMeasurement measurement(mStatistics);
+
+    std::string name;
+    if (mQueuedPasses.size() == 1)
+    {
+        name = mQueuedPasses[0].name;
+        mRoot->traverse(mQueuedPasses[0].traverser.get());
+    }
+    else
+    {
+        std::vector<TIntermTraverser *> traversers;
+        std::vector<TNodeKinds> visits;
+        std::vector<TIntermTraverser *> contextTraversers;
+        bool postVisit = false;
+        for (const QueuedPass &pass : mQueuedPasses)
+        {
+            name += (name.empty() ? "" : "+");
+            name += pass.name;
+            traversers.push_back(pass.traverser.get());
+            visits.push_back(pass.traits.visits);
+            if (pass.traits.usesTraversalContext)
+            {
+                contextTraversers.push_back(pass.traverser.get());
+            }
+            postVisit = postVisit || pass.traits.usesTraversalContext ||
+                        pass.traverser->hasPostVisit();
+        }
+
+        // Most passes only pre-visit, so the fused traversal skips the post-visits if it can.
+        TFusedTraverser fusedTraverser(postVisit, traversers, visits, contextTraversers);
+        mRoot->traverse(&fusedTraverser);
+    }
+
+    // The passes queued their changes against the tree as it was before the traversal, which
+    // stays valid since their traits don't conflict. Analyses have nothing to update.
+    for (const QueuedPass &pass : mQueuedPasses)
+    {
+        pass.traverser->updateTree();
+    }
+    for (const QueuedPass &pass : mQueuedPasses)
+    {
+        if (pass.onFinished)
+        {
+            pass.onFinished();
+        }
+    }
+    mQueuedPasses.clear();
+
+    measurement.finish(name);
+}
+
+}  // namespace sh
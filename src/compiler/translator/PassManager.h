@@ -0,0 +1,154 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PassManager.h: Runs the passes that the compiler applies to the AST, fusing the passes that
+// can share a traversal and optionally recording the cost of every traversal.
+//
+
+#ifndef COMPILER_TRANSLATOR_PASSMANAGER_H_
+#define COMPILER_TRANSLATOR_PASSMANAGER_H_
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/angleutils.h"
+
+namespace sh
+{
+
+class TIntermBlock;
+class TIntermTraverser;
+
+// Kinds of AST nodes, one bit per node class.
+typedef unsigned int TNodeKinds;
+enum TNodeKind : TNodeKinds
+{
+    kSymbolNode               = 1u << 0,
+    kRawNode                  = 1u << 1,
+    kConstantUnionNode        = 1u << 2,
+    kSwizzleNode              = 1u << 3,
+    kBinaryNode               = 1u << 4,
+    kUnaryNode                = 1u << 5,
+    kTernaryNode              = 1u << 6,
+    kIfElseNode               = 1u << 7,
+    kSwitchNode               = 1u << 8,
+    kCaseNode                 = 1u << 9,
+    kFunctionPrototypeNode    = 1u << 10,
+    kFunctionDefinitionNode   = 1u << 11,
+    kAggregateNode            = 1u << 12,
+    kBlockNode                = 1u << 13,
+    kInvariantDeclarationNode = 1u << 14,
+    kDeclarationNode          = 1u << 15,
+    kLoopNode                 = 1u << 16,
+    kBranchNode               = 1u << 17,
+};
+
+// The nodes that can have an expression as a child, so that replacing an expression changes them.
+constexpr TNodeKinds kExpressionParentNodes =
+    kSwizzleNode | kBinaryNode | kUnaryNode | kTernaryNode | kIfElseNode | kSwitchNode |
+    kCaseNode | kAggregateNode | kBlockNode | kDeclarationNode | kLoopNode | kBranchNode;
+
+// Declares which nodes a pass depends on and which it changes, so that the pass manager can tell
+// whether it may share a traversal with the passes queued before it.
+struct TPassTraits
+{
+    // Nodes that the pass visits, or that it looks at from the nodes it visits beyond their type,
+    // for example the parent node or a constant operand. When the pass shares a traversal, only
+    // the visit functions of these nodes are called.
+    TNodeKinds visits;
+    // Nodes that the pass replaces or removes.
+    TNodeKinds replaces;
+    // Nodes that the pass creates, or whose children it replaces, adds or removes.
+    TNodeKinds changes;
+    // Set if the pass changes the tree from its visit functions. Otherwise it queues its changes
+    // for updateTree().
+    bool changesInPlace;
+    // Set if the visit functions of the pass use the traversal context: depth, path, parent blocks
+    // or global scope. Queueing changes for updateTree() uses it.
+    bool usesTraversalContext;
+};
+
+struct TPassStatistics
+{
+    // Name of the pass, or the names of the fused passes joined with '+'.
+    std::string name;
+    double seconds;
+    // Bytes allocated from the pool allocator while the pass ran.
+    size_t allocatedBytes;
+};
+
+// Measures the time and the pool memory that a pass takes, and appends them to |statistics| in
+// finish(). Does nothing when |statistics| is null.
+class TPassMeasurement : angle::NonCopyable
+{
+  public:
+    explicit TPassMeasurement(std::vector<TPassStatistics> *statistics);
+
+    void finish(const std::string &name);
+
+  private:
+    std::vector<TPassStatistics> *mStatistics;
+    size_t mStartBytes;
+    std::chrono::steady_clock::time_point mStartTime;
+};
+
+class TPassManager : angle::NonCopyable
+{
+  public:
+    // |statistics| may be null, in which case the passes aren't measured.
+    TPassManager(TIntermBlock *root, std::vector<TPassStatistics> *statistics);
+    ~TPassManager();
+
+    // Queues a rewrite. Consecutive queued passes run together in a single traversal, at the
+    // latest when the next pass runs or flush() is called, unless |traits| conflict with the ones
+    // of a pass queued before, in which case the queued passes run first. After the traversal,
+    // updateTree() is called on |traverser|, then |onFinished|.
+    //
+    // Fusing is only correct for traversers that use the default traverse functions and don't
+    // visit in between children. The fused traversal keeps their traversal context up to date if
+    // |traits| say they use it.
+    void addRewrite(const char *name,
+                    const TPassTraits &traits,
+                    std::unique_ptr<TIntermTraverser> traverser,
+                    std::function<void()> onFinished = nullptr);
+
+    // Queues a pass that leaves the tree structure alone, though it may still set flags on nodes,
+    // and doesn't use the traversal context. |visits| are the nodes it depends on, as in
+    // TPassTraits.
+    void addAnalysis(const char *name,
+                     TNodeKinds visits,
+                     std::unique_ptr<TIntermTraverser> traverser,
+                     std::function<void()> onFinished = nullptr);
+
+    // Runs the queued passes, then |pass| on its own. Returns what |pass| returns.
+    bool run(const char *name, const std::function<bool()> &pass);
+
+    // Same as run() for passes that can't fail.
+    void runTransform(const char *name, const std::function<void()> &pass);
+
+    // Runs the queued passes. The ones still queued when the manager is destroyed are dropped,
+    // which is what a failed compilation wants.
+    void flush();
+
+  private:
+    struct QueuedPass
+    {
+        const char *name;
+        TPassTraits traits;
+        std::unique_ptr<TIntermTraverser> traverser;
+        std::function<void()> onFinished;
+    };
+
+    TIntermBlock *mRoot;
+    std::vector<TPassStatistics> *mStatistics;
+    std::vector<QueuedPass> mQueuedPasses;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_PASSMANAGER_H_
@@ -16,8 +16,66 @@
 #include "common/tls.h"
 #include "compiler/translator/InitializeGlobals.h"
 
+#include <algorithm>
+
 TLSIndex PoolIndex = TLS_INVALID_INDEX;
 
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+namespace
+{
+
+// Individual pages left over by the allocators destroyed on a thread. Keeping a few of them saves
+// going back to the OS when the next compiler on the thread is created, without any locking.
+class TPageCache : angle::NonCopyable
+{
+  public:
+    // Only pages of the default size are cached, which is what every allocator uses in practice.
+    static constexpr size_t kPageSize = 8 * 1024;
+    static constexpr size_t kMaxPages = 256;
+
+    ~TPageCache()
+    {
+        for (size_t index = 0; index < mPageCount; ++index)
+        {
+            delete[] static_cast<char *>(mPages[index]);
+        }
+
+        // Allocators can still be destroyed during thread or process exit after this point. Act as
+        // an empty and full cache so that their pages go straight back to the OS.
+        mPageCount = 0;
+        mCapacity  = 0;
+    }
+
+    void *acquire()
+    {
+        if (mPageCount == 0)
+        {
+            return nullptr;
+        }
+        return mPages[--mPageCount];
+    }
+
+    bool release(void *page)
+    {
+        if (mPageCount >= mCapacity)
+        {
+            return false;
+        }
+        mPages[mPageCount++] = page;
+        return true;
+    }
+
+  private:
+    void *mPages[kMaxPages];
+    size_t mPageCount = 0;
+    size_t mCapacity  = kMaxPages;
+};
+
+thread_local TPageCache gPageCache;
+
+}  // anonymous namespace
+#endif  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+
 bool InitializePoolIndex()
 {
     assert(PoolIndex == TLS_INVALID_INDEX);
@@ -56,10 +114,13 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment)
       pageSize(growthIncrement),
       freeList(0),
       inUseList(0),
-      numCalls(0),
-      totalBytes(0),
 #endif
-      mLocked(false)
+      mLocked(false),
+      mAllocationCount(0),
+      mAllocatedBytes(0),
+      mInUseBytes(0),
+      mPeakInUseBytes(0),
+      mPageCount(0)
 {
     //
     // Adjust alignment to be at least pointer aligned and
@@ -109,7 +170,10 @@ TPoolAllocator::~TPoolAllocator()
     {
         tHeader *next = inUseList->nextPage;
         inUseList->~tHeader();
-        delete[] reinterpret_cast<char *>(inUseList);
+        if (inUseList->pageCount > 1)
+            delete[] reinterpret_cast<char *>(inUseList);
+        else
+            releasePage(inUseList);
         inUseList = next;
     }
 
@@ -120,7 +184,7 @@ TPoolAllocator::~TPoolAllocator()
     while (freeList)
     {
         tHeader *next = freeList->nextPage;
-        delete[] reinterpret_cast<char *>(freeList);
+        releasePage(freeList);
         freeList = next;
     }
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
@@ -212,6 +276,7 @@ void TPoolAllocator::pop()
         inUseList->~tHeader();
 
         tHeader *nextInUse = inUseList->nextPage;
+        mInUseBytes -= inUseList->pageCount * pageSize;
         if (inUseList->pageCount > 1)
             delete[] reinterpret_cast<char *>(inUseList);
         else
@@ -246,13 +311,10 @@ void *TPoolAllocator::allocate(size_t numBytes)
 {
     ASSERT(!mLocked);
 
-#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
-    //
-    // Just keep some interesting statistics.
-    //
-    ++numCalls;
-    totalBytes += numBytes;
+    ++mAllocationCount;
+    mAllocatedBytes += numBytes;
 
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     // If we are using guard blocks, all allocations are bracketed by
     // them: [guardblock][allocation][guardblock].  numBytes is how
     // much memory the caller asked for.  allocationSize is the total
@@ -297,6 +359,7 @@ void *TPoolAllocator::allocate(size_t numBytes)
         // Use placement-new to initialize header
         new (memory) tHeader(inUseList, (numBytesToAlloc + pageSize - 1) / pageSize);
         inUseList = memory;
+        addInUsePages(inUseList->pageCount);
 
         currentPageOffset = pageSize;  // make next allocation come from a new page
 
@@ -307,22 +370,14 @@ void *TPoolAllocator::allocate(size_t numBytes)
     //
     // Need a simple page to allocate from.
     //
-    tHeader *memory;
-    if (freeList)
-    {
-        memory   = freeList;
-        freeList = freeList->nextPage;
-    }
-    else
-    {
-        memory = reinterpret_cast<tHeader *>(::new char[pageSize]);
-        if (memory == 0)
-            return 0;
-    }
+    tHeader *memory = acquirePage();
+    if (memory == 0)
+        return 0;
 
     // Use placement-new to initialize header
     new (memory) tHeader(inUseList, 1);
     inUseList = memory;
+    addInUsePages(1);
 
     unsigned char *ret = reinterpret_cast<unsigned char *>(inUseList) + headerSkip;
     currentPageOffset  = (headerSkip + allocationSize + alignmentMask) & ~alignmentMask;
@@ -338,6 +393,42 @@ void *TPoolAllocator::allocate(size_t numBytes)
 #endif
 }
 
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+void TPoolAllocator::addInUsePages(size_t pageCount)
+{
+    mInUseBytes += pageCount * pageSize;
+    mPeakInUseBytes = std::max(mPeakInUseBytes, mInUseBytes);
+}
+
+TPoolAllocator::tHeader *TPoolAllocator::acquirePage()
+{
+    if (freeList)
+    {
+        tHeader *page = freeList;
+        freeList      = freeList->nextPage;
+        return page;
+    }
+
+    void *page = (pageSize == TPageCache::kPageSize) ? gPageCache.acquire() : nullptr;
+    if (page == nullptr)
+    {
+        page = ::new char[pageSize];
+    }
+    ++mPageCount;
+    return reinterpret_cast<tHeader *>(page);
+}
+
+void TPoolAllocator::releasePage(tHeader *page)
+{
+    ASSERT(mPageCount > 0);
+    --mPageCount;
+    if (pageSize != TPageCache::kPageSize || !gPageCache.release(page))
+    {
+        delete[] reinterpret_cast<char *>(page);
+    }
+}
+#endif  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+
 void TPoolAllocator::lock()
 {
     ASSERT(!mLocked);
@@ -112,7 +112,8 @@ class TAllocation
 // Page stacks are linked together with a simple header at the beginning
 // of each allocation obtained from the underlying OS.  Multi-page allocations
 // are returned to the OS.  Individual page allocations are kept for future
-// re-use.
+// re-use.  When an allocator is destroyed, its individual pages go to a
+// small per-thread cache that the next allocator on the thread draws from.
 //
 // The "page size" used is not, nor must it match, the underlying OS
 // page size.  But, having it be about that size or equal to a set of
@@ -163,6 +164,15 @@ class TPoolAllocator
     void lock();
     void unlock();
 
+    // Statistics since the allocator was created.
+    size_t getAllocationCount() const { return mAllocationCount; }
+    size_t getAllocatedBytes() const { return mAllocatedBytes; }
+    // Memory in the pages currently used for allocations, and its high-water mark.
+    size_t getInUseBytes() const { return mInUseBytes; }
+    size_t getPeakInUseBytes() const { return mPeakInUseBytes; }
+    // Pages owned by the allocator, in use or kept on its free list.
+    size_t getPageCount() const { return mPageCount; }
+
   private:
     size_t alignment;  // all returned allocations will be aligned at
                        // this granularity, which will be a power of 2
@@ -225,8 +235,9 @@ class TPoolAllocator
     tHeader *inUseList;        // list of all memory currently being used
     tAllocStack mStack;        // stack of where to allocate from, to partition pool
 
-    int numCalls;       // just an interesting statistic
-    size_t totalBytes;  // just an interesting statistic
+    void addInUsePages(size_t pageCount);
+    tHeader *acquirePage();
+    void releasePage(tHeader *page);
 
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     std::vector<std::vector<void *>> mStack;
@@ -235,6 +246,12 @@ class TPoolAllocator
     TPoolAllocator &operator=(const TPoolAllocator &);  // dont allow assignment operator
     TPoolAllocator(const TPoolAllocator &);             // dont allow default copy constructor
     bool mLocked;
+
+    size_t mAllocationCount;
+    size_t mAllocatedBytes;
+    size_t mInUseBytes;
+    size_t mPeakInUseBytes;
+    size_t mPageCount;
 };
 
 //
@@ -7,6 +7,7 @@
 #include "compiler/translator/RemoveInvariantDeclaration.h"
 
 #include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PassManager.h"
 
 namespace sh
 {
@@ -33,11 +34,18 @@ class RemoveInvariantDeclarationTraverser : public TIntermTraverser
 
 }  // anonymous namespace
 
-void RemoveInvariantDeclaration(TIntermNode *root)
+void QueueRemoveInvariantDeclaration(TPassManager *passes)
 {
-    RemoveInvariantDeclarationTraverser traverser;
-    root->traverse(&traverser);
-    traverser.updateTree();
+    // The declarations are removed from their parent block.
+    TPassTraits traits;
+    traits.visits               = kInvariantDeclarationNode | kBlockNode;
+    traits.replaces             = kInvariantDeclarationNode;
+    traits.changes              = kBlockNode;
+    traits.changesInPlace       = false;
+    traits.usesTraversalContext = true;
+    passes->addRewrite(
+        "RemoveInvariantDeclaration", traits,
+        std::unique_ptr<TIntermTraverser>(new RemoveInvariantDeclarationTraverser()));
 }
 
 }  // namespace sh
@@ -10,8 +10,10 @@
 class TIntermNode;
 namespace sh
 {
+class TPassManager;
 
-void RemoveInvariantDeclaration(TIntermNode *root);
+// Queues the rewrite in |passes|, so that it can share a traversal with other passes.
+void QueueRemoveInvariantDeclaration(TPassManager *passes);
 
 }  // namespace sh
 
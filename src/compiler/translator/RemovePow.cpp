@@ -12,6 +12,7 @@
 
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PassManager.h"
 
 namespace sh
 {
@@ -82,16 +83,27 @@ bool RemovePowTraverser::visitAggregate(Visit visit, TIntermAggregate *node)
 
 }  // namespace
 
-void RemovePow(TIntermNode *root)
+void QueueRemovePow(TPassManager *passes, TIntermNode *root)
 {
-    RemovePowTraverser traverser;
-    // Iterate as necessary, and reset the traverser between iterations.
-    do
-    {
-        traverser.nextIteration();
-        root->traverse(&traverser);
-        traverser.updateTree();
-    } while (traverser.needAnotherIteration());
+    // The exponent is looked at to find the pow calls to replace.
+    TPassTraits traits;
+    traits.visits               = kAggregateNode | kConstantUnionNode;
+    traits.replaces             = kAggregateNode;
+    traits.changes              = kUnaryNode | kBinaryNode | kExpressionParentNodes;
+    traits.changesInPlace       = false;
+    traits.usesTraversalContext = true;
+
+    RemovePowTraverser *traverser = new RemovePowTraverser();
+    passes->addRewrite("RemovePow", traits, std::unique_ptr<TIntermTraverser>(traverser),
+                       [traverser, root]() {
+                           // Iterate as necessary, and reset the traverser between iterations.
+                           while (traverser->needAnotherIteration())
+                           {
+                               traverser->nextIteration();
+                               root->traverse(traverser);
+                               traverser->updateTree();
+                           }
+                       });
 }
 
 }  // namespace sh
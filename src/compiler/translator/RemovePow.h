@@ -14,8 +14,12 @@
 namespace sh
 {
 class TIntermNode;
+class TPassManager;
 
-void RemovePow(TIntermNode *root);
+// Queues the rewrite in |passes|, so that its first traversal can be shared with other passes.
+// The pow calls nested in replaced ones are removed by further traversals of |root|, right after
+// the first.
+void QueueRemovePow(TPassManager *passes, TIntermNode *root);
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_REMOVEPOW_H_
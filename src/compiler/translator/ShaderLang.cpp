@@ -11,6 +11,11 @@
 
 #include "GLSLANG/ShaderLang.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "common/WorkerThread.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/length_limits.h"
@@ -102,6 +107,91 @@ TranslatorHLSL *GetTranslatorHLSLFromHandle(ShHandle handle)
 }
 #endif  // ANGLE_ENABLE_HLSL
 
+// Takes the jobs of a batch one at a time until none are left. Each task keeps one compiler per
+// shader type, so that a batch constructs at most a few compilers per thread.
+class BatchCompileTask : public angle::Closure
+{
+  public:
+    BatchCompileTask(ShShaderSpec spec,
+                     ShShaderOutput output,
+                     const ShBuiltInResources &resources,
+                     const std::vector<BatchCompileJob> &jobs,
+                     std::atomic<size_t> *nextJob,
+                     std::vector<BatchCompileResult> *results)
+        : mSpec(spec),
+          mOutput(output),
+          mResources(resources),
+          mJobs(jobs),
+          mNextJob(nextJob),
+          mResults(results)
+    {
+    }
+
+    void operator()() override
+    {
+        std::map<sh::GLenum, ShHandle> compilers;
+
+        for (size_t jobIndex = mNextJob->fetch_add(1); jobIndex < mJobs.size();
+             jobIndex = mNextJob->fetch_add(1))
+        {
+            const BatchCompileJob &job = mJobs[jobIndex];
+            BatchCompileResult &result = (*mResults)[jobIndex];
+
+            ShHandle &compiler = compilers[job.type];
+            if (compiler == 0)
+            {
+                compiler = ConstructCompiler(job.type, mSpec, mOutput, &mResources);
+            }
+            if (compiler == 0)
+            {
+                result.infoLog = "Could not construct a compiler for this shader type.";
+                continue;
+            }
+
+            std::vector<const char *> sourceStrings;
+            for (const std::string &source : job.sources)
+            {
+                sourceStrings.push_back(source.c_str());
+            }
+
+            result.success =
+                Compile(compiler, sourceStrings.data(), sourceStrings.size(), job.compileOptions);
+            result.shaderVersion = GetShaderVersion(compiler);
+            result.infoLog       = GetInfoLog(compiler);
+            if (!result.success)
+            {
+                continue;
+            }
+
+            if ((job.compileOptions & SH_OBJECT_CODE) != 0)
+            {
+                result.objectCode = GetObjectCode(compiler);
+            }
+            if ((job.compileOptions & SH_VARIABLES) != 0)
+            {
+                result.uniforms        = *GetUniforms(compiler);
+                result.varyings        = *GetVaryings(compiler);
+                result.attributes      = *GetAttributes(compiler);
+                result.outputVariables = *GetOutputVariables(compiler);
+                result.interfaceBlocks = *GetInterfaceBlocks(compiler);
+            }
+        }
+
+        for (const auto &compiler : compilers)
+        {
+            Destruct(compiler.second);
+        }
+    }
+
+  private:
+    ShShaderSpec mSpec;
+    ShShaderOutput mOutput;
+    const ShBuiltInResources &mResources;
+    const std::vector<BatchCompileJob> &mJobs;
+    std::atomic<size_t> *mNextJob;
+    std::vector<BatchCompileResult> *mResults;
+};
+
 }  // anonymous namespace
 
 //
@@ -428,4 +518,69 @@ const std::map<std::string, unsigned int> *GetUniformRegisterMap(const ShHandle
 #endif  // ANGLE_ENABLE_HLSL
 }
 
+PoolAllocatorStats GetPoolAllocatorStats(const ShHandle handle)
+{
+    ASSERT(handle);
+    const TPoolAllocator &allocator = static_cast<TShHandleBase *>(handle)->getAllocator();
+
+    PoolAllocatorStats stats;
+    stats.allocationCount = allocator.getAllocationCount();
+    stats.allocatedBytes  = allocator.getAllocatedBytes();
+    stats.peakBytes       = allocator.getPeakInUseBytes();
+    stats.pageCount       = allocator.getPageCount();
+    return stats;
+}
+
+CompileStatistics GetCompileStatistics(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    CompileStatistics statistics;
+    for (const TPassStatistics &pass : compiler->getCompileStatistics())
+    {
+        CompileStageStatistics stage;
+        stage.name           = pass.name;
+        stage.seconds        = pass.seconds;
+        stage.allocatedBytes = pass.allocatedBytes;
+        statistics.stages.push_back(stage);
+    }
+    statistics.totalSeconds  = compiler->getCompileSeconds();
+    statistics.poolAllocator = GetPoolAllocatorStats(handle);
+    return statistics;
+}
+
+std::vector<BatchCompileResult> CompileBatch(ShShaderSpec spec,
+                                             ShShaderOutput output,
+                                             const ShBuiltInResources &resources,
+                                             const std::vector<BatchCompileJob> &jobs,
+                                             size_t maxThreads)
+{
+    std::vector<BatchCompileResult> results(jobs.size());
+
+    if (maxThreads == 0)
+    {
+        maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    size_t taskCount = std::min(maxThreads, jobs.size());
+
+    std::atomic<size_t> nextJob(0);
+    std::vector<BatchCompileTask> tasks(
+        taskCount, BatchCompileTask(spec, output, resources, jobs, &nextJob, &results));
+
+    angle::WorkerThreadPool workerPool(taskCount);
+    std::vector<angle::WaitableEvent> waitEvents;
+    waitEvents.reserve(taskCount);
+    for (BatchCompileTask &task : tasks)
+    {
+        waitEvents.push_back(workerPool.postWorkerTask(&task));
+    }
+    for (angle::WaitableEvent &waitEvent : waitEvents)
+    {
+        waitEvent.wait();
+    }
+
+    return results;
+}
+
 }  // namespace sh
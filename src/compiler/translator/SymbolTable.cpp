@@ -31,7 +31,7 @@ static const char kFunctionMangledNameSeparator = '(';
 
 }  // anonymous namespace
 
-int TSymbolTable::uniqueIdCounter = 0;
+std::atomic<int> TSymbolTable::uniqueIdCounter(0);
 
 TSymbolUniqueId::TSymbolUniqueId() : mId(TSymbolTable::nextUniqueId())
 {
@@ -77,61 +77,149 @@ void TFunction::swapParameters(const TFunction &parametersSource)
 
 const TString *TFunction::buildMangledName() const
 {
-    std::string newName = getName().c_str();
-    newName += kFunctionMangledNameSeparator;
+    TString *newName = NewPoolTString(getName().c_str());
+    *newName += kFunctionMangledNameSeparator;
 
     for (const auto &p : parameters)
     {
-        newName += p.type->getMangledName().c_str();
+        *newName += p.type->getMangledName();
     }
-    return NewPoolTString(newName.c_str());
+    return newName;
 }
 
 const TString &TFunction::GetMangledNameFromCall(const TString &functionName,
                                                  const TIntermSequence &arguments)
 {
-    std::string newName = functionName.c_str();
-    newName += kFunctionMangledNameSeparator;
+    TString *newName = NewPoolTString(functionName.c_str());
+    *newName += kFunctionMangledNameSeparator;
 
     for (TIntermNode *argument : arguments)
     {
-        newName += argument->getAsTyped()->getType().getMangledName().c_str();
+        *newName += argument->getAsTyped()->getType().getMangledName();
     }
-    return *NewPoolTString(newName.c_str());
+    return *newName;
 }
 
 //
-// Symbol table levels are a map of pointers to symbols that have to be deleted.
+// Symbol table levels are a hash table of pointers to symbols that have to be deleted.
 //
 TSymbolTableLevel::~TSymbolTableLevel()
 {
-    for (tLevel::iterator it = level.begin(); it != level.end(); ++it)
-        delete (*it).second;
+    for (const Slot &slot : mSlots)
+        delete slot.symbol;
 }
 
-bool TSymbolTableLevel::insert(TSymbol *symbol)
+size_t TSymbolTableLevel::HashName(const TString &name)
 {
-    // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(symbol->getMangledName(), symbol));
+    // 32-bit FNV-1a, names are short and this is cheap compared to comparing them.
+    uint32_t hash = 2166136261u;
+    for (char c : name)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-    return result.second;
+bool TSymbolTableLevel::insert(TSymbol *symbol)
+{
+    return insert(symbol->getMangledName(), symbol);
 }
 
 bool TSymbolTableLevel::insertUnmangled(TFunction *function)
 {
-    // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(function->getName(), function));
+    return insert(function->getName(), function);
+}
+
+bool TSymbolTableLevel::insert(const TString &name, TSymbol *symbol)
+{
+    // Keep the table at most half full so that probe sequences stay short.
+    if ((mSymbolCount + 1) * 2 > mSlots.size())
+    {
+        grow();
+    }
 
-    return result.second;
+    size_t nameHash = HashName(name);
+    size_t mask     = mSlots.size() - 1;
+    size_t index    = nameHash & mask;
+    while (mSlots[index].symbol != nullptr)
+    {
+        // returning false means the name was already in the table
+        if (mSlots[index].nameHash == nameHash && *mSlots[index].name == name)
+        {
+            return false;
+        }
+        index = (index + 1) & mask;
+    }
+
+    mSlots[index].nameHash = nameHash;
+    mSlots[index].name     = &name;
+    mSlots[index].symbol   = symbol;
+    mSymbolCount++;
+    return true;
 }
 
-TSymbol *TSymbolTableLevel::find(const TString &name) const
+void TSymbolTableLevel::grow()
 {
-    tLevel::const_iterator it = level.find(name);
-    if (it == level.end())
-        return 0;
-    else
-        return (*it).second;
+    std::vector<Slot> oldSlots(std::max<size_t>(mSlots.size() * 2, 16u));
+    oldSlots.swap(mSlots);
+
+    size_t mask = mSlots.size() - 1;
+    for (const Slot &slot : oldSlots)
+    {
+        if (slot.symbol == nullptr)
+        {
+            continue;
+        }
+        size_t index = slot.nameHash & mask;
+        while (mSlots[index].symbol != nullptr)
+        {
+            index = (index + 1) & mask;
+        }
+        mSlots[index] = slot;
+    }
+}
+
+void TSymbolTableLevel::realize() const
+{
+    for (const Slot &slot : mSlots)
+    {
+        if (slot.symbol == nullptr)
+        {
+            continue;
+        }
+        if (slot.symbol->isVariable())
+        {
+            const TType &type = static_cast<const TVariable *>(slot.symbol)->getType();
+            type.getMangledName();
+            type.getObjectSize();
+        }
+        else if (slot.symbol->isFunction())
+        {
+            const TFunction *function = static_cast<const TFunction *>(slot.symbol);
+            function->getMangledName();
+            function->getReturnType().getMangledName();
+        }
+    }
+}
+
+TSymbol *TSymbolTableLevel::find(const TString &name, size_t nameHash) const
+{
+    if (mSlots.empty())
+    {
+        return nullptr;
+    }
+
+    size_t mask = mSlots.size() - 1;
+    for (size_t index = nameHash & mask; mSlots[index].symbol != nullptr;
+         index = (index + 1) & mask)
+    {
+        if (mSlots[index].nameHash == nameHash && *mSlots[index].name == name)
+        {
+            return mSlots[index].symbol;
+        }
+    }
+    return nullptr;
 }
 
 TSymbol *TSymbolTable::find(const TString &name,
@@ -139,7 +227,8 @@ TSymbol *TSymbolTable::find(const TString &name,
                             bool *builtIn,
                             bool *sameScope) const
 {
-    int level = currentLevel();
+    int level       = currentLevel();
+    size_t nameHash = TSymbolTableLevel::HashName(name);
     TSymbol *symbol;
 
     do
@@ -151,7 +240,7 @@ TSymbol *TSymbolTable::find(const TString &name,
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        symbol = table[level]->find(name);
+        symbol = table[level]->find(name, nameHash);
     } while (symbol == 0 && --level >= 0);
 
     if (builtIn)
@@ -170,6 +259,7 @@ TSymbol *TSymbolTable::findGlobal(const TString &name) const
 
 TSymbol *TSymbolTable::findBuiltIn(const TString &name, int shaderVersion) const
 {
+    size_t nameHash = TSymbolTableLevel::HashName(name);
     for (int level = LAST_BUILTIN_LEVEL; level >= 0; level--)
     {
         if (level == ESSL3_1_BUILTINS && shaderVersion != 310)
@@ -179,7 +269,7 @@ TSymbol *TSymbolTable::findBuiltIn(const TString &name, int shaderVersion) const
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        TSymbol *symbol = table[level]->find(name);
+        TSymbol *symbol = table[level]->find(name, nameHash);
 
         if (symbol)
             return symbol;
@@ -190,10 +280,27 @@ TSymbol *TSymbolTable::findBuiltIn(const TString &name, int shaderVersion) const
 
 TSymbolTable::~TSymbolTable()
 {
-    while (table.size() > 0)
+    while (table.size() > mSharedLevelCount)
         pop();
 }
 
+void TSymbolTable::shareBuiltInLevels(const TSymbolTable &builtIns)
+{
+    ASSERT(isEmpty());
+    ASSERT(builtIns.table.size() == LAST_BUILTIN_LEVEL + 1);
+    table             = builtIns.table;
+    precisionStack    = builtIns.precisionStack;
+    mSharedLevelCount = table.size();
+}
+
+void TSymbolTable::realizeBuiltIns() const
+{
+    for (const TSymbolTableLevel *level : table)
+    {
+        level->realize();
+    }
+}
+
 bool IsGenType(const TType *type)
 {
     if (type)
@@ -31,6 +31,7 @@
 //
 
 #include <array>
+#include <atomic>
 #include <assert.h>
 #include <set>
 
@@ -232,20 +233,19 @@ class TInterfaceBlockName : public TSymbol
 class TSymbolTableLevel
 {
   public:
-    typedef TMap<TString, TSymbol *> tLevel;
-    typedef tLevel::const_iterator const_iterator;
-    typedef const tLevel::value_type tLevelPair;
-    typedef std::pair<tLevel::iterator, bool> tInsertResult;
-
-    TSymbolTableLevel() : mGlobalInvariant(false) {}
+    TSymbolTableLevel() : mGlobalInvariant(false), mSymbolCount(0) {}
     ~TSymbolTableLevel();
 
+    // Hashes a symbol name. Lookups through several levels compute it only once.
+    static size_t HashName(const TString &name);
+
     bool insert(TSymbol *symbol);
 
     // Insert a function using its unmangled name as the key.
     bool insertUnmangled(TFunction *function);
 
-    TSymbol *find(const TString &name) const;
+    TSymbol *find(const TString &name) const { return find(name, HashName(name)); }
+    TSymbol *find(const TString &name, size_t nameHash) const;
 
     void addInvariantVarying(const std::string &name) { mInvariantVaryings.insert(name); }
 
@@ -266,12 +266,30 @@ class TSymbolTableLevel
         return mUnmangledBuiltInNames.count(name) > 0;
     }
 
+    // Builds the names that symbols otherwise compute on first use, so that reading the level
+    // doesn't write to it.
+    void realize() const;
+
   protected:
-    tLevel level;
     std::set<std::string> mInvariantVaryings;
     bool mGlobalInvariant;
 
   private:
+    // The level is an open addressing hash table with linear probing. The key points to the name
+    // or mangled name of the symbol, which lives as long as the symbol. Empty slots have no symbol.
+    struct Slot
+    {
+        size_t nameHash;
+        const TString *name;
+        TSymbol *symbol;
+    };
+
+    bool insert(const TString &name, TSymbol *symbol);
+    void grow();
+
+    std::vector<Slot> mSlots;
+    size_t mSymbolCount;
+
     std::set<std::string> mUnmangledBuiltInNames;
 };
 
@@ -289,7 +307,7 @@ const int GLOBAL_LEVEL       = 4;
 class TSymbolTable : angle::NonCopyable
 {
   public:
-    TSymbolTable()
+    TSymbolTable() : mSharedLevelCount(0)
     {
         // The symbol table cannot be used until push() is called, but
         // the lack of an initial call to push() can be used to detect
@@ -312,6 +330,7 @@ class TSymbolTable : angle::NonCopyable
 
     void pop()
     {
+        ASSERT(table.size() > mSharedLevelCount);
         delete table.back();
         table.pop_back();
 
@@ -319,6 +338,13 @@ class TSymbolTable : angle::NonCopyable
         precisionStack.pop_back();
     }
 
+    // Uses the built-in levels of |builtIns| as the bottom levels of this empty table. They stay
+    // owned by |builtIns|, which must outlive this table and is never modified through it.
+    void shareBuiltInLevels(const TSymbolTable &builtIns);
+
+    // Prepares the built-in levels to be shared between several tables.
+    void realizeBuiltIns() const;
+
     bool declare(TSymbol *symbol) { return insert(currentLevel(), symbol); }
 
     bool insert(ESymbolLevel level, TSymbol *symbol) { return table[level]->insert(symbol); }
@@ -505,7 +531,10 @@ class TSymbolTable : angle::NonCopyable
     typedef TMap<TBasicType, TPrecision> PrecisionStackLevel;
     std::vector<PrecisionStackLevel *> precisionStack;
 
-    static int uniqueIdCounter;
+    // Number of levels at the bottom of the table that belong to another table.
+    size_t mSharedLevelCount;
+
+    static std::atomic<int> uniqueIdCounter;
 };
 
 }  // namespace sh
@@ -6,6 +6,8 @@
 
 #include "compiler/translator/UnfoldShortCircuitAST.h"
 
+#include "compiler/translator/PassManager.h"
+
 namespace sh
 {
 
@@ -56,4 +58,17 @@ bool UnfoldShortCircuitAST::visitBinary(Visit visit, TIntermBinary *node)
     return true;
 }
 
+void QueueUnfoldShortCircuitAST(TPassManager *passes)
+{
+    // The operands of the replaced node move to the new ternary node.
+    TPassTraits traits;
+    traits.visits               = kBinaryNode;
+    traits.replaces             = kBinaryNode;
+    traits.changes              = kTernaryNode | kConstantUnionNode | kExpressionParentNodes;
+    traits.changesInPlace       = false;
+    traits.usesTraversalContext = true;
+    passes->addRewrite("UnfoldShortCircuit", traits,
+                       std::unique_ptr<TIntermTraverser>(new UnfoldShortCircuitAST()));
+}
+
 }  // namespace sh
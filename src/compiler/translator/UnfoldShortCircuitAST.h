@@ -15,6 +15,7 @@
 
 namespace sh
 {
+class TPassManager;
 
 // This traverser identifies all the short circuit binary  nodes that need to
 // be replaced, and creates the corresponding replacement nodes. However,
@@ -28,6 +29,10 @@ class UnfoldShortCircuitAST : public TIntermTraverser
     bool visitBinary(Visit visit, TIntermBinary *) override;
 };
 
+// Queues an UnfoldShortCircuitAST traverser in |passes|, so that it can share a traversal with
+// other passes.
+void QueueUnfoldShortCircuitAST(TPassManager *passes);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_UNFOLDSHORTCIRCUITAST_H_
@@ -0,0 +1,127 @@
+#!/usr/bin/python
+# Copyright 2017 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+# gen_glslang_keywords.py:
+#  Code generation for the keyword table of the GLSL ES lexer. The keywords and reserved words are
+#  placed in a perfect hash table, so glslang_lex.cpp classifies an identifier with one hash of its
+#  text and at most one string comparison.
+
+from datetime import date
+import json
+import os
+
+template_inl = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+//
+// Copyright {copyright_year} The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// glslang_keywords_autogen.inl:
+//   Perfect hash table of the GLSL ES keywords and reserved words, included by glslang_lex.cpp.
+
+namespace
+{{
+
+constexpr size_t kMinKeywordLength = {min_length};
+constexpr size_t kMaxKeywordLength = {max_length};
+
+const Keyword kKeywords[] = {{
+{keywords}}};
+
+constexpr uint32_t kKeywordBucketCount = {bucket_count};
+const uint16_t kKeywordDisplacements[kKeywordBucketCount] = {{
+{displacements}}};
+
+// The index in kKeywords plus one of the keyword in each slot, or zero for an empty slot.
+constexpr uint32_t kKeywordSlotBits = {slot_bits};
+const uint8_t kKeywordSlots[1u << kKeywordSlotBits] = {{
+{slots}}};
+
+}}  // anonymous namespace
+"""
+
+# Must match HashKeyword in glslang_lex.cpp: FNV-1a of the text.
+def hash_keyword(text):
+    value = 2166136261
+    for c in text:
+        value = ((value ^ ord(c)) * 16777619) & 0xFFFFFFFF
+    return value
+
+# Must match FindKeyword in glslang_lex.cpp.
+def keyword_slot(value, displacement, slot_bits):
+    return (((value ^ displacement) * 0x9E3779B1) & 0xFFFFFFFF) >> (32 - slot_bits)
+
+# Assigns a displacement to every bucket, largest buckets first, so that no two keywords share a
+# slot. Returns None if some bucket has no such displacement.
+def build_table(hashes, bucket_count, slot_bits):
+    buckets = [[] for _ in range(bucket_count)]
+    for index, value in enumerate(hashes):
+        buckets[value % bucket_count].append(index)
+
+    slots = [0] * (1 << slot_bits)
+    displacements = [0] * bucket_count
+    for bucket in sorted(range(bucket_count), key=lambda b: (-len(buckets[b]), b)):
+        for displacement in range(1 << 16):
+            candidate = [keyword_slot(hashes[index], displacement, slot_bits)
+                         for index in buckets[bucket]]
+            if len(set(candidate)) == len(candidate) and all(slots[s] == 0 for s in candidate):
+                for index, slot in zip(buckets[bucket], candidate):
+                    slots[slot] = index + 1
+                displacements[bucket] = displacement
+                break
+        else:
+            return None
+    return displacements, slots
+
+def format_list(values, per_line):
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[start:start + per_line]) + ',\n')
+    return ''.join(lines)
+
+def main():
+    data_source_name = 'glslang_keywords_data.json'
+    with open(data_source_name) as data_file:
+        data = json.load(data_file)
+
+    keywords = []
+    for rule, words in data.items():
+        if isinstance(words, dict):
+            keywords += [(word, token, rule) for word, token in words.items()]
+        else:
+            keywords += [(word, '0', rule) for word in words]
+    keywords.sort()
+
+    # Slots are stored in a byte.
+    assert len(keywords) < 256
+
+    hashes = [hash_keyword(word) for word, _, _ in keywords]
+    table = None
+    for slot_bits in range(8, 12):
+        table = build_table(hashes, 64, slot_bits)
+        if table:
+            break
+    assert table, 'no perfect hash table found'
+    displacements, slots = table
+
+    keyword_lines = ''.join('    {{"{0}", {1}, {2}, KeywordRule::{3}}},\n'.format(
+        word, len(word), token, rule) for word, token, rule in keywords)
+
+    with open('glslang_keywords_autogen.inl', 'wt') as out_file:
+        out_file.write(template_inl.format(
+            script_name=os.path.basename(__file__),
+            data_source_name=data_source_name,
+            copyright_year=date.today().year,
+            min_length=min(len(word) for word, _, _ in keywords),
+            max_length=max(len(word) for word, _, _ in keywords),
+            keywords=keyword_lines,
+            bucket_count=len(displacements),
+            displacements=format_list(displacements, 12),
+            slot_bits=slot_bits,
+            slots=format_list(slots, 16)))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,233 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by gen_glslang_keywords.py using data from glslang_keywords_data.json.
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// glslang_keywords_autogen.inl:
+//   Perfect hash table of the GLSL ES keywords and reserved words, included by glslang_lex.cpp.
+
+namespace
+{
+
+constexpr size_t kMinKeywordLength = 2;
+constexpr size_t kMaxKeywordLength = 25;
+
+const Keyword kKeywords[] = {
+    {"__samplerExternal2DY2YEXT", 25, SAMPLEREXTERNAL2DY2YEXT, KeywordRule::YUVTargetKeyword},
+    {"active", 6, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"asm", 3, 0, KeywordRule::Reserved},
+    {"atomic_uint", 11, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"attribute", 9, ATTRIBUTE, KeywordRule::ES2Keyword_ES3Reserved},
+    {"bool", 4, BOOL_TYPE, KeywordRule::Keyword},
+    {"break", 5, BREAK, KeywordRule::Keyword},
+    {"bvec2", 5, BVEC2, KeywordRule::Keyword},
+    {"bvec3", 5, BVEC3, KeywordRule::Keyword},
+    {"bvec4", 5, BVEC4, KeywordRule::Keyword},
+    {"case", 4, CASE, KeywordRule::ES2Ident_ES3Keyword},
+    {"cast", 4, 0, KeywordRule::Reserved},
+    {"centroid", 8, CENTROID, KeywordRule::ES2Ident_ES3Keyword},
+    {"class", 5, 0, KeywordRule::Reserved},
+    {"coherent", 8, COHERENT, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"common", 6, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"const", 5, CONST_QUAL, KeywordRule::Keyword},
+    {"continue", 8, CONTINUE, KeywordRule::Keyword},
+    {"default", 7, DEFAULT, KeywordRule::ES2Reserved_ES3Keyword},
+    {"discard", 7, DISCARD, KeywordRule::Keyword},
+    {"do", 2, DO, KeywordRule::Keyword},
+    {"double", 6, 0, KeywordRule::Reserved},
+    {"dvec2", 5, 0, KeywordRule::Reserved},
+    {"dvec3", 5, 0, KeywordRule::Reserved},
+    {"dvec4", 5, 0, KeywordRule::Reserved},
+    {"else", 4, ELSE, KeywordRule::Keyword},
+    {"enum", 4, 0, KeywordRule::Reserved},
+    {"extern", 6, 0, KeywordRule::Reserved},
+    {"external", 8, 0, KeywordRule::Reserved},
+    {"false", 5, BOOLCONSTANT, KeywordRule::BoolConstant},
+    {"filter", 6, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"fixed", 5, 0, KeywordRule::Reserved},
+    {"flat", 4, FLAT, KeywordRule::ES2Reserved_ES3Keyword},
+    {"float", 5, FLOAT_TYPE, KeywordRule::Keyword},
+    {"for", 3, FOR, KeywordRule::Keyword},
+    {"fvec2", 5, 0, KeywordRule::Reserved},
+    {"fvec3", 5, 0, KeywordRule::Reserved},
+    {"fvec4", 5, 0, KeywordRule::Reserved},
+    {"goto", 4, 0, KeywordRule::Reserved},
+    {"half", 4, 0, KeywordRule::Reserved},
+    {"highp", 5, HIGH_PRECISION, KeywordRule::Keyword},
+    {"hvec2", 5, 0, KeywordRule::Reserved},
+    {"hvec3", 5, 0, KeywordRule::Reserved},
+    {"hvec4", 5, 0, KeywordRule::Reserved},
+    {"if", 2, IF, KeywordRule::Keyword},
+    {"iimage1D", 8, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"iimage1DArray", 13, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"iimage2D", 8, IIMAGE2D, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"iimage2DArray", 13, IIMAGE2DARRAY, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"iimage3D", 8, IIMAGE3D, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"iimageBuffer", 12, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"iimageCube", 10, IIMAGECUBE, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"image1D", 7, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"image1DArray", 12, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"image1DArrayShadow", 18, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"image1DShadow", 13, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"image2D", 7, IMAGE2D, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"image2DArray", 12, IMAGE2DARRAY, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"image2DArrayShadow", 18, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"image2DShadow", 13, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"image3D", 7, IMAGE3D, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"imageBuffer", 11, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"imageCube", 9, IMAGECUBE, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"in", 2, IN_QUAL, KeywordRule::Keyword},
+    {"inline", 6, 0, KeywordRule::Reserved},
+    {"inout", 5, INOUT_QUAL, KeywordRule::Keyword},
+    {"input", 5, 0, KeywordRule::Reserved},
+    {"int", 3, INT_TYPE, KeywordRule::Keyword},
+    {"interface", 9, 0, KeywordRule::Reserved},
+    {"invariant", 9, INVARIANT, KeywordRule::Keyword},
+    {"isampler1D", 10, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"isampler1DArray", 15, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"isampler2D", 10, ISAMPLER2D, KeywordRule::ES2Ident_ES3Keyword},
+    {"isampler2DArray", 15, ISAMPLER2DARRAY, KeywordRule::ES2Ident_ES3Keyword},
+    {"isampler2DMS", 12, ISAMPLER2DMS, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"isampler2DMSArray", 17, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"isampler2DRect", 14, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"isampler3D", 10, ISAMPLER3D, KeywordRule::ES2Ident_ES3Keyword},
+    {"isamplerBuffer", 14, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"isamplerCube", 12, ISAMPLERCUBE, KeywordRule::ES2Ident_ES3Keyword},
+    {"itu_601", 7, YUVCSCSTANDARDEXTCONSTANT, KeywordRule::YUVCscStandardConstant},
+    {"itu_601_full_range", 18, YUVCSCSTANDARDEXTCONSTANT, KeywordRule::YUVCscStandardConstant},
+    {"itu_709", 7, YUVCSCSTANDARDEXTCONSTANT, KeywordRule::YUVCscStandardConstant},
+    {"ivec2", 5, IVEC2, KeywordRule::Keyword},
+    {"ivec3", 5, IVEC3, KeywordRule::Keyword},
+    {"ivec4", 5, IVEC4, KeywordRule::Keyword},
+    {"layout", 6, LAYOUT, KeywordRule::ES2Ident_ES3Keyword},
+    {"long", 4, 0, KeywordRule::Reserved},
+    {"lowp", 4, LOW_PRECISION, KeywordRule::Keyword},
+    {"mat2", 4, MATRIX2, KeywordRule::Keyword},
+    {"mat2x2", 6, MATRIX2, KeywordRule::ES2Ident_ES3Keyword},
+    {"mat2x3", 6, MATRIX2x3, KeywordRule::ES2Ident_ES3Keyword},
+    {"mat2x4", 6, MATRIX2x4, KeywordRule::ES2Ident_ES3Keyword},
+    {"mat3", 4, MATRIX3, KeywordRule::Keyword},
+    {"mat3x2", 6, MATRIX3x2, KeywordRule::ES2Ident_ES3Keyword},
+    {"mat3x3", 6, MATRIX3, KeywordRule::ES2Ident_ES3Keyword},
+    {"mat3x4", 6, MATRIX3x4, KeywordRule::ES2Ident_ES3Keyword},
+    {"mat4", 4, MATRIX4, KeywordRule::Keyword},
+    {"mat4x2", 6, MATRIX4x2, KeywordRule::ES2Ident_ES3Keyword},
+    {"mat4x3", 6, MATRIX4x3, KeywordRule::ES2Ident_ES3Keyword},
+    {"mat4x4", 6, MATRIX4, KeywordRule::ES2Ident_ES3Keyword},
+    {"mediump", 7, MEDIUM_PRECISION, KeywordRule::Keyword},
+    {"namespace", 9, 0, KeywordRule::Reserved},
+    {"noinline", 8, 0, KeywordRule::Reserved},
+    {"noperspective", 13, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"out", 3, OUT_QUAL, KeywordRule::Keyword},
+    {"output", 6, 0, KeywordRule::Reserved},
+    {"packed", 6, 0, KeywordRule::ES2Reserved_ES3Ident},
+    {"partition", 9, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"patch", 5, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"precision", 9, PRECISION, KeywordRule::Keyword},
+    {"public", 6, 0, KeywordRule::Reserved},
+    {"readonly", 8, READONLY, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"resource", 8, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"restrict", 8, RESTRICT, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"return", 6, RETURN, KeywordRule::Keyword},
+    {"sample", 6, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"sampler1D", 9, 0, KeywordRule::Reserved},
+    {"sampler1DArray", 14, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"sampler1DArrayShadow", 20, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"sampler1DShadow", 15, 0, KeywordRule::Reserved},
+    {"sampler2D", 9, SAMPLER2D, KeywordRule::Keyword},
+    {"sampler2DArray", 14, SAMPLER2DARRAY, KeywordRule::ES2Ident_ES3Keyword},
+    {"sampler2DArrayShadow", 20, SAMPLER2DARRAYSHADOW, KeywordRule::ES2Ident_ES3Keyword},
+    {"sampler2DMS", 11, SAMPLER2DMS, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"sampler2DMSArray", 16, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"sampler2DRect", 13, SAMPLER2DRECT, KeywordRule::Keyword},
+    {"sampler2DRectShadow", 19, 0, KeywordRule::Reserved},
+    {"sampler2DShadow", 15, SAMPLER2DSHADOW, KeywordRule::ES2Reserved_ES3Keyword},
+    {"sampler3D", 9, SAMPLER3D, KeywordRule::ES2Reserved_ES3Keyword},
+    {"sampler3DRect", 13, SAMPLER3DRECT, KeywordRule::ES2Reserved_ES3Keyword},
+    {"samplerBuffer", 13, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"samplerCube", 11, SAMPLERCUBE, KeywordRule::Keyword},
+    {"samplerCubeShadow", 17, SAMPLERCUBESHADOW, KeywordRule::ES2Ident_ES3Keyword},
+    {"samplerExternalOES", 18, SAMPLER_EXTERNAL_OES, KeywordRule::Keyword},
+    {"shared", 6, SHARED, KeywordRule::ES2AndES3Ident_ES31Keyword},
+    {"short", 5, 0, KeywordRule::Reserved},
+    {"sizeof", 6, 0, KeywordRule::Reserved},
+    {"smooth", 6, SMOOTH, KeywordRule::ES2Ident_ES3Keyword},
+    {"static", 6, 0, KeywordRule::Reserved},
+    {"struct", 6, STRUCT, KeywordRule::Keyword},
+    {"subroutine", 10, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"superp", 6, 0, KeywordRule::Reserved},
+    {"switch", 6, SWITCH, KeywordRule::ES2Reserved_ES3Keyword},
+    {"template", 8, 0, KeywordRule::Reserved},
+    {"this", 4, 0, KeywordRule::Reserved},
+    {"true", 4, BOOLCONSTANT, KeywordRule::BoolConstant},
+    {"typedef", 7, 0, KeywordRule::Reserved},
+    {"uimage1D", 8, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"uimage1DArray", 13, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"uimage2D", 8, UIMAGE2D, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"uimage2DArray", 13, UIMAGE2DARRAY, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"uimage3D", 8, UIMAGE3D, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"uimageBuffer", 12, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"uimageCube", 10, UIMAGECUBE, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"uint", 4, UINT_TYPE, KeywordRule::ES2Ident_ES3Keyword},
+    {"uniform", 7, UNIFORM, KeywordRule::Keyword},
+    {"union", 5, 0, KeywordRule::Reserved},
+    {"unsigned", 8, 0, KeywordRule::Reserved},
+    {"usampler1D", 10, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"usampler1DArray", 15, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"usampler2D", 10, USAMPLER2D, KeywordRule::ES2Ident_ES3Keyword},
+    {"usampler2DArray", 15, USAMPLER2DARRAY, KeywordRule::ES2Ident_ES3Keyword},
+    {"usampler2DMS", 12, USAMPLER2DMS, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"usampler2DMSArray", 17, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"usampler2DRect", 14, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"usampler3D", 10, USAMPLER3D, KeywordRule::ES2Ident_ES3Keyword},
+    {"usamplerBuffer", 14, 0, KeywordRule::ES2Ident_ES3Reserved},
+    {"usamplerCube", 12, USAMPLERCUBE, KeywordRule::ES2Ident_ES3Keyword},
+    {"using", 5, 0, KeywordRule::Reserved},
+    {"uvec2", 5, UVEC2, KeywordRule::ES2Ident_ES3Keyword},
+    {"uvec3", 5, UVEC3, KeywordRule::ES2Ident_ES3Keyword},
+    {"uvec4", 5, UVEC4, KeywordRule::ES2Ident_ES3Keyword},
+    {"varying", 7, VARYING, KeywordRule::ES2Keyword_ES3Reserved},
+    {"vec2", 4, VEC2, KeywordRule::Keyword},
+    {"vec3", 4, VEC3, KeywordRule::Keyword},
+    {"vec4", 4, VEC4, KeywordRule::Keyword},
+    {"void", 4, VOID_TYPE, KeywordRule::Keyword},
+    {"volatile", 8, VOLATILE, KeywordRule::ES2AndES3Reserved_ES31Keyword},
+    {"while", 5, WHILE, KeywordRule::Keyword},
+    {"writeonly", 9, WRITEONLY, KeywordRule::ES2Ident_ES3Reserved_ES31Keyword},
+    {"yuvCscStandardEXT", 17, YUVCSCSTANDARDEXT, KeywordRule::YUVTargetKeyword},
+};
+
+constexpr uint32_t kKeywordBucketCount = 64;
+const uint16_t kKeywordDisplacements[kKeywordBucketCount] = {
+    3, 1, 0, 6, 0, 7, 2, 0, 8, 5, 1, 5,
+    6, 5, 1, 1, 0, 6, 11, 8, 0, 7, 1, 6,
+    7, 2, 0, 1, 0, 6, 0, 2, 0, 12, 3, 0,
+    0, 1, 0, 0, 1, 2, 8, 0, 0, 6, 1, 2,
+    0, 6, 4, 11, 11, 12, 0, 0, 1, 2, 10, 1,
+    0, 20, 4, 0,
+};
+
+// The index in kKeywords plus one of the keyword in each slot, or zero for an empty slot.
+constexpr uint32_t kKeywordSlotBits = 8;
+const uint8_t kKeywordSlots[1u << kKeywordSlotBits] = {
+    178, 173, 0, 0, 0, 0, 0, 74, 0, 136, 48, 111, 0, 0, 116, 139,
+    179, 99, 32, 24, 97, 13, 44, 29, 33, 0, 113, 0, 0, 141, 83, 96,
+    148, 0, 10, 104, 58, 0, 153, 0, 121, 0, 0, 0, 91, 68, 170, 0,
+    81, 0, 132, 135, 101, 98, 172, 73, 0, 0, 0, 156, 21, 42, 7, 144,
+    79, 162, 0, 6, 145, 0, 39, 0, 54, 12, 67, 181, 70, 160, 82, 0,
+    112, 85, 127, 30, 77, 47, 45, 89, 182, 0, 102, 0, 95, 93, 0, 0,
+    52, 157, 126, 17, 43, 0, 51, 0, 0, 50, 92, 155, 0, 0, 0, 169,
+    34, 55, 147, 171, 0, 5, 0, 122, 0, 161, 78, 123, 0, 0, 0, 159,
+    59, 174, 3, 62, 26, 27, 115, 90, 140, 56, 46, 0, 100, 25, 84, 167,
+    0, 86, 0, 76, 138, 22, 107, 150, 0, 164, 0, 19, 119, 110, 2, 94,
+    31, 66, 175, 163, 0, 64, 0, 131, 0, 0, 0, 151, 0, 118, 0, 14,
+    168, 0, 63, 133, 0, 180, 41, 69, 128, 0, 28, 72, 137, 49, 0, 57,
+    165, 166, 154, 114, 106, 143, 0, 75, 146, 176, 0, 120, 15, 1, 4, 0,
+    0, 35, 0, 80, 20, 8, 23, 130, 177, 152, 16, 0, 36, 37, 125, 0,
+    87, 88, 0, 105, 60, 0, 18, 65, 38, 103, 134, 158, 129, 9, 109, 0,
+    108, 61, 0, 124, 0, 0, 53, 0, 71, 40, 0, 149, 0, 11, 142, 117,
+};
+
+}  // anonymous namespace
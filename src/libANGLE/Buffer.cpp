@@ -198,16 +198,8 @@ Error Buffer::getIndexRange(GLenum type,
                             bool primitiveRestartEnabled,
                             IndexRange *outRange) const
 {
-    if (mIndexRangeCache.findRange(type, offset, count, primitiveRestartEnabled, outRange))
-    {
-        return NoError();
-    }
-
-    ANGLE_TRY(mImpl->getIndexRange(type, offset, count, primitiveRestartEnabled, outRange));
-
-    mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
-
-    return NoError();
+    return mIndexRangeCache.getIndexRange(mImpl, static_cast<size_t>(mState.mSize), type, offset,
+                                          count, primitiveRestartEnabled, outRange);
 }
 
 }  // namespace gl
@@ -197,6 +197,7 @@ Extensions::Extensions()
       maxDebugGroupStackDepth(0),
       maxLabelLength(0),
       noError(false),
+      parallelShaderCompile(false),
       lossyETCDecode(false),
       bindUniformLocation(false),
       syncQuery(false),
@@ -630,8 +631,8 @@ const ExtensionInfoMap &GetExtensionInfoMap()
         map["GL_EXT_color_buffer_float"] = esOnlyExtension(&Extensions::colorBufferFloat);
         map["GL_OES_vertex_array_object"] = esOnlyExtension(&Extensions::vertexArrayObject);
         map["GL_KHR_debug"] = esOnlyExtension(&Extensions::debug);
-        // TODO(jmadill): Enable this when complete.
-        //map["GL_KHR_no_error"] = esOnlyExtension(&Extensions::noError);
+        map["GL_KHR_no_error"] = esOnlyExtension(&Extensions::noError);
+        map["GL_KHR_parallel_shader_compile"] = esOnlyExtension(&Extensions::parallelShaderCompile);
         map["GL_ANGLE_lossy_etc_decode"] = esOnlyExtension(&Extensions::lossyETCDecode);
         map["GL_CHROMIUM_bind_uniform_location"] = esOnlyExtension(&Extensions::bindUniformLocation);
         map["GL_CHROMIUM_sync_query"] = esOnlyExtension(&Extensions::syncQuery);
@@ -1085,8 +1086,7 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_ANGLE_display_texture_share_group",               displayTextureShareGroup,           &extensionStrings);
     InsertExtensionString("EGL_ANGLE_create_context_client_arrays",              createContextClientArrays,          &extensionStrings);
     InsertExtensionString("EGL_ANGLE_create_context_robust_resource_initialization", createContextRobustResourceInitialization, &extensionStrings);
-    // TODO(jmadill): Enable this when complete.
-    //InsertExtensionString("KHR_create_context_no_error",                       createContextNoError,               &extensionStrings);
+    InsertExtensionString("EGL_KHR_create_context_no_error",                     createContextNoError,               &extensionStrings);
     // clang-format on
 
     return extensionStrings;
@@ -47,10 +47,7 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const ContextState &state)
                              state.getClientMinorVersion(),
                              state.getExtensions().webglCompatibility)),
       mOutputType(mImplementation->getTranslatorOutputType()),
-      mResources(),
-      mFragmentCompiler(nullptr),
-      mVertexCompiler(nullptr),
-      mComputeCompiler(nullptr)
+      mResources()
 {
     ASSERT(state.getClientMajorVersion() == 2 || state.getClientMajorVersion() == 3);
 
@@ -126,76 +123,69 @@ Compiler::~Compiler()
 
 Error Compiler::release()
 {
-    if (mFragmentCompiler)
+    for (std::vector<ShHandle> *pool : {&mFragmentCompilers, &mVertexCompilers, &mComputeCompilers})
     {
-        sh::Destruct(mFragmentCompiler);
-        mFragmentCompiler = nullptr;
+        for (ShHandle handle : *pool)
+        {
+            sh::Destruct(handle);
 
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+            ASSERT(activeCompilerHandles > 0);
+            activeCompilerHandles--;
+        }
+        pool->clear();
     }
 
-    if (mVertexCompiler)
+    if (activeCompilerHandles == 0)
     {
-        sh::Destruct(mVertexCompiler);
-        mVertexCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+        sh::Finalize();
     }
 
-    if (mComputeCompiler)
-    {
-        sh::Destruct(mComputeCompiler);
-        mComputeCompiler = nullptr;
+    mImplementation->release();
 
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+    return gl::NoError();
+}
+
+ShHandle Compiler::getInstance(GLenum type)
+{
+    std::vector<ShHandle> *pool = getPool(type);
+    if (!pool->empty())
+    {
+        ShHandle handle = pool->back();
+        pool->pop_back();
+        return handle;
     }
 
     if (activeCompilerHandles == 0)
     {
-        sh::Finalize();
+        sh::Initialize();
     }
 
-    mImplementation->release();
+    ShHandle handle = sh::ConstructCompiler(type, mSpec, mOutputType, &mResources);
+    ASSERT(handle);
+    activeCompilerHandles++;
 
-    return gl::NoError();
+    return handle;
 }
 
-ShHandle Compiler::getCompilerHandle(GLenum type)
+void Compiler::putInstance(GLenum type, ShHandle handle)
+{
+    getPool(type)->push_back(handle);
+}
+
+std::vector<ShHandle> *Compiler::getPool(GLenum type)
 {
-    ShHandle *compiler = nullptr;
     switch (type)
     {
         case GL_VERTEX_SHADER:
-            compiler = &mVertexCompiler;
-            break;
-
+            return &mVertexCompilers;
         case GL_FRAGMENT_SHADER:
-            compiler = &mFragmentCompiler;
-            break;
+            return &mFragmentCompilers;
         case GL_COMPUTE_SHADER:
-            compiler = &mComputeCompiler;
-            break;
+            return &mComputeCompilers;
         default:
             UNREACHABLE();
             return nullptr;
     }
-
-    if (!(*compiler))
-    {
-        if (activeCompilerHandles == 0)
-        {
-            sh::Initialize();
-        }
-
-        *compiler = sh::ConstructCompiler(type, mSpec, mOutputType, &mResources);
-        ASSERT(*compiler);
-        activeCompilerHandles++;
-    }
-
-    return *compiler;
 }
 
 }  // namespace gl
@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <vector>
+
 #include "libANGLE/Error.h"
 #include "GLSLANG/ShaderLang.h"
 
@@ -29,20 +31,28 @@ class Compiler final : angle::NonCopyable
     Compiler(rx::GLImplFactory *implFactory, const ContextState &data);
     ~Compiler();
 
+    // Releases the compiler handles that aren't used by a compile.
     Error release();
 
-    ShHandle getCompilerHandle(GLenum type);
+    // A handle is used by one compile at a time, which may run on a worker thread. Shaders of the
+    // same type compiled at the same time get their own handles, which are kept for later
+    // compiles once they are put back.
+    ShHandle getInstance(GLenum type);
+    void putInstance(GLenum type, ShHandle handle);
+
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
 
   private:
+    std::vector<ShHandle> *getPool(GLenum type);
+
     rx::CompilerImpl *mImplementation;
     ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
     ShBuiltInResources mResources;
 
-    ShHandle mFragmentCompiler;
-    ShHandle mVertexCompiler;
-    ShHandle mComputeCompiler;
+    std::vector<ShHandle> mFragmentCompilers;
+    std::vector<ShHandle> mVertexCompilers;
+    std::vector<ShHandle> mComputeCompilers;
 };
 
 }  // namespace gl
@@ -31,6 +31,9 @@ enum
 
     IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS = 4,
 
+    // Bounds the combined texture image units, so texture units fit in a bitset.
+    IMPLEMENTATION_MAX_ACTIVE_TEXTURES = 64,
+
     // These are the maximums the implementation can support
     // The actual GL caps are limited by the device caps
     // and should be queried from the Context
@@ -249,7 +249,9 @@ Context::Context(rx::EGLImplFactory *implFactory,
                  const Context *shareContext,
                  TextureManager *shareTextures,
                  const egl::AttributeMap &attribs,
-                 const egl::DisplayExtensions &displayExtensions)
+                 const egl::DisplayExtensions &displayExtensions,
+                 MemoryProgramCache *memoryProgramCache,
+                 angle::WorkerThreadPool *workerThreadPool)
 
     : ValidationContext(shareContext,
                         shareTextures,
@@ -273,7 +275,9 @@ Context::Context(rx::EGLImplFactory *implFactory,
       mCurrentSurface(nullptr),
       mSurfacelessFramebuffer(nullptr),
       mWebGLContext(GetWebGLContext(attribs)),
-      mScratchBuffer(1000u)
+      mScratchBuffer(1000u),
+      mMemoryProgramCache(memoryProgramCache),
+      mWorkerThreadPool(workerThreadPool)
 {
     if (mRobustAccess)
     {
@@ -449,6 +453,7 @@ void Context::destroy(egl::Display *display)
 
     releaseSurface(display);
 
+    mState.mShaderPrograms->resolveCompilesAndLinks();
     SafeDelete(mCompiler);
 
     mState.mBuffers->release(this);
@@ -602,8 +607,8 @@ GLuint Context::createPaths(GLsizei range)
 
 GLuint Context::createVertexArray()
 {
-    GLuint vertexArray           = mVertexArrayHandleAllocator.allocate();
-    mVertexArrayMap[vertexArray] = nullptr;
+    GLuint vertexArray = mVertexArrayHandleAllocator.allocate();
+    mVertexArrayMap.assign(vertexArray, nullptr);
     return vertexArray;
 }
 
@@ -614,8 +619,8 @@ GLuint Context::createSampler()
 
 GLuint Context::createTransformFeedback()
 {
-    GLuint transformFeedback                 = mTransformFeedbackAllocator.allocate();
-    mTransformFeedbackMap[transformFeedback] = nullptr;
+    GLuint transformFeedback = mTransformFeedbackAllocator.allocate();
+    mTransformFeedbackMap.assign(transformFeedback, nullptr);
     return transformFeedback;
 }
 
@@ -629,7 +634,7 @@ GLuint Context::createFenceNV()
 {
     GLuint handle = mFenceNVHandleAllocator.allocate();
 
-    mFenceNVMap[handle] = new FenceNV(mImplementation->createFenceNV());
+    mFenceNVMap.assign(handle, new FenceNV(mImplementation->createFenceNV()));
 
     return handle;
 }
@@ -639,7 +644,7 @@ GLuint Context::createQuery()
 {
     GLuint handle = mQueryHandleAllocator.allocate();
 
-    mQueryMap[handle] = NULL;
+    mQueryMap.assign(handle, nullptr);
 
     return handle;
 }
@@ -786,17 +791,15 @@ void Context::setPathStencilFunc(GLenum func, GLint ref, GLuint mask)
 
 void Context::deleteVertexArray(GLuint vertexArray)
 {
-    auto iter = mVertexArrayMap.find(vertexArray);
-    if (iter != mVertexArrayMap.end())
+    VertexArray *vertexArrayObject = nullptr;
+    if (mVertexArrayMap.erase(vertexArray, &vertexArrayObject))
     {
-        VertexArray *vertexArrayObject = iter->second;
         if (vertexArrayObject != nullptr)
         {
             detachVertexArray(vertexArray);
             delete vertexArrayObject;
         }
 
-        mVertexArrayMap.erase(iter);
         mVertexArrayHandleAllocator.release(vertexArray);
     }
 }
@@ -818,17 +821,15 @@ void Context::deleteTransformFeedback(GLuint transformFeedback)
         return;
     }
 
-    auto iter = mTransformFeedbackMap.find(transformFeedback);
-    if (iter != mTransformFeedbackMap.end())
+    TransformFeedback *transformFeedbackObject = nullptr;
+    if (mTransformFeedbackMap.erase(transformFeedback, &transformFeedbackObject))
     {
-        TransformFeedback *transformFeedbackObject = iter->second;
         if (transformFeedbackObject != nullptr)
         {
             detachTransformFeedback(transformFeedback);
             transformFeedbackObject->release(this);
         }
 
-        mTransformFeedbackMap.erase(iter);
         mTransformFeedbackAllocator.release(transformFeedback);
     }
 }
@@ -845,27 +846,24 @@ void Context::deleteFramebuffer(GLuint framebuffer)
 
 void Context::deleteFenceNV(GLuint fence)
 {
-    auto fenceObject = mFenceNVMap.find(fence);
-
-    if (fenceObject != mFenceNVMap.end())
+    FenceNV *fenceObject = nullptr;
+    if (mFenceNVMap.erase(fence, &fenceObject))
     {
-        mFenceNVHandleAllocator.release(fenceObject->first);
-        delete fenceObject->second;
-        mFenceNVMap.erase(fenceObject);
+        mFenceNVHandleAllocator.release(fence);
+        delete fenceObject;
     }
 }
 
 void Context::deleteQuery(GLuint query)
 {
-    auto queryObject = mQueryMap.find(query);
-    if (queryObject != mQueryMap.end())
+    Query *queryObject = nullptr;
+    if (mQueryMap.erase(query, &queryObject))
     {
-        mQueryHandleAllocator.release(queryObject->first);
-        if (queryObject->second)
+        mQueryHandleAllocator.release(query);
+        if (queryObject)
         {
-            queryObject->second->release();
+            queryObject->release();
         }
-        mQueryMap.erase(queryObject);
     }
 }
 
@@ -892,8 +890,7 @@ FenceSync *Context::getFenceSync(GLsync handle) const
 
 VertexArray *Context::getVertexArray(GLuint handle) const
 {
-    auto vertexArray = mVertexArrayMap.find(handle);
-    return (vertexArray != mVertexArrayMap.end()) ? vertexArray->second : nullptr;
+    return mVertexArrayMap.query(handle);
 }
 
 Sampler *Context::getSampler(GLuint handle) const
@@ -903,8 +900,7 @@ Sampler *Context::getSampler(GLuint handle) const
 
 TransformFeedback *Context::getTransformFeedback(GLuint handle) const
 {
-    auto iter = mTransformFeedbackMap.find(handle);
-    return (iter != mTransformFeedbackMap.end()) ? iter->second : nullptr;
+    return mTransformFeedbackMap.query(handle);
 }
 
 LabeledObject *Context::getLabeledObject(GLenum identifier, GLuint name) const
@@ -1254,41 +1250,29 @@ Framebuffer *Context::getFramebuffer(GLuint handle) const
 
 FenceNV *Context::getFenceNV(unsigned int handle)
 {
-    auto fence = mFenceNVMap.find(handle);
-
-    if (fence == mFenceNVMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return fence->second;
-    }
+    return mFenceNVMap.query(handle);
 }
 
 Query *Context::getQuery(unsigned int handle, bool create, GLenum type)
 {
-    auto query = mQueryMap.find(handle);
-
-    if (query == mQueryMap.end())
+    if (!mQueryMap.contains(handle))
     {
-        return NULL;
+        return nullptr;
     }
-    else
+
+    Query *query = mQueryMap.query(handle);
+    if (!query && create)
     {
-        if (!query->second && create)
-        {
-            query->second = new Query(mImplementation->createQuery(type), handle);
-            query->second->addRef();
-        }
-        return query->second;
+        query = new Query(mImplementation->createQuery(type), handle);
+        query->addRef();
+        mQueryMap.assign(handle, query);
     }
+    return query;
 }
 
 Query *Context::getQuery(GLuint handle) const
 {
-    auto iter = mQueryMap.find(handle);
-    return (iter != mQueryMap.end()) ? iter->second : nullptr;
+    return mQueryMap.query(handle);
 }
 
 Texture *Context::getTargetTexture(GLenum target) const
@@ -2220,7 +2204,7 @@ VertexArray *Context::checkVertexArrayAllocation(GLuint vertexArrayHandle)
         vertexArray = new VertexArray(mImplementation.get(), vertexArrayHandle,
                                       mCaps.maxVertexAttributes, mCaps.maxVertexAttribBindings);
 
-        mVertexArrayMap[vertexArrayHandle] = vertexArray;
+        mVertexArrayMap.assign(vertexArrayHandle, vertexArray);
     }
 
     return vertexArray;
@@ -2235,7 +2219,7 @@ TransformFeedback *Context::checkTransformFeedbackAllocation(GLuint transformFee
         transformFeedback =
             new TransformFeedback(mImplementation.get(), transformFeedbackHandle, mCaps);
         transformFeedback->addRef();
-        mTransformFeedbackMap[transformFeedbackHandle] = transformFeedback;
+        mTransformFeedbackMap.assign(transformFeedbackHandle, transformFeedback);
     }
 
     return transformFeedback;
@@ -2243,14 +2227,14 @@ TransformFeedback *Context::checkTransformFeedbackAllocation(GLuint transformFee
 
 bool Context::isVertexArrayGenerated(GLuint vertexArray)
 {
-    ASSERT(mVertexArrayMap.find(0) != mVertexArrayMap.end());
-    return mVertexArrayMap.find(vertexArray) != mVertexArrayMap.end();
+    ASSERT(mVertexArrayMap.contains(0));
+    return mVertexArrayMap.contains(vertexArray);
 }
 
 bool Context::isTransformFeedbackGenerated(GLuint transformFeedback)
 {
-    ASSERT(mTransformFeedbackMap.find(0) != mTransformFeedbackMap.end());
-    return mTransformFeedbackMap.find(transformFeedback) != mTransformFeedbackMap.end();
+    ASSERT(mTransformFeedbackMap.contains(0));
+    return mTransformFeedbackMap.contains(transformFeedback);
 }
 
 void Context::detachTexture(GLuint texture)
@@ -2514,6 +2498,7 @@ void Context::requestExtension(const char *name)
     initExtensionStrings();
 
     // Re-create the compiler with the requested extensions enabled.
+    mState.mShaderPrograms->resolveCompilesAndLinks();
     SafeDelete(mCompiler);
     mCompiler = new Compiler(mImplementation.get(), mState);
 
@@ -2582,6 +2567,7 @@ void Context::initCaps(const egl::DisplayExtensions &displayExtensions)
     mExtensions.bindGeneratesResource = true;
     mExtensions.clientArrays          = true;
     mExtensions.requestExtension      = true;
+    mExtensions.parallelShaderCompile = true;
 
     // Enable the no error extension if the context was created with the flag.
     mExtensions.noError = mSkipValidation;
@@ -3795,6 +3781,11 @@ void Context::popDebugGroup()
     mGLState.getDebug().popGroup();
 }
 
+void Context::maxShaderCompilerThreads(GLuint count)
+{
+    mGLState.setMaxShaderCompilerThreads(count);
+}
+
 void Context::bufferData(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage)
 {
     Buffer *buffer = mGLState.getTargetBuffer(target);
@@ -3816,12 +3807,17 @@ void Context::bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, con
 
 void Context::attachShader(GLuint program, GLuint shader)
 {
-    auto programObject = mState.mShaderPrograms->getProgram(program);
-    auto shaderObject  = mState.mShaderPrograms->getShader(shader);
+    auto programObject = getProgram(program);
+    auto shaderObject  = getShaderNoResolveCompile(shader);
     ASSERT(programObject && shaderObject);
     programObject->attachShader(shaderObject);
 }
 
+angle::WorkerThreadPool *Context::getWorkerThreadPool() const
+{
+    return mGLState.getMaxShaderCompilerThreads() > 0 ? mWorkerThreadPool : nullptr;
+}
+
 const Workarounds &Context::getWorkarounds() const
 {
     return mWorkarounds;
@@ -4049,6 +4045,7 @@ void Context::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGr
         return;
     }
 
+    mGLState.syncDirtyObject(this, GL_PROGRAM);
     mImplementation->dispatchCompute(numGroupsX, numGroupsY, numGroupsZ);
 }
 
@@ -4241,7 +4238,10 @@ void Context::getIntegerv(GLenum pname, GLint *params)
 
 void Context::getProgramiv(GLuint program, GLenum pname, GLint *params)
 {
-    Program *programObject = getProgram(program);
+    // Polling the completion status mustn't wait for the link.
+    Program *programObject = (pname == GL_COMPLETION_STATUS_KHR)
+                                 ? getProgramNoResolveLink(program)
+                                 : getProgram(program);
     ASSERT(programObject);
     QueryProgramiv(programObject, pname, params);
 }
@@ -4255,7 +4255,9 @@ void Context::getInfoLog(GLuint program, GLsizei bufsize, GLsizei *length, GLcha
 
 void Context::getShaderiv(GLuint shader, GLenum pname, GLint *params)
 {
-    Shader *shaderObject = getShader(shader);
+    Shader *shaderObject = (pname == GL_COMPLETION_STATUS_KHR)
+                               ? getShaderNoResolveCompile(shader)
+                               : getShader(shader);
     ASSERT(shaderObject);
     QueryShaderiv(shaderObject, pname, params);
 }
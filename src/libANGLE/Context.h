@@ -15,6 +15,7 @@
 
 #include "angle_gl.h"
 #include "common/MemoryBuffer.h"
+#include "common/WorkerThread.h"
 #include "common/angleutils.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Constants.h"
@@ -22,6 +23,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/RefCountObject.h"
+#include "libANGLE/ResourceMap.h"
 #include "libANGLE/VertexAttribute.h"
 #include "libANGLE/Workarounds.h"
 #include "libANGLE/angletypes.h"
@@ -49,6 +51,7 @@ class Framebuffer;
 class Renderbuffer;
 class FenceNV;
 class FenceSync;
+class MemoryProgramCache;
 class Query;
 class Buffer;
 struct VertexAttribute;
@@ -64,7 +67,9 @@ class Context final : public ValidationContext
             const Context *shareContext,
             TextureManager *shareTextures,
             const egl::AttributeMap &attribs,
-            const egl::DisplayExtensions &displayExtensions);
+            const egl::DisplayExtensions &displayExtensions,
+            MemoryProgramCache *memoryProgramCache,
+            angle::WorkerThreadPool *workerThreadPool);
 
     void destroy(egl::Display *display);
     ~Context() override;
@@ -338,6 +343,8 @@ class Context final : public ValidationContext
     void pushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message);
     void popDebugGroup();
 
+    void maxShaderCompilerThreads(GLuint count);
+
     void clear(GLbitfield mask);
     void clearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *values);
     void clearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *values);
@@ -776,6 +783,12 @@ class Context final : public ValidationContext
     rx::ContextImpl *getImplementation() const { return mImplementation.get(); }
     const Workarounds &getWorkarounds() const;
 
+    // Shared by all contexts of the display. Null when programs can't be loaded from binaries.
+    MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
+
+    // Shared by all contexts of the display. Null when compiles and links must not be deferred.
+    angle::WorkerThreadPool *getWorkerThreadPool() const;
+
     void getFramebufferParameteriv(GLenum target, GLenum pname, GLint *params);
     void setFramebufferParameteri(GLenum target, GLenum pname, GLint param);
 
@@ -878,6 +891,9 @@ class Context final : public ValidationContext
 
     // Not really a property of context state. The size and contexts change per-api-call.
     mutable angle::ScratchBuffer mScratchBuffer;
+
+    MemoryProgramCache *mMemoryProgramCache;
+    angle::WorkerThreadPool *mWorkerThreadPool;
 };
 
 }  // namespace gl
@@ -9,7 +9,9 @@
 #include "libANGLE/ContextState.h"
 
 #include "libANGLE/Framebuffer.h"
+#include "libANGLE/Program.h"
 #include "libANGLE/ResourceManager.h"
+#include "libANGLE/Shader.h"
 
 namespace gl
 {
@@ -336,6 +338,14 @@ bool ValidationContext::getQueryParameterInfo(GLenum pname, GLenum *type, unsign
             *type      = GL_INT;
             *numParams = 1;
             return true;
+        case GL_MAX_SHADER_COMPILER_THREADS_KHR:
+            if (!getExtensions().parallelShaderCompile)
+            {
+                return false;
+            }
+            *type      = GL_INT;
+            *numParams = 1;
+            return true;
         case GL_TEXTURE_BINDING_EXTERNAL_OES:
             if (!getExtensions().eglStreamConsumerExternal && !getExtensions().eglImageExternal)
             {
@@ -714,10 +724,30 @@ bool ValidationContext::getIndexedQueryParameterInfo(GLenum target,
 
 Program *ValidationContext::getProgram(GLuint handle) const
 {
-    return mState.mShaderPrograms->getProgram(handle);
+    Program *program = getProgramNoResolveLink(handle);
+    if (program)
+    {
+        program->resolveLink();
+    }
+    return program;
 }
 
 Shader *ValidationContext::getShader(GLuint handle) const
+{
+    Shader *shader = getShaderNoResolveCompile(handle);
+    if (shader)
+    {
+        shader->resolveCompile();
+    }
+    return shader;
+}
+
+Program *ValidationContext::getProgramNoResolveLink(GLuint handle) const
+{
+    return mState.mShaderPrograms->getProgram(handle);
+}
+
+Shader *ValidationContext::getShaderNoResolveCompile(GLuint handle) const
 {
     return mState.mShaderPrograms->getShader(handle);
 }
@@ -115,9 +115,13 @@ class ValidationContext : angle::NonCopyable
     bool getQueryParameterInfo(GLenum pname, GLenum *type, unsigned int *numParams);
     bool getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned int *numParams);
 
+    // Wait for the program's link and the shader's compile, which may run on worker threads.
     Program *getProgram(GLuint handle) const;
     Shader *getShader(GLuint handle) const;
 
+    Program *getProgramNoResolveLink(GLuint handle) const;
+    Shader *getShaderNoResolveCompile(GLuint handle) const;
+
     bool isTextureGenerated(GLuint texture) const;
     bool isBufferGenerated(GLuint buffer) const;
     bool isRenderbufferGenerated(GLuint renderbuffer) const;
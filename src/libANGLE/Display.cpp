@@ -14,6 +14,7 @@
 #include <iterator>
 #include <map>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include <platform/Platform.h>
@@ -27,6 +28,7 @@
 #include "libANGLE/Device.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/Image.h"
+#include "libANGLE/features.h"
 #include "libANGLE/Surface.h"
 #include "libANGLE/Stream.h"
 #include "libANGLE/ResourceManager.h"
@@ -68,6 +70,9 @@ namespace egl
 namespace
 {
 
+// Total size of the program binaries kept in the display's program cache.
+constexpr size_t kProgramCacheSizeBytes = 6 * 1024 * 1024;
+
 typedef std::map<EGLNativeWindowType, Surface*> WindowSurfaceMap;
 // Get a map of all EGL window surfaces to validate that no window has more than one EGL surface
 // associated with it.
@@ -358,7 +363,9 @@ Display::Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDe
       mDevice(eglDevice),
       mPlatform(platform),
       mTextureManager(nullptr),
-      mGlobalTextureShareGroupUsers(0)
+      mGlobalTextureShareGroupUsers(0),
+      mMemoryProgramCache(kProgramCacheSizeBytes),
+      mWorkerThreadPool(std::max(std::thread::hardware_concurrency(), 1u))
 {
 }
 
@@ -496,6 +503,9 @@ void Display::terminate()
 
     mConfigSet.clear();
 
+    // The binaries are only valid for the device they were made on.
+    mMemoryProgramCache.clear();
+
     if (mDevice != nullptr && mDevice->getOwningDisplay() != nullptr)
     {
         // Don't delete the device if it was created externally using eglCreateDeviceANGLE
@@ -694,8 +704,15 @@ Error Display::createContext(const Config *configuration, gl::Context *shareCont
         shareTextures = mTextureManager;
     }
 
+#if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
+    gl::MemoryProgramCache *cachePointer = &mMemoryProgramCache;
+#else
+    gl::MemoryProgramCache *cachePointer = nullptr;
+#endif
+
     gl::Context *context = new gl::Context(mImplementation, configuration, shareContext,
-                                           shareTextures, attribs, mDisplayExtensions);
+                                           shareTextures, attribs, mDisplayExtensions,
+                                           cachePointer, &mWorkerThreadPool);
 
     ASSERT(context != nullptr);
     mContextSet.insert(context);
@@ -14,11 +14,13 @@
 #include <set>
 #include <vector>
 
+#include "common/WorkerThread.h"
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/LoggingAnnotator.h"
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/Version.h"
 
 namespace gl
@@ -133,6 +135,8 @@ class Display final : angle::NonCopyable
 
     const DisplayState &getState() const { return mState; }
 
+    gl::MemoryProgramCache *getMemoryProgramCache() { return &mMemoryProgramCache; }
+
   private:
     Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDevice);
 
@@ -176,6 +180,11 @@ class Display final : angle::NonCopyable
 
     gl::TextureManager *mTextureManager;
     size_t mGlobalTextureShareGroupUsers;
+
+    gl::MemoryProgramCache mMemoryProgramCache;
+
+    // Runs the compiles and links of all contexts, for GL_KHR_parallel_shader_compile.
+    angle::WorkerThreadPool mWorkerThreadPool;
 };
 
 }  // namespace egl
@@ -291,6 +291,7 @@ Framebuffer::Framebuffer(const Caps &caps, rx::GLImplFactory *factory, GLuint id
       mImpl(factory->createFramebuffer(mState)),
       mId(id),
       mCachedStatus(),
+      mCompletenessSerial(0),
       mDirtyDepthAttachmentBinding(this, DIRTY_BIT_DEPTH_ATTACHMENT),
       mDirtyStencilAttachmentBinding(this, DIRTY_BIT_STENCIL_ATTACHMENT)
 {
@@ -310,6 +311,7 @@ Framebuffer::Framebuffer(egl::Surface *surface)
       mImpl(surface->getImplementation()->createDefaultFramebuffer(mState)),
       mId(0),
       mCachedStatus(GL_FRAMEBUFFER_COMPLETE),
+      mCompletenessSerial(0),
       mDirtyDepthAttachmentBinding(this, DIRTY_BIT_DEPTH_ATTACHMENT),
       mDirtyStencilAttachmentBinding(this, DIRTY_BIT_STENCIL_ATTACHMENT)
 {
@@ -335,6 +337,7 @@ Framebuffer::Framebuffer(rx::GLImplFactory *factory)
       mImpl(factory->createFramebuffer(mState)),
       mId(0),
       mCachedStatus(GL_FRAMEBUFFER_UNDEFINED_OES),
+      mCompletenessSerial(0),
       mDirtyDepthAttachmentBinding(this, DIRTY_BIT_DEPTH_ATTACHMENT),
       mDirtyStencilAttachmentBinding(this, DIRTY_BIT_STENCIL_ATTACHMENT)
 {
@@ -590,6 +593,7 @@ GLenum Framebuffer::checkStatus(const Context *context)
     if (hasAnyDirtyBit() || !mCachedStatus.valid())
     {
         mCachedStatus = checkStatusImpl(context);
+        mCompletenessSerial++;
     }
 
     return mCachedStatus.value();
@@ -195,6 +195,10 @@ class Framebuffer final : public LabeledObject, public OnAttachmentDirtyReceiver
 
     GLenum checkStatus(const Context *context);
 
+    // Incremented every time the completeness status is recomputed, i.e. after any change to the
+    // attachments or their resources. Lets draw validation detect a changed framebuffer cheaply.
+    unsigned int getCompletenessSerial() const { return mCompletenessSerial; }
+
     // TODO(jmadill): Remove this kludge.
     GLenum checkStatus(const ValidationContext *context);
     int getSamples(const ValidationContext *context);
@@ -291,6 +295,7 @@ class Framebuffer final : public LabeledObject, public OnAttachmentDirtyReceiver
     GLuint mId;
 
     Optional<GLenum> mCachedStatus;
+    unsigned int mCompletenessSerial;
     std::vector<OnAttachmentDirtyBinding> mDirtyColorAttachmentBindings;
     OnAttachmentDirtyBinding mDirtyDepthAttachmentBinding;
     OnAttachmentDirtyBinding mDirtyStencilAttachmentBinding;
@@ -10,28 +10,43 @@
 #include "libANGLE/HandleAllocator.h"
 
 #include <algorithm>
+#include <limits>
 
 #include "common/debug.h"
+#include "common/mathutil.h"
 
 namespace gl
 {
 
-struct HandleAllocator::HandleRangeComparator
+namespace
 {
-    bool operator()(const HandleRange &range, GLuint handle) const
+
+size_t ScanForward64(uint64_t bits)
+{
+    ASSERT(bits != 0u);
+    uint32_t lowBits = static_cast<uint32_t>(bits);
+    if (lowBits != 0u)
     {
-        return (range.end < handle);
+        return ScanForward(lowBits);
     }
-};
+    return 32u + ScanForward(static_cast<uint32_t>(bits >> 32));
+}
 
-HandleAllocator::HandleAllocator() : mBaseValue(1), mNextValue(1)
+constexpr uint64_t kAllBits = std::numeric_limits<uint64_t>::max();
+
+}  // anonymous namespace
+
+HandleAllocator::HandleAllocator() : HandleAllocator(std::numeric_limits<GLuint>::max())
 {
-    mUnallocatedList.push_back(HandleRange(1, std::numeric_limits<GLuint>::max()));
 }
 
-HandleAllocator::HandleAllocator(GLuint maximumHandleValue) : mBaseValue(1), mNextValue(1)
+HandleAllocator::HandleAllocator(GLuint maximumHandleValue)
+    : mBaseValue(1), mMaxValue(maximumHandleValue), mFirstFreeSummary(0)
 {
-    mUnallocatedList.push_back(HandleRange(1, maximumHandleValue));
+    growDenseHandles(kHandlesPerSummary);
+
+    // Handle 0 is never allocated unless the base handle is changed.
+    setUsed(0);
 }
 
 HandleAllocator::~HandleAllocator()
@@ -40,92 +55,119 @@ HandleAllocator::~HandleAllocator()
 
 void HandleAllocator::setBaseHandle(GLuint value)
 {
-    ASSERT(mBaseValue == mNextValue);
+    for (GLuint handle = 0; handle < mBaseValue; handle++)
+    {
+        setFree(handle);
+    }
+
     mBaseValue = value;
-    mNextValue = value;
+    growDenseHandles(static_cast<size_t>(value) + 1);
+    for (GLuint handle = 0; handle < mBaseValue; handle++)
+    {
+        setUsed(handle);
+    }
 }
 
 GLuint HandleAllocator::allocate()
 {
-    ASSERT(!mUnallocatedList.empty() || !mReleasedList.empty());
-
-    // Allocate from released list, constant time.
-    if (!mReleasedList.empty())
+    while (true)
     {
-        GLuint reusedHandle = mReleasedList.back();
-        mReleasedList.pop_back();
-        return reusedHandle;
-    }
+        for (size_t summary = mFirstFreeSummary; summary < mFullWords.size(); summary++)
+        {
+            uint64_t freeWords = ~mFullWords[summary];
+            if (freeWords == 0)
+            {
+                continue;
+            }
+
+            size_t word   = summary * kBitsPerWord + ScanForward64(freeWords);
+            size_t handle = word * kBitsPerWord + ScanForward64(~mUsedWords[word]);
+            ASSERT(handle <= mMaxValue);
+
+            mFirstFreeSummary = summary;
+            setUsed(handle);
+            return static_cast<GLuint>(handle);
+        }
 
-    // Allocate from unallocated list, constant time.
-    auto listIt = mUnallocatedList.begin();
+        // Every handle in the bitmap is in use, so the lowest free handle is past its end.
+        mFirstFreeSummary = mFullWords.size();
+        growDenseHandles(getDenseHandleCount() * 2);
+    }
+}
 
-    GLuint freeListHandle = listIt->begin;
-    ASSERT(freeListHandle > 0);
+void HandleAllocator::release(GLuint handle)
+{
+    if (handle < mBaseValue)
+    {
+        return;
+    }
 
-    if (listIt->begin == listIt->end)
+    if (handle < getDenseHandleCount())
     {
-        mUnallocatedList.erase(listIt);
+        setFree(handle);
     }
     else
     {
-        listIt->begin++;
+        mSparseHandles.erase(handle);
     }
-
-    return freeListHandle;
-}
-
-void HandleAllocator::release(GLuint handle)
-{
-    // Add to released list, constant time.
-    mReleasedList.push_back(handle);
 }
 
 void HandleAllocator::reserve(GLuint handle)
 {
-    // Clear from released list -- might be a slow operation.
-    if (!mReleasedList.empty())
+    size_t denseHandleCount = getDenseHandleCount();
+    if (handle >= denseHandleCount)
     {
-        auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
-        if (releasedIt != mReleasedList.end())
+        // Only grow the bitmap for handles close to its end, huge names would waste memory.
+        if (handle >= denseHandleCount * 2)
         {
-            mReleasedList.erase(releasedIt);
+            mSparseHandles.insert(handle);
             return;
         }
+        growDenseHandles(static_cast<size_t>(handle) + 1);
     }
 
-    // Not in released list, reserve in the unallocated list.
-    auto boundIt = std::lower_bound(mUnallocatedList.begin(), mUnallocatedList.end(), handle, HandleRangeComparator());
+    setUsed(handle);
+}
+
+void HandleAllocator::growDenseHandles(size_t minimumHandleCount)
+{
+    size_t oldHandleCount = getDenseHandleCount();
+    if (minimumHandleCount <= oldHandleCount)
+    {
+        return;
+    }
 
-    ASSERT(boundIt != mUnallocatedList.end());
+    size_t newHandleCount =
+        rx::roundUp(std::max(minimumHandleCount, oldHandleCount * 2), kHandlesPerSummary);
 
-    GLuint begin = boundIt->begin;
-    GLuint end = boundIt->end;
+    mUsedWords.resize(newHandleCount / kBitsPerWord, 0);
+    mFullWords.resize(newHandleCount / kHandlesPerSummary, 0);
 
-    if (handle == begin || handle == end)
+    // Move the reserved handles that are now covered by the bitmap.
+    while (!mSparseHandles.empty() && *mSparseHandles.begin() < newHandleCount)
     {
-        if (begin == end)
-        {
-            mUnallocatedList.erase(boundIt);
-        }
-        else if (handle == begin)
-        {
-            boundIt->begin++;
-        }
-        else
-        {
-            ASSERT(handle == end);
-            boundIt->end--;
-        }
-        return;
+        setUsed(*mSparseHandles.begin());
+        mSparseHandles.erase(mSparseHandles.begin());
     }
+}
 
-    ASSERT(begin < handle && handle < end);
+void HandleAllocator::setUsed(size_t handle)
+{
+    size_t word = handle / kBitsPerWord;
+    mUsedWords[word] |= (uint64_t(1) << (handle % kBitsPerWord));
+    if (mUsedWords[word] == kAllBits)
+    {
+        mFullWords[word / kBitsPerWord] |= (uint64_t(1) << (word % kBitsPerWord));
+    }
+}
 
-    // need to split the range
-    auto placementIt = mUnallocatedList.erase(boundIt);
-    placementIt      = mUnallocatedList.insert(placementIt, HandleRange(handle + 1, end));
-    mUnallocatedList.insert(placementIt, HandleRange(begin, handle - 1));
+void HandleAllocator::setFree(size_t handle)
+{
+    size_t word    = handle / kBitsPerWord;
+    size_t summary = word / kBitsPerWord;
+    mUsedWords[word] &= ~(uint64_t(1) << (handle % kBitsPerWord));
+    mFullWords[summary] &= ~(uint64_t(1) << (word % kBitsPerWord));
+    mFirstFreeSummary = std::min(mFirstFreeSummary, summary);
 }
 
 }  // namespace gl
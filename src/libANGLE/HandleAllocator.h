@@ -14,11 +14,15 @@
 
 #include "angle_gl.h"
 
-#include <stack>
+#include <set>
+#include <vector>
 
 namespace gl
 {
 
+// Always hands out the lowest free handle. Handles below a growing limit are tracked in a bitmap
+// with one summary bit per 64-bit word, so allocate, release and reserve take constant time.
+// Handles reserved far above that limit are kept in a sorted set until the bitmap reaches them.
 class HandleAllocator final : angle::NonCopyable
 {
   public:
@@ -36,27 +40,26 @@ class HandleAllocator final : angle::NonCopyable
     void reserve(GLuint handle);
 
   private:
+    size_t getDenseHandleCount() const { return mUsedWords.size() * kBitsPerWord; }
+    void growDenseHandles(size_t minimumHandleCount);
+    void setUsed(size_t handle);
+    void setFree(size_t handle);
+
+    static constexpr size_t kBitsPerWord       = 64;
+    static constexpr size_t kHandlesPerSummary = kBitsPerWord * kBitsPerWord;
+
     GLuint mBaseValue;
-    GLuint mNextValue;
-    typedef std::vector<GLuint> HandleList;
-    HandleList mFreeValues;
-
-    // Represents an inclusive range [begin, end]
-    struct HandleRange
-    {
-        HandleRange(GLuint beginIn, GLuint endIn) : begin(beginIn), end(endIn) {}
-
-        GLuint begin;
-        GLuint end;
-    };
-
-    struct HandleRangeComparator;
-
-    // The freelist consists of never-allocated handles, stored
-    // as ranges, and handles that were previously allocated and
-    // released, stored in a stack.
-    std::vector<HandleRange> mUnallocatedList;
-    std::vector<GLuint> mReleasedList;
+    GLuint mMaxValue;
+
+    // One bit per handle, set if the handle is in use.
+    std::vector<uint64_t> mUsedWords;
+    // One bit per word of mUsedWords, set if all of its handles are in use.
+    std::vector<uint64_t> mFullWords;
+    // Every word of mFullWords before this one is known to be full.
+    size_t mFirstFreeSummary;
+
+    // Reserved handles that don't fit in the bitmap yet.
+    std::set<GLuint> mSparseHandles;
 };
 
 }  // namespace gl
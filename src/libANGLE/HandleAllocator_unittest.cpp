@@ -6,6 +6,9 @@
 // Unit tests for HandleAllocator.
 //
 
+#include <random>
+#include <set>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -135,4 +138,90 @@ TEST(HandleAllocatorTest, SortedOrderHandle)
     EXPECT_EQ(6u, allocatedList[4]);
 }
 
+// Test that the lowest free handle is always the one that gets allocated.
+TEST(HandleAllocatorTest, LowestFreeHandleReused)
+{
+    gl::HandleAllocator allocator;
+
+    for (GLuint handle = 1; handle <= 10000; handle++)
+    {
+        EXPECT_EQ(handle, allocator.allocate());
+    }
+
+    allocator.release(9000);
+    allocator.release(17);
+    allocator.release(5000);
+    EXPECT_EQ(17u, allocator.allocate());
+    EXPECT_EQ(5000u, allocator.allocate());
+    EXPECT_EQ(9000u, allocator.allocate());
+    EXPECT_EQ(10001u, allocator.allocate());
+}
+
+// Test that handles reserved far above the allocated ones are skipped once allocation gets there.
+TEST(HandleAllocatorTest, SparseReservations)
+{
+    gl::HandleAllocator allocator;
+
+    const GLuint kSparseHandle = 50000;
+    allocator.reserve(kSparseHandle);
+    allocator.reserve(kSparseHandle + 1);
+    allocator.release(kSparseHandle + 1);
+
+    for (GLuint handle = 1; handle < kSparseHandle; handle++)
+    {
+        ASSERT_EQ(handle, allocator.allocate());
+    }
+    EXPECT_EQ(kSparseHandle + 1, allocator.allocate());
+    EXPECT_EQ(kSparseHandle + 2, allocator.allocate());
+}
+
+// Stress allocate, release and reserve against a simple model of the used handles.
+TEST(HandleAllocatorTest, RandomStress)
+{
+    gl::HandleAllocator allocator;
+    std::set<GLuint> used;
+    std::mt19937 random(1234);
+
+    for (int iteration = 0; iteration < 20000; iteration++)
+    {
+        switch (random() % 4)
+        {
+            case 0:
+            case 1:
+            {
+                GLuint expected = 1;
+                while (used.count(expected) != 0)
+                {
+                    expected++;
+                }
+                GLuint handle = allocator.allocate();
+                ASSERT_EQ(expected, handle);
+                used.insert(handle);
+                break;
+            }
+            case 2:
+                if (!used.empty())
+                {
+                    GLuint target = static_cast<GLuint>(random() % (*used.rbegin() + 1));
+                    auto it       = used.lower_bound(target);
+                    allocator.release(*it);
+                    used.erase(it);
+                }
+                break;
+            case 3:
+            {
+                // Mostly close to the used handles, sometimes very far away.
+                GLuint handle = (random() % 8 == 0) ? static_cast<GLuint>(random() | 0x80000000u)
+                                                    : static_cast<GLuint>(random() % 6000 + 1);
+                if (used.count(handle) == 0)
+                {
+                    allocator.reserve(handle);
+                    used.insert(handle);
+                }
+                break;
+            }
+        }
+    }
+}
+
 }
@@ -6,6 +6,10 @@
 // Unit tests for HandleRangeAllocator.
 //
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -272,4 +276,69 @@ TEST_F(HandleRangeAllocatorTest, ZeroIdCases)
     EXPECT_FALSE(allocator->isUsed(id1));
 }
 
+// Stress range allocations and releases against a simple model of the used handles.
+TEST_F(HandleRangeAllocatorTest, RandomStress)
+{
+    auto *allocator = getAllocator();
+    std::vector<bool> used(1, true);
+    std::mt19937 random(5678);
+
+    auto findFirstFit = [&used](GLuint range) {
+        GLuint first = 1;
+        GLuint count = 0;
+        for (GLuint handle = 1; handle < used.size(); handle++)
+        {
+            if (used[handle])
+            {
+                first = handle + 1;
+                count = 0;
+            }
+            else if (++count == range)
+            {
+                return first;
+            }
+        }
+        return first;
+    };
+
+    for (int iteration = 0; iteration < 5000; iteration++)
+    {
+        GLuint range = static_cast<GLuint>(random() % 16 + 1);
+        switch (random() % 3)
+        {
+            case 0:
+            {
+                GLuint expected = findFirstFit(range);
+                GLuint first    = allocator->allocateRange(range);
+                ASSERT_EQ(expected, first);
+                used.resize(std::max<size_t>(used.size(), first + range), false);
+                std::fill(used.begin() + first, used.begin() + first + range, true);
+                break;
+            }
+            case 1:
+            {
+                GLuint first = static_cast<GLuint>(random() % used.size());
+                allocator->releaseRange(first, range);
+                for (GLuint handle = std::max(first, 1u);
+                     handle < std::min<size_t>(first + range, used.size()); handle++)
+                {
+                    used[handle] = false;
+                }
+                break;
+            }
+            case 2:
+            {
+                GLuint handle = static_cast<GLuint>(random() % (used.size() + 8) + 1);
+                used.resize(std::max<size_t>(used.size(), handle + 1), false);
+                EXPECT_EQ(!used[handle], allocator->markAsUsed(handle));
+                used[handle] = true;
+                break;
+            }
+        }
+
+        GLuint probe = static_cast<GLuint>(random() % used.size());
+        ASSERT_EQ(probe != 0 && used[probe], allocator->isUsed(probe));
+    }
+}
+
 }  // namespace
\ No newline at end of file
@@ -9,105 +9,306 @@
 
 #include "libANGLE/IndexRangeCache.h"
 
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/BufferImpl.h"
 
 namespace gl
 {
 
-void IndexRangeCache::addRange(GLenum type,
-                               size_t offset,
-                               size_t count,
-                               bool primitiveRestartEnabled,
-                               const IndexRange &range)
+IndexRangeCache::Summary::Summary() : minIndex(0), maxIndex(0), vertexIndexCount(0)
+{
+}
+
+IndexRangeCache::Summary::Summary(const IndexRange &range)
+    : minIndex(range.start), maxIndex(range.end), vertexIndexCount(range.vertexIndexCount)
+{
+}
+
+void IndexRangeCache::Summary::merge(const Summary &other)
+{
+    if (other.vertexIndexCount == 0)
+    {
+        return;
+    }
+
+    if (vertexIndexCount == 0)
+    {
+        *this = other;
+        return;
+    }
+
+    minIndex = std::min(minIndex, other.minIndex);
+    maxIndex = std::max(maxIndex, other.maxIndex);
+    vertexIndexCount += other.vertexIndexCount;
+}
+
+IndexRange IndexRangeCache::Summary::toIndexRange() const
+{
+    if (vertexIndexCount == 0)
+    {
+        return IndexRange();
+    }
+    return IndexRange(minIndex, maxIndex, vertexIndexCount);
+}
+
+IndexRangeCache::IndexRangeCache() : mRecentQueryCount(0), mNextRecentQuery(0)
+{
+}
+
+IndexRangeCache::~IndexRangeCache()
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
 }
 
-bool IndexRangeCache::findRange(GLenum type,
-                                size_t offset,
-                                size_t count,
-                                bool primitiveRestartEnabled,
-                                IndexRange *outRange) const
+Error IndexRangeCache::getIndexRange(rx::BufferImpl *impl,
+                                     size_t bufferSize,
+                                     GLenum type,
+                                     size_t offset,
+                                     size_t count,
+                                     bool primitiveRestartEnabled,
+                                     IndexRange *outRange)
 {
-    auto i = mIndexRangeCache.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
-    if (i != mIndexRangeCache.end())
+    if (findRecentQuery(type, offset, count, primitiveRestartEnabled, outRange))
     {
-        if (outRange)
+        return NoError();
+    }
+
+    const size_t typeBytes  = GetTypeInfo(type).bytes;
+    const size_t firstIndex = offset / typeBytes;
+    const size_t indexCount = bufferSize / typeBytes;
+
+    // Misaligned or out of bounds queries can't go through the blocks.
+    if ((offset % typeBytes) != 0 || firstIndex > indexCount || count > indexCount - firstIndex)
+    {
+        ANGLE_TRY(impl->getIndexRange(type, offset, count, primitiveRestartEnabled, outRange));
+        addRecentQuery(type, offset, count, primitiveRestartEnabled, *outRange);
+        return NoError();
+    }
+
+    BlockTree &tree = mBlockTrees[GetTreeIndex(type, primitiveRestartEnabled)];
+    if (tree.indexCount != indexCount)
+    {
+        tree.indexCount = indexCount;
+        tree.leafCount  = (indexCount + kBlockIndexCount - 1) / kBlockIndexCount;
+        tree.nodes.assign(tree.leafCount * 2, Summary());
+        tree.valid.assign(tree.leafCount * 2, false);
+    }
+
+    // Only blocks that lie entirely inside the query come from the tree. The last block of the
+    // buffer may be shorter than the others.
+    const size_t lastIndex  = firstIndex + count;
+    const size_t firstBlock = (firstIndex + kBlockIndexCount - 1) / kBlockIndexCount;
+    const size_t lastBlock =
+        (lastIndex == indexCount) ? tree.leafCount : (lastIndex / kBlockIndexCount);
+
+    // Gather the partial blocks at either end and the blocks that aren't cached, so that the data
+    // is read only once.
+    mReadSpans.clear();
+    if (firstBlock >= lastBlock)
+    {
+        if (count > 0)
         {
-            *outRange = i->second;
+            mReadSpans.emplace_back(firstIndex, lastIndex);
         }
-        return true;
     }
     else
     {
-        if (outRange)
+        const size_t headEnd = firstBlock * kBlockIndexCount;
+        if (firstIndex < headEnd)
+        {
+            mReadSpans.emplace_back(firstIndex, headEnd);
+        }
+
+        for (size_t block = firstBlock; block < lastBlock; block++)
         {
-            *outRange = IndexRange();
+            if (!tree.valid[tree.leafCount + block])
+            {
+                const size_t blockStart = block * kBlockIndexCount;
+                mReadSpans.emplace_back(blockStart,
+                                        std::min(blockStart + kBlockIndexCount, indexCount));
+            }
+        }
+
+        const size_t tailStart = std::min(lastBlock * kBlockIndexCount, indexCount);
+        if (tailStart < lastIndex)
+        {
+            mReadSpans.emplace_back(tailStart, lastIndex);
         }
-        return false;
     }
+
+    Summary summary;
+    if (!mReadSpans.empty())
+    {
+        ANGLE_TRY(impl->getIndexRanges(type, mReadSpans, primitiveRestartEnabled, &mReadRanges));
+
+        for (size_t spanIndex = 0; spanIndex < mReadSpans.size(); spanIndex++)
+        {
+            const size_t spanStart = mReadSpans[spanIndex].start;
+            const size_t block     = spanStart / kBlockIndexCount;
+            if (spanStart % kBlockIndexCount == 0 && block >= firstBlock && block < lastBlock)
+            {
+                tree.nodes[tree.leafCount + block] = Summary(mReadRanges[spanIndex]);
+                tree.valid[tree.leafCount + block] = true;
+            }
+            else
+            {
+                summary.merge(Summary(mReadRanges[spanIndex]));
+            }
+        }
+    }
+
+    if (firstBlock < lastBlock)
+    {
+        summary.merge(QueryBlocks(&tree, firstBlock, lastBlock));
+    }
+
+    *outRange = summary.toIndexRange();
+    addRecentQuery(type, offset, count, primitiveRestartEnabled, *outRange);
+    return NoError();
 }
 
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
+    if (size == 0)
+    {
+        return;
+    }
+
     size_t invalidateStart = offset;
     size_t invalidateEnd   = offset + size;
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    for (GLenum type : {GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT})
     {
-        size_t rangeStart = i->first.offset;
-        size_t rangeEnd   = i->first.offset + (GetTypeInfo(i->first.type).bytes * i->first.count);
-
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
+        const size_t blockBytes = GetTypeInfo(type).bytes * kBlockIndexCount;
+        for (bool primitiveRestartEnabled : {false, true})
         {
-            ++i;
-        }
-        else
-        {
-            mIndexRangeCache.erase(i++);
+            BlockTree &tree = mBlockTrees[GetTreeIndex(type, primitiveRestartEnabled)];
+            if (tree.leafCount == 0)
+            {
+                continue;
+            }
+
+            size_t firstBlock = invalidateStart / blockBytes;
+            size_t lastBlock  = std::min((invalidateEnd - 1) / blockBytes, tree.leafCount - 1);
+            for (size_t block = firstBlock; block <= lastBlock; block++)
+            {
+                // An invalid node never has valid ancestors, so stop at the first one.
+                for (size_t node = tree.leafCount + block; node > 0 && tree.valid[node];
+                     node >>= 1)
+                {
+                    tree.valid[node] = false;
+                }
+            }
         }
     }
+
+    mRecentQueryCount = 0;
+    mNextRecentQuery  = 0;
 }
 
 void IndexRangeCache::clear()
 {
-    mIndexRangeCache.clear();
+    for (BlockTree &tree : mBlockTrees)
+    {
+        tree = BlockTree();
+    }
+    mRecentQueryCount = 0;
+    mNextRecentQuery  = 0;
 }
 
-IndexRangeCache::IndexRangeKey::IndexRangeKey()
-    : IndexRangeCache::IndexRangeKey(GL_NONE, 0, 0, false)
+bool IndexRangeCache::findRecentQuery(GLenum type,
+                                      size_t offset,
+                                      size_t count,
+                                      bool primitiveRestartEnabled,
+                                      IndexRange *outRange) const
 {
+    for (size_t i = 0; i < mRecentQueryCount; i++)
+    {
+        const RecentQuery &query = mRecentQueries[i];
+        if (query.type == type && query.offset == offset && query.count == count &&
+            query.primitiveRestartEnabled == primitiveRestartEnabled)
+        {
+            *outRange = query.range;
+            return true;
+        }
+    }
+    return false;
 }
 
-IndexRangeCache::IndexRangeKey::IndexRangeKey(GLenum type_,
-                                              size_t offset_,
-                                              size_t count_,
-                                              bool primitiveRestartEnabled_)
-    : type(type_), offset(offset_), count(count_), primitiveRestartEnabled(primitiveRestartEnabled_)
+void IndexRangeCache::addRecentQuery(GLenum type,
+                                     size_t offset,
+                                     size_t count,
+                                     bool primitiveRestartEnabled,
+                                     const IndexRange &range)
 {
+    mRecentQueries[mNextRecentQuery] = {type, offset, count, primitiveRestartEnabled, range};
+    mNextRecentQuery                 = (mNextRecentQuery + 1) % kRecentQueryCount;
+    mRecentQueryCount                = std::min(mRecentQueryCount + 1, kRecentQueryCount);
 }
 
-bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
+// static
+size_t IndexRangeCache::GetTreeIndex(GLenum type, bool primitiveRestartEnabled)
 {
-    if (type != rhs.type)
-    {
-        return type < rhs.type;
-    }
-    if (offset != rhs.offset)
+    size_t typeIndex = 0;
+    switch (type)
     {
-        return offset < rhs.offset;
+        case GL_UNSIGNED_BYTE:
+            typeIndex = 0;
+            break;
+        case GL_UNSIGNED_SHORT:
+            typeIndex = 1;
+            break;
+        case GL_UNSIGNED_INT:
+            typeIndex = 2;
+            break;
+        default:
+            UNREACHABLE();
+            break;
     }
-    if (count != rhs.count)
+    return typeIndex * 2 + (primitiveRestartEnabled ? 1 : 0);
+}
+
+// static
+const IndexRangeCache::Summary &IndexRangeCache::GetNode(BlockTree *tree, size_t node)
+{
+    if (!tree->valid[node])
     {
-        return count < rhs.count;
+        // The leaves a query covers are read before the tree is queried.
+        ASSERT(node < tree->leafCount);
+
+        Summary summary = GetNode(tree, node * 2);
+        summary.merge(GetNode(tree, node * 2 + 1));
+
+        tree->nodes[node] = summary;
+        tree->valid[node] = true;
     }
-    if (primitiveRestartEnabled != rhs.primitiveRestartEnabled)
+
+    return tree->nodes[node];
+}
+
+// static
+IndexRangeCache::Summary IndexRangeCache::QueryBlocks(BlockTree *tree,
+                                                      size_t firstBlock,
+                                                      size_t lastBlock)
+{
+    ASSERT(firstBlock < lastBlock && lastBlock <= tree->leafCount);
+
+    Summary summary;
+    for (size_t left = firstBlock + tree->leafCount, right = lastBlock + tree->leafCount;
+         left < right; left >>= 1, right >>= 1)
     {
-        return primitiveRestartEnabled;
+        if (left & 1)
+        {
+            summary.merge(GetNode(tree, left++));
+        }
+        if (right & 1)
+        {
+            summary.merge(GetNode(tree, --right));
+        }
     }
-    return false;
+    return summary;
 }
 
 }
@@ -12,47 +12,110 @@
 
 #include "common/angleutils.h"
 #include "common/mathutil.h"
+#include "libANGLE/Error.h"
 
 #include "angle_gl.h"
 
-#include <map>
+#include <array>
+#include <vector>
+
+namespace rx
+{
+class BufferImpl;
+}
 
 namespace gl
 {
 
-class IndexRangeCache
+// The buffer is split into blocks of kBlockIndexCount indices for each index type. The cache
+// keeps the min/max of every block in a segment tree, so a query only has to read the partial
+// blocks at either end of its range, and a buffer update only dirties the blocks it touches.
+// Everything a query has to read is read in a single call to the implementation. A handful of
+// recent exact queries are also remembered, until the next update, so repeated draws that don't
+// cover whole blocks don't read any data either.
+class IndexRangeCache final : angle::NonCopyable
 {
   public:
-    void addRange(GLenum type,
-                  size_t offset,
-                  size_t count,
-                  bool primitiveRestartEnabled,
-                  const IndexRange &range);
-    bool findRange(GLenum type,
-                   size_t offset,
-                   size_t count,
-                   bool primitiveRestartEnabled,
-                   IndexRange *outRange) const;
+    IndexRangeCache();
+    ~IndexRangeCache();
+
+    // |impl| provides the index data for anything that isn't cached. |bufferSize| is the current
+    // size of the buffer in bytes.
+    Error getIndexRange(rx::BufferImpl *impl,
+                        size_t bufferSize,
+                        GLenum type,
+                        size_t offset,
+                        size_t count,
+                        bool primitiveRestartEnabled,
+                        IndexRange *outRange);
 
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
+    static constexpr size_t kBlockIndexCount = 256;
+
   private:
-    struct IndexRangeKey
+    // Same data as IndexRange, but can also represent an empty set of indices.
+    struct Summary
     {
-        IndexRangeKey();
-        IndexRangeKey(GLenum type, size_t offset, size_t count, bool primitiveRestart);
+        Summary();
+        explicit Summary(const IndexRange &range);
+
+        void merge(const Summary &other);
+        IndexRange toIndexRange() const;
+
+        size_t minIndex;
+        size_t maxIndex;
+        size_t vertexIndexCount;
+    };
 
-        bool operator<(const IndexRangeKey &rhs) const;
+    // Iterative segment tree with the blocks as leaves. A node is only valid if both of its
+    // children are.
+    struct BlockTree
+    {
+        size_t leafCount = 0;
+        size_t indexCount = 0;
+        std::vector<Summary> nodes;
+        std::vector<bool> valid;
+    };
 
+    struct RecentQuery
+    {
         GLenum type;
         size_t offset;
         size_t count;
         bool primitiveRestartEnabled;
+        IndexRange range;
     };
 
-    typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
-    IndexRangeMap mIndexRangeCache;
+    static size_t GetTreeIndex(GLenum type, bool primitiveRestartEnabled);
+
+    bool findRecentQuery(GLenum type,
+                         size_t offset,
+                         size_t count,
+                         bool primitiveRestartEnabled,
+                         IndexRange *outRange) const;
+    void addRecentQuery(GLenum type,
+                        size_t offset,
+                        size_t count,
+                        bool primitiveRestartEnabled,
+                        const IndexRange &range);
+
+    static const Summary &GetNode(BlockTree *tree, size_t node);
+    static Summary QueryBlocks(BlockTree *tree, size_t firstBlock, size_t lastBlock);
+
+    // One tree per index type, with and without primitive restart.
+    std::array<BlockTree, 6> mBlockTrees;
+
+    // Every update forgets all of these rather than looking for the ones it overlaps.
+    static constexpr size_t kRecentQueryCount = 8;
+    std::array<RecentQuery, kRecentQueryCount> mRecentQueries;
+    size_t mRecentQueryCount;
+    size_t mNextRecentQuery;
+
+    // Scratch space for the ranges that a query reads.
+    std::vector<Range<size_t>> mReadSpans;
+    std::vector<IndexRange> mReadRanges;
 };
 
 }
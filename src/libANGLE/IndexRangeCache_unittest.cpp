@@ -0,0 +1,290 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests of the gl::IndexRangeCache class.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "common/utilities.h"
+#include "libANGLE/IndexRangeCache.h"
+#include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/BufferImpl_mock.h"
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Invoke;
+
+namespace
+{
+
+class IndexRangeCacheTest : public testing::Test
+{
+  protected:
+    IndexRangeCacheTest() : mImplCalls(0), mIndicesRead(0) {}
+
+    void SetUp() override
+    {
+        EXPECT_CALL(mImpl, getIndexRange(_, _, _, _, _))
+            .Times(AnyNumber())
+            .WillRepeatedly(Invoke(this, &IndexRangeCacheTest::computeIndexRange));
+        EXPECT_CALL(mImpl, getIndexRanges(_, _, _, _))
+            .Times(AnyNumber())
+            .WillRepeatedly(Invoke(this, &IndexRangeCacheTest::computeIndexRanges));
+        EXPECT_CALL(mImpl, destructor());
+    }
+
+    gl::Error computeIndexRange(GLenum type,
+                                size_t offset,
+                                size_t count,
+                                bool primitiveRestartEnabled,
+                                gl::IndexRange *outRange)
+    {
+        mImplCalls++;
+        mIndicesRead += count;
+        *outRange = gl::ComputeIndexRange(type, mData.data() + offset, count,
+                                          primitiveRestartEnabled);
+        return gl::NoError();
+    }
+
+    // Reads all of the spans at once, like BufferGL does with a single mapping.
+    gl::Error computeIndexRanges(GLenum type,
+                                 const std::vector<gl::Range<size_t>> &indexSpans,
+                                 bool primitiveRestartEnabled,
+                                 std::vector<gl::IndexRange> *outRanges)
+    {
+        mImplCalls++;
+        size_t typeBytes = gl::GetTypeInfo(type).bytes;
+        outRanges->clear();
+        for (const gl::Range<size_t> &span : indexSpans)
+        {
+            mIndicesRead += span.length();
+            outRanges->push_back(gl::ComputeIndexRange(type, mData.data() + span.start * typeBytes,
+                                                       span.length(), primitiveRestartEnabled));
+        }
+        return gl::NoError();
+    }
+
+    gl::IndexRange getRange(GLenum type, size_t offset, size_t count, bool primitiveRestart)
+    {
+        gl::IndexRange range;
+        EXPECT_FALSE(
+            mCache.getIndexRange(&mImpl, mData.size(), type, offset, count, primitiveRestart, &range)
+                .isError());
+        return range;
+    }
+
+    void fillRandom(size_t offset, size_t size)
+    {
+        // Bias towards large values so primitive restart indices show up.
+        std::uniform_int_distribution<int> dist(0, 300);
+        for (size_t i = offset; i < offset + size; i++)
+        {
+            mData[i] = static_cast<uint8_t>(std::min(dist(mRandom), 255));
+        }
+    }
+
+    void expectMatchesDirect(GLenum type, size_t offset, size_t count, bool primitiveRestart)
+    {
+        gl::IndexRange expected =
+            gl::ComputeIndexRange(type, mData.data() + offset, count, primitiveRestart);
+        gl::IndexRange actual = getRange(type, offset, count, primitiveRestart);
+        EXPECT_EQ(expected.start, actual.start);
+        EXPECT_EQ(expected.end, actual.end);
+        EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount);
+    }
+
+    rx::MockBufferImpl mImpl;
+    gl::IndexRangeCache mCache;
+    std::vector<uint8_t> mData;
+    std::mt19937 mRandom;
+    size_t mImplCalls;
+    size_t mIndicesRead;
+};
+
+// Test that random queries of every index type match a direct computation.
+TEST_F(IndexRangeCacheTest, RandomQueries)
+{
+    mData.resize(37 * 1024 + 5);
+    fillRandom(0, mData.size());
+
+    for (GLenum type : {GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT})
+    {
+        size_t typeBytes  = gl::GetTypeInfo(type).bytes;
+        size_t indexCount = mData.size() / typeBytes;
+        std::uniform_int_distribution<size_t> indexDist(0, indexCount - 1);
+
+        for (int iteration = 0; iteration < 200; iteration++)
+        {
+            size_t first = indexDist(mRandom);
+            size_t count = std::uniform_int_distribution<size_t>(1, indexCount - first)(mRandom);
+            expectMatchesDirect(type, first * typeBytes, count, iteration % 2 == 0);
+        }
+
+        // The whole buffer.
+        expectMatchesDirect(type, 0, indexCount, false);
+        expectMatchesDirect(type, 0, indexCount, true);
+    }
+}
+
+// Test that updating parts of the buffer gives the new ranges.
+TEST_F(IndexRangeCacheTest, InvalidateRange)
+{
+    mData.resize(16 * 1024 * 4);
+    fillRandom(0, mData.size());
+
+    for (int iteration = 0; iteration < 100; iteration++)
+    {
+        size_t offset = std::uniform_int_distribution<size_t>(0, mData.size() - 1)(mRandom);
+        size_t size   = std::uniform_int_distribution<size_t>(1, 256)(mRandom);
+        size          = std::min(size, mData.size() - offset);
+        fillRandom(offset, size);
+        mCache.invalidateRange(offset, size);
+
+        for (GLenum type : {GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT})
+        {
+            size_t indexCount = mData.size() / gl::GetTypeInfo(type).bytes;
+            expectMatchesDirect(type, 0, indexCount, false);
+            expectMatchesDirect(type, 0, indexCount, true);
+            expectMatchesDirect(type, 0, indexCount / 2 + 1, false);
+        }
+    }
+}
+
+// Test that queries covering all primitive restart indices give an empty range.
+TEST_F(IndexRangeCacheTest, AllPrimitiveRestart)
+{
+    mData.assign(8 * 1024, 0xFF);
+    gl::IndexRange range = getRange(GL_UNSIGNED_SHORT, 0, 4 * 1024, true);
+    EXPECT_EQ(0u, range.vertexIndexCount);
+
+    mData[2048] = 7;
+    mData[2049] = 0;
+    mCache.invalidateRange(2048, 2);
+    range = getRange(GL_UNSIGNED_SHORT, 0, 4 * 1024, true);
+    EXPECT_EQ(7u, range.start);
+    EXPECT_EQ(7u, range.end);
+    EXPECT_EQ(1u, range.vertexIndexCount);
+}
+
+// Test that every query reads the data at most once, and that only the touched blocks are read
+// again after a small update.
+TEST_F(IndexRangeCacheTest, PartialUpdateReadsFewBlocks)
+{
+    const size_t blockCount = 64;
+    mData.resize(blockCount * gl::IndexRangeCache::kBlockIndexCount * 2);
+    fillRandom(0, mData.size());
+
+    size_t indexCount = mData.size() / 2;
+    expectMatchesDirect(GL_UNSIGNED_SHORT, 0, indexCount, false);
+    EXPECT_EQ(1u, mImplCalls);
+
+    // An identical query doesn't touch the data at all.
+    mImplCalls = 0;
+    expectMatchesDirect(GL_UNSIGNED_SHORT, 0, indexCount, false);
+    EXPECT_EQ(0u, mImplCalls);
+
+    // A query with unaligned ends only reads the edges, both at once.
+    mImplCalls = 0;
+    expectMatchesDirect(GL_UNSIGNED_SHORT, 2 * 3, indexCount - 10, false);
+    EXPECT_EQ(1u, mImplCalls);
+
+    // Updating a few indices only re-reads the block they are in.
+    fillRandom(1000, 16);
+    mCache.invalidateRange(1000, 16);
+    mImplCalls = 0;
+    expectMatchesDirect(GL_UNSIGNED_SHORT, 0, indexCount, false);
+    EXPECT_EQ(1u, mImplCalls);
+}
+
+// Test that many distinct queries over cached blocks only read their partial end blocks.
+TEST_F(IndexRangeCacheTest, ManyDistinctQueries)
+{
+    const size_t blockIndexCount = gl::IndexRangeCache::kBlockIndexCount;
+    mData.resize(64 * 1024);
+    fillRandom(0, mData.size());
+
+    const size_t queryCount = 1000;
+    for (size_t query = 0; query < queryCount; query++)
+    {
+        expectMatchesDirect(GL_UNSIGNED_SHORT, query * 2 * 7, 3 * blockIndexCount, false);
+    }
+
+    mImplCalls   = 0;
+    mIndicesRead = 0;
+    for (size_t query = 0; query < queryCount; query++)
+    {
+        expectMatchesDirect(GL_UNSIGNED_SHORT, query * 2 * 7, 3 * blockIndexCount, false);
+    }
+    EXPECT_GE(queryCount, mImplCalls);
+    EXPECT_GT(queryCount * 2 * blockIndexCount, mIndicesRead);
+}
+
+// Test that a repeated query that doesn't cover a whole block is remembered until the next
+// update, wherever that update is.
+TEST_F(IndexRangeCacheTest, RecentQueries)
+{
+    mData.resize(16 * 1024);
+    fillRandom(0, mData.size());
+
+    expectMatchesDirect(GL_UNSIGNED_SHORT, 2 * 5, 6, false);
+    EXPECT_EQ(1u, mImplCalls);
+
+    mImplCalls = 0;
+    expectMatchesDirect(GL_UNSIGNED_SHORT, 2 * 5, 6, false);
+    EXPECT_EQ(0u, mImplCalls);
+
+    fillRandom(8 * 1024, 4);
+    mCache.invalidateRange(8 * 1024, 4);
+    expectMatchesDirect(GL_UNSIGNED_SHORT, 2 * 5, 6, false);
+    EXPECT_EQ(1u, mImplCalls);
+
+    fillRandom(2 * 5, 2);
+    mCache.invalidateRange(2 * 5, 2);
+    expectMatchesDirect(GL_UNSIGNED_SHORT, 2 * 5, 6, false);
+    EXPECT_EQ(2u, mImplCalls);
+}
+
+// Test that small queries covering whole blocks are answered from the blocks.
+TEST_F(IndexRangeCacheTest, SmallQueriesUseBlocks)
+{
+    const size_t blockIndexCount = gl::IndexRangeCache::kBlockIndexCount;
+    mData.resize(16 * blockIndexCount * 4);
+    fillRandom(0, mData.size());
+
+    size_t indexCount = mData.size() / 4;
+    expectMatchesDirect(GL_UNSIGNED_INT, 0, indexCount, false);
+
+    mImplCalls = 0;
+    for (size_t block = 0; block < 16; block++)
+    {
+        expectMatchesDirect(GL_UNSIGNED_INT, block * blockIndexCount * 4, blockIndexCount, false);
+    }
+    for (size_t block = 0; block < 15; block++)
+    {
+        expectMatchesDirect(GL_UNSIGNED_INT, block * blockIndexCount * 4, 2 * blockIndexCount,
+                            false);
+    }
+    EXPECT_EQ(0u, mImplCalls);
+}
+
+// Test that clearing the cache handles the buffer changing size.
+TEST_F(IndexRangeCacheTest, Clear)
+{
+    mData.resize(4 * 1024 * 4);
+    fillRandom(0, mData.size());
+    expectMatchesDirect(GL_UNSIGNED_INT, 0, mData.size() / 4, false);
+
+    mData.resize(9 * 1024 * 4 + 12);
+    fillRandom(0, mData.size());
+    mCache.clear();
+    expectMatchesDirect(GL_UNSIGNED_INT, 0, mData.size() / 4, false);
+    expectMatchesDirect(GL_UNSIGNED_INT, 4 * 3, mData.size() / 4 - 3, true);
+}
+
+}  // anonymous namespace
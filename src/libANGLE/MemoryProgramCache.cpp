@@ -0,0 +1,243 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// MemoryProgramCache.cpp: Implements the gl::MemoryProgramCache class.
+
+#include "libANGLE/MemoryProgramCache.h"
+
+#include <algorithm>
+
+#include <platform/Platform.h>
+
+#include "common/version.h"
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Program.h"
+#include "libANGLE/Shader.h"
+#include "third_party/murmurhash/MurmurHash3.h"
+
+namespace gl
+{
+
+namespace
+{
+
+void WriteShader(BinaryOutputStream *stream, const Shader *shader)
+{
+    if (!shader)
+    {
+        stream->writeInt(GL_NONE);
+        return;
+    }
+
+    stream->writeInt(shader->getType());
+    stream->writeInt(shader->isCompiled());
+    stream->writeInt(shader->getShaderVersion());
+    stream->writeString(shader->getTranslatedSource());
+}
+
+// The bindings are sorted so that the hash doesn't depend on the order they were made in.
+void WriteBindings(BinaryOutputStream *stream, const Program::Bindings &bindings)
+{
+    std::vector<std::pair<std::string, GLuint>> sortedBindings(bindings.begin(), bindings.end());
+    std::sort(sortedBindings.begin(), sortedBindings.end());
+
+    stream->writeInt(sortedBindings.size());
+    for (const auto &binding : sortedBindings)
+    {
+        stream->writeString(binding.first);
+        stream->writeInt(binding.second);
+    }
+}
+
+// Looks the binary up in the platform's blob cache, which may keep it between runs.
+bool GetBlob(const ProgramHash &hash, std::vector<uint8_t> *binaryOut)
+{
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+
+    size_t binarySize =
+        platform->getBlob(platform, hash.value.data(), sizeof(hash.value), nullptr, 0);
+    if (binarySize == 0)
+    {
+        return false;
+    }
+
+    // The blob may be replaced between the two calls, in which case it is treated as a miss.
+    binaryOut->resize(binarySize);
+    return platform->getBlob(platform, hash.value.data(), sizeof(hash.value), binaryOut->data(),
+                             binarySize) == binarySize;
+}
+
+void SetBlob(const ProgramHash &hash, const std::vector<uint8_t> &binary)
+{
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    platform->setBlob(platform, hash.value.data(), sizeof(hash.value), binary.data(),
+                      binary.size());
+}
+
+}  // anonymous namespace
+
+MemoryProgramCache::MemoryProgramCache(size_t maxCacheSizeBytes)
+    : mProgramBinaryCache(maxCacheSizeBytes), mHitCount(0), mMissCount(0)
+{
+}
+
+MemoryProgramCache::~MemoryProgramCache()
+{
+}
+
+// static
+void MemoryProgramCache::ComputeHash(const Context *context,
+                                     const Program *program,
+                                     ProgramHash *hashOut)
+{
+    BinaryOutputStream hashStream;
+
+    // The caps are the same for all contexts of a display, except for the ones that depend on
+    // the client version and on WebGL compatibility. The vendor and renderer strings name the
+    // backend and the device, so blobs kept by the platform are only loaded by the renderer that
+    // saved them.
+    hashStream.writeBytes(reinterpret_cast<const unsigned char *>(ANGLE_COMMIT_HASH),
+                          ANGLE_COMMIT_HASH_SIZE);
+    hashStream.writeString(reinterpret_cast<const char *>(context->getString(GL_VENDOR)));
+    hashStream.writeString(reinterpret_cast<const char *>(context->getString(GL_RENDERER)));
+    hashStream.writeInt(context->getClientMajorVersion());
+    hashStream.writeInt(context->getClientMinorVersion());
+    hashStream.writeInt(context->getExtensions().webglCompatibility);
+
+    const ProgramState &state = program->getState();
+    WriteShader(&hashStream, state.getAttachedVertexShader());
+    WriteShader(&hashStream, state.getAttachedFragmentShader());
+    WriteShader(&hashStream, state.getAttachedComputeShader());
+
+    WriteBindings(&hashStream, program->getAttributeBindings());
+    WriteBindings(&hashStream, program->getUniformLocationBindings());
+    WriteBindings(&hashStream, program->getFragmentInputBindings());
+
+    const std::vector<std::string> &transformFeedbackVaryingNames =
+        state.getTransformFeedbackVaryingNames();
+    hashStream.writeInt(transformFeedbackVaryingNames.size());
+    for (const std::string &name : transformFeedbackVaryingNames)
+    {
+        hashStream.writeString(name);
+    }
+    hashStream.writeInt(state.getTransformFeedbackBufferMode());
+    hashStream.writeInt(program->isSeparable());
+
+    MurmurHash3_x64_128(hashStream.data(), static_cast<int>(hashStream.length()), 0,
+                        hashOut->value.data());
+}
+
+bool MemoryProgramCache::getProgram(const Context *context, Program *program, ProgramHash *hashOut)
+{
+    ComputeHash(context, program, hashOut);
+
+    // The binary is copied so that the lock isn't held while the program loads.
+    std::vector<uint8_t> binary;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        const std::vector<uint8_t> *cachedBinary = nullptr;
+        if (mProgramBinaryCache.get(*hashOut, &cachedBinary))
+        {
+            binary = *cachedBinary;
+        }
+    }
+
+    // Programs that aren't in memory may still have been stored by an earlier run.
+    bool fromBlobCache = false;
+    if (binary.empty())
+    {
+        fromBlobCache = GetBlob(*hashOut, &binary);
+        if (!fromBlobCache)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mMissCount++;
+            return false;
+        }
+    }
+
+    Error error = program->loadBinary(context, GL_PROGRAM_BINARY_ANGLE, binary.data(),
+                                      static_cast<GLsizei>(binary.size()));
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (error.isError() || !program->isLinked())
+    {
+        // The binary may have been rejected by the driver, or saved by another version of ANGLE.
+        // Link the program instead, which replaces the binary.
+        mProgramBinaryCache.eraseByKey(*hashOut);
+        mMissCount++;
+        return false;
+    }
+
+    if (fromBlobCache)
+    {
+        size_t binarySize = binary.size();
+        mProgramBinaryCache.put(*hashOut, std::move(binary), binarySize);
+    }
+
+    mHitCount++;
+    return true;
+}
+
+void MemoryProgramCache::putProgram(const ProgramHash &hash,
+                                    const Context *context,
+                                    const Program *program)
+{
+    BinaryOutputStream stream;
+    if (program->serialize(context, &stream).isError())
+    {
+        // Not every implementation can save its programs.
+        return;
+    }
+
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(stream.data());
+    std::vector<uint8_t> binary(data, data + stream.length());
+
+    SetBlob(hash, binary);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mProgramBinaryCache.put(hash, std::move(binary), stream.length());
+}
+
+void MemoryProgramCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mProgramBinaryCache.clear();
+    mHitCount  = 0;
+    mMissCount = 0;
+}
+
+size_t MemoryProgramCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mProgramBinaryCache.size();
+}
+
+size_t MemoryProgramCache::maxSize() const
+{
+    return mProgramBinaryCache.maxSize();
+}
+
+size_t MemoryProgramCache::entryCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mProgramBinaryCache.entryCount();
+}
+
+unsigned int MemoryProgramCache::getHitCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHitCount;
+}
+
+unsigned int MemoryProgramCache::getMissCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMissCount;
+}
+
+}  // namespace gl
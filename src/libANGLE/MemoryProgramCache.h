@@ -0,0 +1,78 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// MemoryProgramCache.h: Defines the gl::MemoryProgramCache class, which keeps the binaries of
+// recently linked programs so that a program linked again from the same shaders and state can
+// be loaded instead of linked.
+
+#ifndef LIBANGLE_MEMORYPROGRAMCACHE_H_
+#define LIBANGLE_MEMORYPROGRAMCACHE_H_
+
+#include "common/angleutils.h"
+#include "libANGLE/SizedMRUCache.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace gl
+{
+class Context;
+class Program;
+
+// 128 bit hash of the attached shaders and of all the program state that can change the result
+// of a link.
+struct ProgramHash
+{
+    bool operator==(const ProgramHash &other) const { return value == other.value; }
+
+    std::array<uint64_t, 2> value;
+};
+
+struct ProgramHashHasher
+{
+    size_t operator()(const ProgramHash &hash) const { return static_cast<size_t>(hash.value[0]); }
+};
+
+// One cache is owned by each display and shared by all of its contexts.
+class MemoryProgramCache final : angle::NonCopyable
+{
+  public:
+    explicit MemoryProgramCache(size_t maxCacheSizeBytes);
+    ~MemoryProgramCache();
+
+    static void ComputeHash(const Context *context, const Program *program, ProgramHash *hashOut);
+
+    // Computes the hash of the program and loads the program from the binary stored under it,
+    // looking in the platform's blob cache when it isn't in memory. Returns true if the program
+    // was loaded, false if it must be linked. A binary that fails to load is dropped from the
+    // cache.
+    bool getProgram(const Context *context, Program *program, ProgramHash *hashOut);
+
+    // Stores the binary of a successfully linked program, evicting the least recently used
+    // binaries when the cache grows above its maximum size. The binary is also handed to the
+    // platform's blob cache.
+    void putProgram(const ProgramHash &hash, const Context *context, const Program *program);
+
+    void clear();
+
+    size_t size() const;
+    size_t maxSize() const;
+    size_t entryCount() const;
+
+    unsigned int getHitCount() const;
+    unsigned int getMissCount() const;
+
+  private:
+    mutable std::mutex mMutex;
+    angle::SizedMRUCache<ProgramHash, std::vector<uint8_t>, ProgramHashHasher> mProgramBinaryCache;
+    unsigned int mHitCount;
+    unsigned int mMissCount;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_MEMORYPROGRAMCACHE_H_
@@ -16,8 +16,10 @@
 #include "common/platform.h"
 #include "common/utilities.h"
 #include "common/version.h"
+#include "common/WorkerThread.h"
 #include "compiler/translator/blocklayout.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/features.h"
 #include "libANGLE/renderer/GLImplFactory.h"
@@ -159,7 +161,34 @@ bool ComparePackedVarying(const PackedVarying &x, const PackedVarying &y)
 }
 
 template <typename VarT>
-GLuint GetResourceIndexFromName(const std::vector<VarT> &list, const std::string &name)
+void IndexResourceNames(const std::vector<VarT> &list,
+                        std::unordered_map<std::string, GLuint> *nameIndexOut)
+{
+    nameIndexOut->clear();
+    nameIndexOut->reserve(list.size());
+    for (size_t index = 0; index < list.size(); index++)
+    {
+        // Keeps the first resource of a given name, as the linear searches used to.
+        nameIndexOut->emplace(list[index].name, static_cast<GLuint>(index));
+    }
+}
+
+void AddElementLocation(std::vector<GLint> *elementLocations, unsigned int element, GLint location)
+{
+    if (elementLocations->size() <= element)
+    {
+        elementLocations->resize(element + 1, -1);
+    }
+    if ((*elementLocations)[element] == -1)
+    {
+        (*elementLocations)[element] = location;
+    }
+}
+
+template <typename VarT>
+GLuint GetResourceIndexFromName(const std::vector<VarT> &list,
+                                const std::unordered_map<std::string, GLuint> &nameIndex,
+                                const std::string &name)
 {
     size_t subscript     = GL_INVALID_INDEX;
     std::string baseName = ParseResourceName(name, &subscript);
@@ -170,19 +199,14 @@ GLuint GetResourceIndexFromName(const std::vector<VarT> &list, const std::string
         return GL_INVALID_INDEX;
     }
 
-    for (size_t index = 0; index < list.size(); index++)
+    auto iter = nameIndex.find(baseName);
+    if (iter == nameIndex.end())
     {
-        const VarT &resource = list[index];
-        if (resource.name == baseName)
-        {
-            if (resource.isArray() || subscript == GL_INVALID_INDEX)
-            {
-                return static_cast<GLuint>(index);
-            }
-        }
+        return GL_INVALID_INDEX;
     }
 
-    return GL_INVALID_INDEX;
+    const VarT &resource = list[iter->second];
+    return (resource.isArray() || subscript == GL_INVALID_INDEX) ? iter->second : GL_INVALID_INDEX;
 }
 
 void CopyStringToBuffer(GLchar *buffer, const std::string &string, GLsizei bufSize, GLsizei *length)
@@ -339,42 +363,29 @@ GLint ProgramState::getUniformLocation(const std::string &name) const
     size_t subscript     = GL_INVALID_INDEX;
     std::string baseName = ParseResourceName(name, &subscript);
 
-    for (size_t location = 0; location < mUniformLocations.size(); ++location)
+    auto iter = mUniformNameIndex.find(baseName);
+    if (iter == mUniformNameIndex.end())
     {
-        const VariableLocation &uniformLocation = mUniformLocations[location];
-        if (!uniformLocation.used)
-        {
-            continue;
-        }
-
-        const LinkedUniform &uniform = mUniforms[uniformLocation.index];
+        return -1;
+    }
 
-        if (uniform.name == baseName)
-        {
-            if (uniform.isArray())
-            {
-                if (uniformLocation.element == subscript ||
-                    (uniformLocation.element == 0 && subscript == GL_INVALID_INDEX))
-                {
-                    return static_cast<GLint>(location);
-                }
-            }
-            else
-            {
-                if (subscript == GL_INVALID_INDEX)
-                {
-                    return static_cast<GLint>(location);
-                }
-            }
-        }
+    // Uniforms in blocks have no locations, so they don't have any elements here.
+    const std::vector<GLint> &elementLocations = mUniformElementLocations[iter->second];
+    if (subscript == GL_INVALID_INDEX)
+    {
+        return (elementLocations.empty() ? -1 : elementLocations[0]);
     }
 
-    return -1;
+    if (!mUniforms[iter->second].isArray() || subscript >= elementLocations.size())
+    {
+        return -1;
+    }
+    return elementLocations[subscript];
 }
 
 GLuint ProgramState::getUniformIndexFromName(const std::string &name) const
 {
-    return GetResourceIndexFromName(mUniforms, name);
+    return GetResourceIndexFromName(mUniforms, mUniformNameIndex, name);
 }
 
 GLuint ProgramState::getUniformIndexFromLocation(GLint location) const
@@ -383,6 +394,13 @@ GLuint ProgramState::getUniformIndexFromLocation(GLint location) const
     return mUniformLocations[location].index;
 }
 
+GLint ProgramState::getUniformElementLocation(GLuint uniformIndex, unsigned int element) const
+{
+    ASSERT(uniformIndex < mUniformElementLocations.size());
+    const std::vector<GLint> &elementLocations = mUniformElementLocations[uniformIndex];
+    return (element < elementLocations.size() ? elementLocations[element] : -1);
+}
+
 Optional<GLuint> ProgramState::getSamplerIndex(GLint location) const
 {
     GLuint index = getUniformIndexFromLocation(location);
@@ -412,7 +430,8 @@ Program::Program(rx::GLImplFactory *factory, ShaderProgramManager *manager, GLui
       mDeleteStatus(false),
       mRefCount(0),
       mResourceManager(manager),
-      mHandle(handle)
+      mHandle(handle),
+      mValidationSerial(0)
 {
     ASSERT(mProgram);
 
@@ -424,11 +443,14 @@ Program::~Program()
 {
     ASSERT(!mState.mAttachedVertexShader && !mState.mAttachedFragmentShader &&
            !mState.mAttachedComputeShader);
+    ASSERT(!mLinkingJob);
     SafeDelete(mProgram);
 }
 
 void Program::destroy(const Context *context)
 {
+    resolveLink();
+
     if (mState.mAttachedVertexShader != nullptr)
     {
         mState.mAttachedVertexShader->release(context);
@@ -613,19 +635,177 @@ void Program::pathFragmentInputGen(GLint index,
     mProgram->setPathFragmentInputGen(binding.name, genMode, components, coeffs);
 }
 
+// The part of a link that doesn't call into the implementation runs on a worker thread. It only
+// reads the state that was copied from the context when the link started.
+struct Program::LinkingJob final : public angle::Closure
+{
+    LinkingJob(Program *program,
+               const Context *context,
+               MemoryProgramCache *cache,
+               const ProgramHash &programHash)
+        : program(program),
+          context(context),
+          caps(context->getCaps()),
+          clientVersion(context->getClientMajorVersion(), context->getClientMinorVersion()),
+          webglCompatibility(context->getExtensions().webglCompatibility),
+          cache(cache),
+          programHash(programHash),
+          linked(false)
+    {
+    }
+
+    void operator()() override { linked = program->linkFrontend(this); }
+
+    Program *program;
+    const Context *context;
+    const Caps caps;
+    const Version clientVersion;
+    const bool webglCompatibility;
+    MemoryProgramCache *cache;
+    const ProgramHash programHash;
+    angle::WaitableEvent waitEvent;
+
+    // Results, which the implementation's link reads when the link is resolved.
+    bool linked;
+    MergedVaryings mergedVaryings;
+    std::vector<PackedVarying> packedVaryings;
+    std::unique_ptr<VaryingPacking> varyingPacking;
+};
+
 // The attached shaders are checked for linking errors by matching up their variables.
 // Uniform, input and output variables get collected.
 // The code gets compiled into binaries.
 Error Program::link(const gl::Context *context)
 {
-    const auto &data = context->getContextState();
-
     unlink();
 
     mInfoLog.reset();
+
+    // The link reads the results of the compiles.
+    for (Shader *shader : {mState.mAttachedVertexShader, mState.mAttachedFragmentShader,
+                           mState.mAttachedComputeShader})
+    {
+        if (shader)
+        {
+            shader->resolveCompile();
+        }
+    }
+
+    // A program linked earlier from the same shaders and state is loaded from its binary.
+    ProgramHash programHash;
+    MemoryProgramCache *cache = context->getMemoryProgramCache();
+    if (cache)
+    {
+        if (cache->getProgram(context, this, &programHash))
+        {
+            return NoError();
+        }
+
+        // Drop the messages of a binary that failed to load.
+        mInfoLog.reset();
+    }
+
     resetUniformBlockBindings();
 
-    const Caps &caps = data.getCaps();
+    mLinkingJob.reset(new LinkingJob(this, context, cache, programHash));
+
+    // Draws don't resolve links, so a program in use is linked right away.
+    angle::WorkerThreadPool *workerPool = context->getWorkerThreadPool();
+    if (workerPool && mRefCount == 0)
+    {
+        for (Shader *shader : {mState.mAttachedVertexShader, mState.mAttachedFragmentShader,
+                               mState.mAttachedComputeShader})
+        {
+            if (shader)
+            {
+                shader->addPendingLink(this);
+            }
+        }
+
+        mLinkingJob->waitEvent = workerPool->postWorkerTask(mLinkingJob.get());
+        return NoError();
+    }
+
+    (*mLinkingJob)();
+    return resolveLinkImpl();
+}
+
+void Program::resolveLink()
+{
+    if (!mLinkingJob)
+    {
+        return;
+    }
+
+    // The call that resolves the link isn't the one that started it, so errors only fail the link.
+    Error error = resolveLinkImpl();
+    if (error.isError())
+    {
+        mInfoLog << error.getMessage();
+    }
+}
+
+bool Program::isLinking() const
+{
+    return mLinkingJob && !mLinkingJob->waitEvent.isReady();
+}
+
+Error Program::resolveLinkImpl()
+{
+    ASSERT(mLinkingJob);
+    mLinkingJob->waitEvent.wait();
+
+    std::unique_ptr<LinkingJob> job(std::move(mLinkingJob));
+    for (Shader *shader : {mState.mAttachedVertexShader, mState.mAttachedFragmentShader,
+                           mState.mAttachedComputeShader})
+    {
+        if (shader)
+        {
+            shader->removePendingLink(this);
+        }
+    }
+
+    if (!job->linked)
+    {
+        return NoError();
+    }
+
+    const Context *context = job->context;
+    ANGLE_TRY_RESULT(mProgram->link(context->getImplementation(), *job->varyingPacking, mInfoLog),
+                     mLinked);
+    if (!mLinked)
+    {
+        return NoError();
+    }
+
+    if (!mState.mAttachedComputeShader)
+    {
+        gatherTransformFeedbackVaryings(job->mergedVaryings);
+    }
+
+    gatherInterfaceBlockInfo();
+
+    indexResourceNames();
+
+    if (!mState.mUniformStorage.init(mState.mUniforms))
+    {
+        mLinked = false;
+        return OutOfMemory() << "Failed to allocate uniform storage.";
+    }
+
+    setUniformValuesFromBindingQualifiers();
+
+    if (job->cache)
+    {
+        job->cache->putProgram(job->programHash, context, this);
+    }
+
+    return NoError();
+}
+
+bool Program::linkFrontend(LinkingJob *job)
+{
+    const Caps &caps = job->caps;
 
     auto vertexShader   = mState.mAttachedVertexShader;
     auto fragmentShader = mState.mAttachedFragmentShader;
@@ -639,7 +819,7 @@ Error Program::link(const gl::Context *context)
     if (isComputeShaderAttached == true && nonComputeShadersAttached == true)
     {
         mInfoLog << "Both a compute and non-compute shaders are attached to the same program.";
-        return NoError();
+        return false;
     }
 
     if (computeShader)
@@ -647,7 +827,7 @@ Error Program::link(const gl::Context *context)
         if (!computeShader->isCompiled())
         {
             mInfoLog << "Attached compute shader is not compiled.";
-            return NoError();
+            return false;
         }
         ASSERT(computeShader->getType() == GL_COMPUTE_SHADER);
 
@@ -658,105 +838,79 @@ Error Program::link(const gl::Context *context)
         if (!mState.mComputeShaderLocalSize.isDeclared())
         {
             mInfoLog << "Work group size is not specified.";
-            return NoError();
+            return false;
         }
 
         if (!linkUniforms(mInfoLog, caps, mUniformLocationBindings))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkUniformBlocks(mInfoLog, caps))
         {
-            return NoError();
+            return false;
         }
 
-        gl::VaryingPacking noPacking(0, PackMode::ANGLE_RELAXED);
-        ANGLE_TRY_RESULT(mProgram->link(context->getImplementation(), noPacking, mInfoLog),
-                         mLinked);
-        if (!mLinked)
-        {
-            return NoError();
-        }
+        job->varyingPacking.reset(new VaryingPacking(0, PackMode::ANGLE_RELAXED));
+        return true;
     }
-    else
-    {
-        if (!fragmentShader || !fragmentShader->isCompiled())
-        {
-            return NoError();
-        }
-        ASSERT(fragmentShader->getType() == GL_FRAGMENT_SHADER);
-
-        if (!vertexShader || !vertexShader->isCompiled())
-        {
-            return NoError();
-        }
-        ASSERT(vertexShader->getType() == GL_VERTEX_SHADER);
-
-        if (fragmentShader->getShaderVersion() != vertexShader->getShaderVersion())
-        {
-            mInfoLog << "Fragment shader version does not match vertex shader version.";
-            return NoError();
-        }
-
-        if (!linkAttributes(data, mInfoLog))
-        {
-            return NoError();
-        }
-
-        if (!linkVaryings(mInfoLog))
-        {
-            return NoError();
-        }
 
-        if (!linkUniforms(mInfoLog, caps, mUniformLocationBindings))
-        {
-            return NoError();
-        }
+    if (!fragmentShader || !fragmentShader->isCompiled())
+    {
+        return false;
+    }
+    ASSERT(fragmentShader->getType() == GL_FRAGMENT_SHADER);
 
-        if (!linkUniformBlocks(mInfoLog, caps))
-        {
-            return NoError();
-        }
+    if (!vertexShader || !vertexShader->isCompiled())
+    {
+        return false;
+    }
+    ASSERT(vertexShader->getType() == GL_VERTEX_SHADER);
 
-        const auto &mergedVaryings = getMergedVaryings();
+    if (fragmentShader->getShaderVersion() != vertexShader->getShaderVersion())
+    {
+        mInfoLog << "Fragment shader version does not match vertex shader version.";
+        return false;
+    }
 
-        if (!linkValidateTransformFeedback(context, mInfoLog, mergedVaryings, caps))
-        {
-            return NoError();
-        }
+    if (!linkAttributes(caps, mInfoLog))
+    {
+        return false;
+    }
 
-        linkOutputVariables();
+    if (!linkVaryings(mInfoLog))
+    {
+        return false;
+    }
 
-        // Validate we can pack the varyings.
-        std::vector<PackedVarying> packedVaryings = getPackedVaryings(mergedVaryings);
+    if (!linkUniforms(mInfoLog, caps, mUniformLocationBindings))
+    {
+        return false;
+    }
 
-        // Map the varyings to the register file
-        // In WebGL, we use a slightly different handling for packing variables.
-        auto packMode = data.getExtensions().webglCompatibility ? PackMode::WEBGL_STRICT
-                                                                : PackMode::ANGLE_RELAXED;
-        VaryingPacking varyingPacking(data.getCaps().maxVaryingVectors, packMode);
-        if (!varyingPacking.packUserVaryings(mInfoLog, packedVaryings,
-                                             mState.getTransformFeedbackVaryingNames()))
-        {
-            return NoError();
-        }
+    if (!linkUniformBlocks(mInfoLog, caps))
+    {
+        return false;
+    }
 
-        ANGLE_TRY_RESULT(mProgram->link(context->getImplementation(), varyingPacking, mInfoLog),
-                         mLinked);
-        if (!mLinked)
-        {
-            return NoError();
-        }
+    job->mergedVaryings = getMergedVaryings();
 
-        gatherTransformFeedbackVaryings(mergedVaryings);
+    if (!linkValidateTransformFeedback(job->clientVersion, mInfoLog, job->mergedVaryings, caps))
+    {
+        return false;
     }
 
-    setUniformValuesFromBindingQualifiers();
+    linkOutputVariables();
 
-    gatherInterfaceBlockInfo();
+    // Validate we can pack the varyings.
+    job->packedVaryings = getPackedVaryings(job->mergedVaryings);
 
-    return NoError();
+    // Map the varyings to the register file
+    // In WebGL, we use a slightly different handling for packing variables.
+    auto packMode = job->webglCompatibility ? PackMode::WEBGL_STRICT : PackMode::ANGLE_RELAXED;
+    job->varyingPacking.reset(new VaryingPacking(caps.maxVaryingVectors, packMode));
+    return job->varyingPacking->packUserVaryings(mInfoLog, job->packedVaryings,
+                                                 mState.getTransformFeedbackVaryingNames());
 }
 
 // Returns the program object to an unlinked state, before re-linking, or at destruction
@@ -772,10 +926,13 @@ void Program::unlink()
     mState.mOutputLocations.clear();
     mState.mComputeShaderLocalSize.fill(1);
     mState.mSamplerBindings.clear();
+    indexResourceNames();
+    mState.mUniformStorage.init(mState.mUniforms);
 
     mValidated = false;
 
     mLinked = false;
+    mValidationSerial++;
 }
 
 bool Program::isLinked() const
@@ -850,6 +1007,7 @@ Error Program::loadBinary(const Context *context,
         uniform.blockInfo.arrayStride      = stream.readInt<int>();
         uniform.blockInfo.matrixStride     = stream.readInt<int>();
         uniform.blockInfo.isRowMajorMatrix = stream.readBool();
+        uniform.binding                    = stream.readInt<int>();
 
         mState.mUniforms.push_back(uniform);
     }
@@ -951,6 +1109,20 @@ Error Program::loadBinary(const Context *context,
 
     ANGLE_TRY_RESULT(mProgram->load(context->getImplementation(), mInfoLog, &stream), mLinked);
 
+    indexResourceNames();
+
+    if (!mState.mUniformStorage.init(mState.mUniforms))
+    {
+        mLinked = false;
+        return OutOfMemory() << "Failed to allocate uniform storage.";
+    }
+
+    // The uniforms get their initial values back, as after a link.
+    if (mLinked)
+    {
+        setUniformValuesFromBindingQualifiers();
+    }
+
     return NoError();
 #endif  // #if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
 }
@@ -967,153 +1139,159 @@ Error Program::saveBinary(const Context *context,
     }
 
     BinaryOutputStream stream;
+    ANGLE_TRY(serialize(context, &stream));
 
-    stream.writeBytes(reinterpret_cast<const unsigned char*>(ANGLE_COMMIT_HASH), ANGLE_COMMIT_HASH_SIZE);
+    GLsizei streamLength   = static_cast<GLsizei>(stream.length());
+    const void *streamState = stream.data();
+
+    if (streamLength > bufSize)
+    {
+        if (length)
+        {
+            *length = 0;
+        }
+
+        // TODO: This should be moved to the validation layer but computing the size of the binary before saving
+        // it causes the save to happen twice.  It may be possible to write the binary to a separate buffer, validate
+        // sizes and then copy it.
+        return Error(GL_INVALID_OPERATION);
+    }
+
+    if (binary)
+    {
+        char *ptr = reinterpret_cast<char*>(binary);
+
+        memcpy(ptr, streamState, streamLength);
+        ptr += streamLength;
+
+        ASSERT(ptr - streamLength == binary);
+    }
+
+    if (length)
+    {
+        *length = streamLength;
+    }
+
+    return NoError();
+}
+
+Error Program::serialize(const Context *context, BinaryOutputStream *stream) const
+{
+    stream->writeBytes(reinterpret_cast<const unsigned char *>(ANGLE_COMMIT_HASH),
+                       ANGLE_COMMIT_HASH_SIZE);
 
     // nullptr context is supported when computing binary length.
     if (context)
     {
-        stream.writeInt(context->getClientVersion().major);
-        stream.writeInt(context->getClientVersion().minor);
+        stream->writeInt(context->getClientVersion().major);
+        stream->writeInt(context->getClientVersion().minor);
     }
     else
     {
-        stream.writeInt(2);
-        stream.writeInt(0);
+        stream->writeInt(2);
+        stream->writeInt(0);
     }
 
-    stream.writeInt(mState.mComputeShaderLocalSize[0]);
-    stream.writeInt(mState.mComputeShaderLocalSize[1]);
-    stream.writeInt(mState.mComputeShaderLocalSize[2]);
+    stream->writeInt(mState.mComputeShaderLocalSize[0]);
+    stream->writeInt(mState.mComputeShaderLocalSize[1]);
+    stream->writeInt(mState.mComputeShaderLocalSize[2]);
 
-    stream.writeInt(mState.mActiveAttribLocationsMask.to_ulong());
+    stream->writeInt(mState.mActiveAttribLocationsMask.to_ulong());
 
-    stream.writeInt(mState.mAttributes.size());
+    stream->writeInt(mState.mAttributes.size());
     for (const sh::Attribute &attrib : mState.mAttributes)
     {
-        WriteShaderVar(&stream, attrib);
-        stream.writeInt(attrib.location);
+        WriteShaderVar(stream, attrib);
+        stream->writeInt(attrib.location);
     }
 
-    stream.writeInt(mState.mUniforms.size());
+    stream->writeInt(mState.mUniforms.size());
     for (const LinkedUniform &uniform : mState.mUniforms)
     {
-        WriteShaderVar(&stream, uniform);
+        WriteShaderVar(stream, uniform);
 
         // FIXME: referenced
 
-        stream.writeInt(uniform.blockIndex);
-        stream.writeInt(uniform.blockInfo.offset);
-        stream.writeInt(uniform.blockInfo.arrayStride);
-        stream.writeInt(uniform.blockInfo.matrixStride);
-        stream.writeInt(uniform.blockInfo.isRowMajorMatrix);
+        stream->writeInt(uniform.blockIndex);
+        stream->writeInt(uniform.blockInfo.offset);
+        stream->writeInt(uniform.blockInfo.arrayStride);
+        stream->writeInt(uniform.blockInfo.matrixStride);
+        stream->writeInt(uniform.blockInfo.isRowMajorMatrix);
+        stream->writeInt(uniform.binding);
     }
 
-    stream.writeInt(mState.mUniformLocations.size());
+    stream->writeInt(mState.mUniformLocations.size());
     for (const auto &variable : mState.mUniformLocations)
     {
-        stream.writeString(variable.name);
-        stream.writeInt(variable.element);
-        stream.writeInt(variable.index);
-        stream.writeInt(variable.used);
-        stream.writeInt(variable.ignored);
+        stream->writeString(variable.name);
+        stream->writeInt(variable.element);
+        stream->writeInt(variable.index);
+        stream->writeInt(variable.used);
+        stream->writeInt(variable.ignored);
     }
 
-    stream.writeInt(mState.mUniformBlocks.size());
+    stream->writeInt(mState.mUniformBlocks.size());
     for (const UniformBlock &uniformBlock : mState.mUniformBlocks)
     {
-        stream.writeString(uniformBlock.name);
-        stream.writeInt(uniformBlock.isArray);
-        stream.writeInt(uniformBlock.arrayElement);
-        stream.writeInt(uniformBlock.dataSize);
+        stream->writeString(uniformBlock.name);
+        stream->writeInt(uniformBlock.isArray);
+        stream->writeInt(uniformBlock.arrayElement);
+        stream->writeInt(uniformBlock.dataSize);
 
-        stream.writeInt(uniformBlock.vertexStaticUse);
-        stream.writeInt(uniformBlock.fragmentStaticUse);
+        stream->writeInt(uniformBlock.vertexStaticUse);
+        stream->writeInt(uniformBlock.fragmentStaticUse);
 
-        stream.writeInt(uniformBlock.memberUniformIndexes.size());
+        stream->writeInt(uniformBlock.memberUniformIndexes.size());
         for (unsigned int memberUniformIndex : uniformBlock.memberUniformIndexes)
         {
-            stream.writeInt(memberUniformIndex);
+            stream->writeInt(memberUniformIndex);
         }
     }
 
     for (GLuint binding : mState.mUniformBlockBindings)
     {
-        stream.writeInt(binding);
+        stream->writeInt(binding);
     }
 
-    stream.writeInt(mState.mLinkedTransformFeedbackVaryings.size());
+    stream->writeInt(mState.mLinkedTransformFeedbackVaryings.size());
     for (const auto &var : mState.mLinkedTransformFeedbackVaryings)
     {
-        stream.writeInt(var.arraySize);
-        stream.writeInt(var.type);
-        stream.writeString(var.name);
+        stream->writeInt(var.arraySize);
+        stream->writeInt(var.type);
+        stream->writeString(var.name);
 
-        stream.writeIntOrNegOne(var.arrayIndex);
+        stream->writeIntOrNegOne(var.arrayIndex);
     }
 
-    stream.writeInt(mState.mTransformFeedbackBufferMode);
+    stream->writeInt(mState.mTransformFeedbackBufferMode);
 
-    stream.writeInt(mState.mOutputVariables.size());
+    stream->writeInt(mState.mOutputVariables.size());
     for (const sh::OutputVariable &output : mState.mOutputVariables)
     {
-        WriteShaderVar(&stream, output);
-        stream.writeInt(output.location);
+        WriteShaderVar(stream, output);
+        stream->writeInt(output.location);
     }
 
-    stream.writeInt(mState.mOutputLocations.size());
+    stream->writeInt(mState.mOutputLocations.size());
     for (const auto &outputPair : mState.mOutputLocations)
     {
-        stream.writeInt(outputPair.first);
-        stream.writeIntOrNegOne(outputPair.second.element);
-        stream.writeInt(outputPair.second.index);
-        stream.writeString(outputPair.second.name);
+        stream->writeInt(outputPair.first);
+        stream->writeIntOrNegOne(outputPair.second.element);
+        stream->writeInt(outputPair.second.index);
+        stream->writeString(outputPair.second.name);
     }
 
-    stream.writeInt(mState.mSamplerUniformRange.start);
-    stream.writeInt(mState.mSamplerUniformRange.end);
+    stream->writeInt(mState.mSamplerUniformRange.start);
+    stream->writeInt(mState.mSamplerUniformRange.end);
 
-    stream.writeInt(mState.mSamplerBindings.size());
+    stream->writeInt(mState.mSamplerBindings.size());
     for (const auto &samplerBinding : mState.mSamplerBindings)
     {
-        stream.writeInt(samplerBinding.textureType);
-        stream.writeInt(samplerBinding.boundTextureUnits.size());
-    }
-
-    ANGLE_TRY(mProgram->save(&stream));
-
-    GLsizei streamLength   = static_cast<GLsizei>(stream.length());
-    const void *streamState = stream.data();
-
-    if (streamLength > bufSize)
-    {
-        if (length)
-        {
-            *length = 0;
-        }
-
-        // TODO: This should be moved to the validation layer but computing the size of the binary before saving
-        // it causes the save to happen twice.  It may be possible to write the binary to a separate buffer, validate
-        // sizes and then copy it.
-        return Error(GL_INVALID_OPERATION);
+        stream->writeInt(samplerBinding.textureType);
+        stream->writeInt(samplerBinding.boundTextureUnits.size());
     }
 
-    if (binary)
-    {
-        char *ptr = reinterpret_cast<char*>(binary);
-
-        memcpy(ptr, streamState, streamLength);
-        ptr += streamLength;
-
-        ASSERT(ptr - streamLength == binary);
-    }
-
-    if (length)
-    {
-        *length = streamLength;
-    }
-
-    return NoError();
+    return mProgram->save(stream);
 }
 
 GLint Program::getBinaryLength() const
@@ -1224,15 +1402,13 @@ void Program::getAttachedShaders(GLsizei maxCount, GLsizei *count, GLuint *shade
 
 GLuint Program::getAttributeLocation(const std::string &name) const
 {
-    for (const sh::Attribute &attribute : mState.mAttributes)
+    auto iter = mState.mAttributeNameIndex.find(name);
+    if (iter == mState.mAttributeNameIndex.end())
     {
-        if (attribute.name == name)
-        {
-            return attribute.location;
-        }
+        return static_cast<GLuint>(-1);
     }
 
-    return static_cast<GLuint>(-1);
+    return mState.mAttributes[iter->second].location;
 }
 
 bool Program::isAttribLocationActive(size_t attribLocation) const
@@ -1307,20 +1483,39 @@ GLint Program::getActiveAttributeMaxLength() const
 
 GLuint Program::getInputResourceIndex(const GLchar *name) const
 {
-    for (GLuint attributeIndex = 0; attributeIndex < mState.mAttributes.size(); ++attributeIndex)
-    {
-        const sh::Attribute &attribute = mState.mAttributes[attributeIndex];
-        if (attribute.name == name)
-        {
-            return attributeIndex;
-        }
-    }
-    return GL_INVALID_INDEX;
+    auto iter = mState.mAttributeNameIndex.find(name);
+    return (iter == mState.mAttributeNameIndex.end() ? GL_INVALID_INDEX : iter->second);
 }
 
 GLuint Program::getOutputResourceIndex(const GLchar *name) const
 {
-    return GetResourceIndexFromName(mState.mOutputVariables, std::string(name));
+    return GetResourceIndexFromName(mState.mOutputVariables, mState.mOutputVariableNameIndex,
+                                    std::string(name));
+}
+
+GLuint Program::getTransformFeedbackVaryingResourceIndex(const GLchar *name) const
+{
+    auto iter = mState.mTransformFeedbackVaryingNameIndex.find(name);
+    if (iter != mState.mTransformFeedbackVaryingNameIndex.end())
+    {
+        return iter->second;
+    }
+
+    // A varying array captured as a whole can also be named by its first element.
+    size_t subscript     = GL_INVALID_INDEX;
+    std::string baseName = ParseResourceName(name, &subscript);
+    if (subscript != 0)
+    {
+        return GL_INVALID_INDEX;
+    }
+
+    iter = mState.mTransformFeedbackVaryingNameIndex.find(baseName);
+    if (iter == mState.mTransformFeedbackVaryingNameIndex.end() ||
+        !mState.mLinkedTransformFeedbackVaryings[iter->second].isArray())
+    {
+        return GL_INVALID_INDEX;
+    }
+    return iter->second;
 }
 
 size_t Program::getOutputResourceCount() const
@@ -1371,15 +1566,34 @@ GLint Program::getFragDataLocation(const std::string &name) const
 {
     std::string baseName(name);
     unsigned int arrayIndex = ParseAndStripArrayIndex(&baseName);
-    for (auto outputPair : mState.mOutputLocations)
+
+    auto iter = mState.mOutputVariableNameIndex.find(baseName);
+    if (iter == mState.mOutputVariableNameIndex.end())
+    {
+        return -1;
+    }
+
+    const std::vector<GLint> &elementLocations = mState.mOutputElementLocations[iter->second];
+    if (arrayIndex != GL_INVALID_INDEX)
+    {
+        if (!mState.mOutputVariables[iter->second].isArray() ||
+            arrayIndex >= elementLocations.size())
+        {
+            return -1;
+        }
+        return elementLocations[arrayIndex];
+    }
+
+    // Without a subscript, the lowest location of any element is returned.
+    GLint lowestLocation = -1;
+    for (GLint location : elementLocations)
     {
-        const VariableLocation &outputVariable = outputPair.second;
-        if (outputVariable.name == baseName && (arrayIndex == GL_INVALID_INDEX || arrayIndex == outputVariable.element))
+        if (location != -1 && (lowestLocation == -1 || location < lowestLocation))
         {
-            return static_cast<GLint>(outputPair.first);
+            lowestLocation = location;
         }
     }
-    return -1;
+    return lowestLocation;
 }
 
 void Program::getActiveUniform(GLuint index,
@@ -1523,128 +1737,107 @@ GLuint Program::getUniformIndex(const std::string &name) const
 
 void Program::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 1, v);
-    mProgram->setUniform1fv(location, clampedCount, v);
+    setUniformInternal(location, count, 1, v);
 }
 
 void Program::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 2, v);
-    mProgram->setUniform2fv(location, clampedCount, v);
+    setUniformInternal(location, count, 2, v);
 }
 
 void Program::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 3, v);
-    mProgram->setUniform3fv(location, clampedCount, v);
+    setUniformInternal(location, count, 3, v);
 }
 
 void Program::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 4, v);
-    mProgram->setUniform4fv(location, clampedCount, v);
+    setUniformInternal(location, count, 4, v);
 }
 
 void Program::setUniform1iv(GLint location, GLsizei count, const GLint *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 1, v);
-    mProgram->setUniform1iv(location, clampedCount, v);
+    setUniformInternal(location, count, 1, v);
 }
 
 void Program::setUniform2iv(GLint location, GLsizei count, const GLint *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 2, v);
-    mProgram->setUniform2iv(location, clampedCount, v);
+    setUniformInternal(location, count, 2, v);
 }
 
 void Program::setUniform3iv(GLint location, GLsizei count, const GLint *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 3, v);
-    mProgram->setUniform3iv(location, clampedCount, v);
+    setUniformInternal(location, count, 3, v);
 }
 
 void Program::setUniform4iv(GLint location, GLsizei count, const GLint *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 4, v);
-    mProgram->setUniform4iv(location, clampedCount, v);
+    setUniformInternal(location, count, 4, v);
 }
 
 void Program::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 1, v);
-    mProgram->setUniform1uiv(location, clampedCount, v);
+    setUniformInternal(location, count, 1, v);
 }
 
 void Program::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 2, v);
-    mProgram->setUniform2uiv(location, clampedCount, v);
+    setUniformInternal(location, count, 2, v);
 }
 
 void Program::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 3, v);
-    mProgram->setUniform3uiv(location, clampedCount, v);
+    setUniformInternal(location, count, 3, v);
 }
 
 void Program::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    GLsizei clampedCount = setUniformInternal(location, count, 4, v);
-    mProgram->setUniform4uiv(location, clampedCount, v);
+    setUniformInternal(location, count, 4, v);
 }
 
 void Program::setUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
-    GLsizei clampedCount = setMatrixUniformInternal<2, 2>(location, count, transpose, v);
-    mProgram->setUniformMatrix2fv(location, clampedCount, transpose, v);
+    setMatrixUniformInternal<2, 2>(location, count, transpose, v);
 }
 
 void Program::setUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
-    GLsizei clampedCount = setMatrixUniformInternal<3, 3>(location, count, transpose, v);
-    mProgram->setUniformMatrix3fv(location, clampedCount, transpose, v);
+    setMatrixUniformInternal<3, 3>(location, count, transpose, v);
 }
 
 void Program::setUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
-    GLsizei clampedCount = setMatrixUniformInternal<4, 4>(location, count, transpose, v);
-    mProgram->setUniformMatrix4fv(location, clampedCount, transpose, v);
+    setMatrixUniformInternal<4, 4>(location, count, transpose, v);
 }
 
 void Program::setUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
-    GLsizei clampedCount = setMatrixUniformInternal<2, 3>(location, count, transpose, v);
-    mProgram->setUniformMatrix2x3fv(location, clampedCount, transpose, v);
+    setMatrixUniformInternal<2, 3>(location, count, transpose, v);
 }
 
 void Program::setUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
-    GLsizei clampedCount = setMatrixUniformInternal<2, 4>(location, count, transpose, v);
-    mProgram->setUniformMatrix2x4fv(location, clampedCount, transpose, v);
+    setMatrixUniformInternal<2, 4>(location, count, transpose, v);
 }
 
 void Program::setUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
-    GLsizei clampedCount = setMatrixUniformInternal<3, 2>(location, count, transpose, v);
-    mProgram->setUniformMatrix3x2fv(location, clampedCount, transpose, v);
+    setMatrixUniformInternal<3, 2>(location, count, transpose, v);
 }
 
 void Program::setUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
-    GLsizei clampedCount = setMatrixUniformInternal<3, 4>(location, count, transpose, v);
-    mProgram->setUniformMatrix3x4fv(location, clampedCount, transpose, v);
+    setMatrixUniformInternal<3, 4>(location, count, transpose, v);
 }
 
 void Program::setUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
-    GLsizei clampedCount = setMatrixUniformInternal<4, 2>(location, count, transpose, v);
-    mProgram->setUniformMatrix4x2fv(location, clampedCount, transpose, v);
+    setMatrixUniformInternal<4, 2>(location, count, transpose, v);
 }
 
 void Program::setUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *v)
 {
-    GLsizei clampedCount = setMatrixUniformInternal<4, 3>(location, count, transpose, v);
-    mProgram->setUniformMatrix4x3fv(location, clampedCount, transpose, v);
+    setMatrixUniformInternal<4, 3>(location, count, transpose, v);
 }
 
 void Program::getUniformfv(GLint location, GLfloat *v) const
@@ -1662,6 +1855,15 @@ void Program::getUniformuiv(GLint location, GLuint *v) const
     getUniformInternal(location, v);
 }
 
+void Program::syncState(const Context *context)
+{
+    if (mState.mUniformStorage.hasDirtyUniforms())
+    {
+        mProgram->syncState(rx::SafeGetImpl(context));
+        mState.mUniformStorage.clearDirty();
+    }
+}
+
 void Program::flagForDeletion()
 {
     mDeleteStatus = true;
@@ -1812,23 +2014,31 @@ GLuint Program::getUniformBlockIndex(const std::string &name) const
     size_t subscript     = GL_INVALID_INDEX;
     std::string baseName = ParseResourceName(name, &subscript);
 
-    unsigned int numUniformBlocks = static_cast<unsigned int>(mState.mUniformBlocks.size());
-    for (unsigned int blockIndex = 0; blockIndex < numUniformBlocks; blockIndex++)
+    auto iter = mState.mUniformBlockNameIndex.find(baseName);
+    if (iter == mState.mUniformBlockNameIndex.end())
     {
-        const UniformBlock &uniformBlock = mState.mUniformBlocks[blockIndex];
-        if (uniformBlock.name == baseName)
-        {
-            const bool arrayElementZero =
-                (subscript == GL_INVALID_INDEX &&
-                 (!uniformBlock.isArray || uniformBlock.arrayElement == 0));
-            if (subscript == uniformBlock.arrayElement || arrayElementZero)
-            {
-                return blockIndex;
-            }
-        }
+        return GL_INVALID_INDEX;
+    }
+
+    // The elements of a block array follow its first element.
+    size_t element    = (subscript == GL_INVALID_INDEX ? 0 : subscript);
+    size_t blockIndex = iter->second + element;
+    if (!mState.mUniformBlocks[iter->second].isArray)
+    {
+        blockIndex = iter->second;
+    }
+
+    if (blockIndex >= mState.mUniformBlocks.size())
+    {
+        return GL_INVALID_INDEX;
     }
 
-    return GL_INVALID_INDEX;
+    const UniformBlock &uniformBlock = mState.mUniformBlocks[blockIndex];
+    if (uniformBlock.name != baseName || uniformBlock.arrayElement != element)
+    {
+        return GL_INVALID_INDEX;
+    }
+    return static_cast<GLuint>(blockIndex);
 }
 
 const UniformBlock &Program::getUniformBlockByIndex(GLuint index) const
@@ -1842,6 +2052,7 @@ void Program::bindUniformBlock(GLuint uniformBlockIndex, GLuint uniformBlockBind
     mState.mUniformBlockBindings[uniformBlockIndex] = uniformBlockBinding;
     mState.mActiveUniformBlockBindings.set(uniformBlockIndex, uniformBlockBinding != 0);
     mProgram->setUniformBlockBinding(uniformBlockIndex, uniformBlockBinding);
+    mValidationSerial++;
 }
 
 GLuint Program::getUniformBlockBinding(GLuint uniformBlockIndex) const
@@ -2071,13 +2282,13 @@ bool Program::linkValidateInterfaceBlockFields(InfoLog &infoLog,
 }
 
 // Assigns locations to all attributes from the bindings and program locations.
-bool Program::linkAttributes(const ContextState &data, InfoLog &infoLog)
+bool Program::linkAttributes(const Caps &caps, InfoLog &infoLog)
 {
     const auto *vertexShader = mState.getAttachedVertexShader();
 
     unsigned int usedLocations = 0;
     mState.mAttributes         = vertexShader->getActiveAttributes();
-    GLuint maxAttribs          = data.getCaps().maxVertexAttributes;
+    GLuint maxAttribs          = caps.maxVertexAttributes;
 
     // TODO(jmadill): handle aliasing robustly
     if (mState.mAttributes.size() > maxAttribs)
@@ -2462,7 +2673,7 @@ bool Program::linkValidateBuiltInVaryings(InfoLog &infoLog) const
     return true;
 }
 
-bool Program::linkValidateTransformFeedback(const gl::Context *context,
+bool Program::linkValidateTransformFeedback(const Version &clientVersion,
                                             InfoLog &infoLog,
                                             const Program::MergedVaryings &varyings,
                                             const Caps &caps) const
@@ -2489,7 +2700,7 @@ bool Program::linkValidateTransformFeedback(const gl::Context *context,
                             << tfVaryingName << ").";
                     return false;
                 }
-                if (context->getClientVersion() >= Version(3, 1))
+                if (clientVersion >= Version(3, 1))
                 {
                     if (IncludeSameArrayElement(uniqueNames, tfVaryingName))
                     {
@@ -2526,7 +2737,7 @@ bool Program::linkValidateTransformFeedback(const gl::Context *context,
                 break;
             }
         }
-        if (context->getClientVersion() < Version(3, 1) &&
+        if (clientVersion < Version(3, 1) &&
             tfVaryingName.find('[') != std::string::npos)
         {
             infoLog << "Capture of array elements is undefined and not supported.";
@@ -2718,6 +2929,45 @@ void Program::setUniformValuesFromBindingQualifiers()
     }
 }
 
+void Program::indexResourceNames()
+{
+    IndexResourceNames(mState.mAttributes, &mState.mAttributeNameIndex);
+    IndexResourceNames(mState.mUniforms, &mState.mUniformNameIndex);
+    IndexResourceNames(mState.mUniformBlocks, &mState.mUniformBlockNameIndex);
+    IndexResourceNames(mState.mOutputVariables, &mState.mOutputVariableNameIndex);
+
+    mState.mTransformFeedbackVaryingNameIndex.clear();
+    for (size_t varyingIndex = 0; varyingIndex < mState.mLinkedTransformFeedbackVaryings.size();
+         varyingIndex++)
+    {
+        const TransformFeedbackVarying &varying =
+            mState.mLinkedTransformFeedbackVaryings[varyingIndex];
+        mState.mTransformFeedbackVaryingNameIndex.emplace(varying.nameWithArrayIndex(),
+                                                          static_cast<GLuint>(varyingIndex));
+    }
+
+    mState.mUniformElementLocations.assign(mState.mUniforms.size(), std::vector<GLint>());
+    for (size_t location = 0; location < mState.mUniformLocations.size(); location++)
+    {
+        const VariableLocation &uniformLocation = mState.mUniformLocations[location];
+        if (uniformLocation.used)
+        {
+            AddElementLocation(&mState.mUniformElementLocations[uniformLocation.index],
+                               uniformLocation.element, static_cast<GLint>(location));
+        }
+    }
+
+    mState.mOutputElementLocations.assign(mState.mOutputVariables.size(), std::vector<GLint>());
+    for (const auto &outputPair : mState.mOutputLocations)
+    {
+        const VariableLocation &outputLocation = outputPair.second;
+        unsigned int element =
+            (outputLocation.element == GL_INVALID_INDEX ? 0u : outputLocation.element);
+        AddElementLocation(&mState.mOutputElementLocations[outputLocation.index], element,
+                           outputPair.first);
+    }
+}
+
 void Program::gatherInterfaceBlockInfo()
 {
     ASSERT(mState.mUniformBlocks.empty());
@@ -2938,6 +3188,7 @@ void Program::updateSamplerUniform(const VariableLocation &locationInfo,
 
         std::copy(v, v + clampedCount, boundTextureUnits->begin() + locationInfo.element);
         mCachedValidateSamplersResult.reset();
+        mValidationSerial++;
     }
 }
 
@@ -2950,11 +3201,12 @@ void Program::updateSamplerUniform(const VariableLocation &locationInfo,
 }
 
 template <typename T>
-GLsizei Program::setUniformInternal(GLint location, GLsizei countIn, int vectorSize, const T *v)
+void Program::setUniformInternal(GLint location, GLsizei countIn, int vectorSize, const T *v)
 {
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     LinkedUniform *linkedUniform         = &mState.mUniforms[locationInfo.index];
-    uint8_t *destPointer                 = linkedUniform->getDataPtrToElement(locationInfo.element);
+    uint8_t *destPointer =
+        mState.mUniformStorage.getElementData(locationInfo.index, locationInfo.element);
 
     // OpenGL ES 3.0.4 spec pg 67: "Values for any array element that exceeds the highest array
     // element index used, as reported by GetActiveUniform, will be ignored by the GL."
@@ -2986,24 +3238,29 @@ GLsizei Program::setUniformInternal(GLint location, GLsizei countIn, int vectorS
         memcpy(destPointer, v, sizeof(T) * clampedCount);
     }
 
-    return count;
+    if (count > 0)
+    {
+        mState.mUniformStorage.markDirty(locationInfo.index, locationInfo.element, count);
+    }
 }
 
 template <size_t cols, size_t rows, typename T>
-GLsizei Program::setMatrixUniformInternal(GLint location,
-                                          GLsizei count,
-                                          GLboolean transpose,
-                                          const T *v)
+void Program::setMatrixUniformInternal(GLint location,
+                                       GLsizei count,
+                                       GLboolean transpose,
+                                       const T *v)
 {
     if (!transpose)
     {
-        return setUniformInternal(location, count, cols * rows, v);
+        setUniformInternal(location, count, cols * rows, v);
+        return;
     }
 
     // Perform a transposing copy.
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     LinkedUniform *linkedUniform         = &mState.mUniforms[locationInfo.index];
-    T *destPtr = reinterpret_cast<T *>(linkedUniform->getDataPtrToElement(locationInfo.element));
+    T *destPtr                           = reinterpret_cast<T *>(
+        mState.mUniformStorage.getElementData(locationInfo.index, locationInfo.element));
 
     // OpenGL ES 3.0.4 spec pg 67: "Values for any array element that exceeds the highest array
     // element index used, as reported by GetActiveUniform, will be ignored by the GL."
@@ -3023,7 +3280,10 @@ GLsizei Program::setMatrixUniformInternal(GLint location,
         }
     }
 
-    return clampedCount;
+    if (clampedCount > 0)
+    {
+        mState.mUniformStorage.markDirty(locationInfo.index, locationInfo.element, clampedCount);
+    }
 }
 
 template <typename DestT>
@@ -3032,7 +3292,8 @@ void Program::getUniformInternal(GLint location, DestT *dataOut) const
     const VariableLocation &locationInfo = mState.mUniformLocations[location];
     const LinkedUniform &uniform         = mState.mUniforms[locationInfo.index];
 
-    const uint8_t *srcPointer = uniform.getDataPtrToElement(locationInfo.element);
+    const uint8_t *srcPointer =
+        mState.mUniformStorage.getElementData(locationInfo.index, locationInfo.element);
 
     GLenum componentType = VariableComponentType(uniform.type);
     if (componentType == GLTypeToGLenum<DestT>::value)
@@ -3067,11 +3328,18 @@ bool Program::samplesFromTexture(const gl::State &state, GLuint textureID) const
     // Must be called after samplers are validated.
     ASSERT(mCachedValidateSamplersResult.valid() && mCachedValidateSamplersResult.value());
 
+    const ActiveTextureMask &boundTextureUnits = state.getBoundTextureUnits();
     for (const auto &binding : mState.mSamplerBindings)
     {
         GLenum textureType = binding.textureType;
         for (const auto &unit : binding.boundTextureUnits)
         {
+            // Units that only have default textures bound can't sample from a framebuffer texture.
+            if (!boundTextureUnits[unit])
+            {
+                continue;
+            }
+
             GLenum programTextureID = state.getSamplerTextureId(unit, textureType);
             if (programTextureID == textureID)
             {
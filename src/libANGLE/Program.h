@@ -15,9 +15,11 @@
 
 #include <array>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/angleutils.h"
@@ -29,6 +31,7 @@
 #include "libANGLE/Debug.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/RefCountObject.h"
+#include "libANGLE/Uniform.h"
 
 namespace rx
 {
@@ -39,6 +42,7 @@ struct TranslatedAttribute;
 
 namespace gl
 {
+class BinaryOutputStream;
 struct Caps;
 class Context;
 class ContextState;
@@ -48,9 +52,8 @@ class State;
 class InfoLog;
 class Buffer;
 class Framebuffer;
-struct UniformBlock;
-struct LinkedUniform;
 struct PackedVarying;
+struct Version;
 
 extern const char * const g_fakepath;
 
@@ -233,10 +236,12 @@ class ProgramState final : angle::NonCopyable
     const std::vector<VariableLocation> &getUniformLocations() const { return mUniformLocations; }
     const std::vector<UniformBlock> &getUniformBlocks() const { return mUniformBlocks; }
     const std::vector<SamplerBinding> &getSamplerBindings() const { return mSamplerBindings; }
+    const UniformStorage &getUniformStorage() const { return mUniformStorage; }
 
     GLint getUniformLocation(const std::string &name) const;
     GLuint getUniformIndexFromName(const std::string &name) const;
     GLuint getUniformIndexFromLocation(GLint location) const;
+    GLint getUniformElementLocation(GLuint uniformIndex, unsigned int element) const;
     Optional<GLuint> getSamplerIndex(GLint location) const;
     bool isSamplerUniformIndex(GLuint index) const;
     GLuint getSamplerIndexFromUniformIndex(GLuint uniformIndex) const;
@@ -244,6 +249,8 @@ class ProgramState final : angle::NonCopyable
   private:
     friend class Program;
 
+    using ResourceNameIndex = std::unordered_map<std::string, GLuint>;
+
     std::string mLabel;
 
     sh::WorkGroupSize mComputeShaderLocalSize;
@@ -272,6 +279,10 @@ class ProgramState final : angle::NonCopyable
     std::vector<UniformBlock> mUniformBlocks;
     RangeUI mSamplerUniformRange;
 
+    // Values of the default block uniforms, indexed like mUniforms. The implementation isn't told
+    // about each update, it reads the elements written since the last sync from here instead.
+    UniformStorage mUniformStorage;
+
     // An array of the samplers that are used by the program
     std::vector<gl::SamplerBinding> mSamplerBindings;
 
@@ -279,6 +290,22 @@ class ProgramState final : angle::NonCopyable
     // TODO(jmadill): use unordered/hash map when available
     std::map<int, VariableLocation> mOutputLocations;
 
+    // Hash indices from the base name of each resource, without any array subscript, to its
+    // position in the lists above. Elements of uniform block arrays are stored consecutively, so
+    // only the first one is indexed. Transform feedback varyings are indexed by their full name,
+    // since several elements of one array can be captured separately. Rebuilt by link, by
+    // loadBinary and by unlink, which leaves them empty.
+    ResourceNameIndex mAttributeNameIndex;
+    ResourceNameIndex mUniformNameIndex;
+    ResourceNameIndex mUniformBlockNameIndex;
+    ResourceNameIndex mOutputVariableNameIndex;
+    ResourceNameIndex mTransformFeedbackVaryingNameIndex;
+
+    // Locations of each array element of each uniform or output variable, -1 where an element
+    // has none. Non-array variables use element 0.
+    std::vector<std::vector<GLint>> mUniformElementLocations;
+    std::vector<std::vector<GLint>> mOutputElementLocations;
+
     bool mBinaryRetrieveableHint;
     bool mSeparable;
 };
@@ -316,7 +343,11 @@ class Program final : angle::NonCopyable, public LabeledObject
                               GLint components,
                               const GLfloat *coeffs);
 
+    // Links the program on the context's worker threads when it isn't in use. Every query of the
+    // program through the context calls resolveLink first, which waits for the link to finish.
     Error link(const gl::Context *context);
+    void resolveLink();
+    bool isLinking() const;
     bool isLinked() const;
 
     Error loadBinary(const Context *context,
@@ -328,6 +359,8 @@ class Program final : angle::NonCopyable, public LabeledObject
                      void *binary,
                      GLsizei bufSize,
                      GLsizei *length) const;
+    // Writes the binary returned by saveBinary to the stream.
+    Error serialize(const Context *context, BinaryOutputStream *stream) const;
     GLint getBinaryLength() const;
     void setBinaryRetrievableHint(bool retrievable);
     bool getBinaryRetrievableHint() const;
@@ -428,6 +461,14 @@ class Program final : angle::NonCopyable, public LabeledObject
     bool isValidated() const;
     bool samplesFromTexture(const gl::State &state, GLuint textureID) const;
 
+    // Pushes the uniform values written since the last sync to the implementation.
+    bool hasDirtyUniforms() const { return mState.mUniformStorage.hasDirtyUniforms(); }
+    void syncState(const Context *context);
+
+    // Incremented whenever the link result, sampler bindings or uniform block bindings change.
+    // Draw validation uses it to detect a changed program without re-walking its state.
+    unsigned int getValidationSerial() const { return mValidationSerial; }
+
     const AttributesMask &getActiveAttribLocationsMask() const
     {
         return mState.mActiveAttribLocationsMask;
@@ -447,6 +488,7 @@ class Program final : angle::NonCopyable, public LabeledObject
 
     GLuint getInputResourceIndex(const GLchar *name) const;
     GLuint getOutputResourceIndex(const GLchar *name) const;
+    GLuint getTransformFeedbackVaryingResourceIndex(const GLchar *name) const;
     void getInputResourceName(GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) const;
     void getOutputResourceName(GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) const;
 
@@ -464,7 +506,13 @@ class Program final : angle::NonCopyable, public LabeledObject
         std::unordered_map<std::string, GLuint> mBindings;
     };
 
+    const Bindings &getAttributeBindings() const { return mAttributeBindings; }
+    const Bindings &getUniformLocationBindings() const { return mUniformLocationBindings; }
+    const Bindings &getFragmentInputBindings() const { return mFragmentInputBindings; }
+
   private:
+    struct LinkingJob;
+
     struct VaryingRef
     {
         const sh::Varying *get() const { return vertex ? vertex : fragment; }
@@ -478,7 +526,10 @@ class Program final : angle::NonCopyable, public LabeledObject
     void unlink();
     void resetUniformBlockBindings();
 
-    bool linkAttributes(const ContextState &data, InfoLog &infoLog);
+    bool linkFrontend(LinkingJob *job);
+    Error resolveLinkImpl();
+
+    bool linkAttributes(const Caps &caps, InfoLog &infoLog);
     bool validateUniformBlocksCount(GLuint maxUniformBlocks,
                                     const std::vector<sh::InterfaceBlock> &block,
                                     const std::string &errorMessage,
@@ -503,7 +554,7 @@ class Program final : angle::NonCopyable, public LabeledObject
                                      const sh::Varying &fragmentVarying,
                                      int shaderVersion);
     bool linkValidateBuiltInVaryings(InfoLog &infoLog) const;
-    bool linkValidateTransformFeedback(const gl::Context *context,
+    bool linkValidateTransformFeedback(const Version &clientVersion,
                                        InfoLog &infoLog,
                                        const MergedVaryings &linkedVaryings,
                                        const Caps &caps) const;
@@ -515,6 +566,7 @@ class Program final : angle::NonCopyable, public LabeledObject
     void linkOutputVariables();
 
     void setUniformValuesFromBindingQualifiers();
+    void indexResourceNames();
 
     void gatherInterfaceBlockInfo();
     template <typename VarT>
@@ -524,15 +576,15 @@ class Program final : angle::NonCopyable, public LabeledObject
 
     void defineUniformBlock(const sh::InterfaceBlock &interfaceBlock, GLenum shaderType);
 
-    // Both these function update the cached uniform values and return a modified "count"
-    // so that the uniform update doesn't overflow the uniform.
+    // Both these functions update the uniform storage, clamping "count" so that the update doesn't
+    // overflow the uniform, and mark the written elements dirty.
     template <typename T>
-    GLsizei setUniformInternal(GLint location, GLsizei count, int vectorSize, const T *v);
+    void setUniformInternal(GLint location, GLsizei count, int vectorSize, const T *v);
     template <size_t cols, size_t rows, typename T>
-    GLsizei setMatrixUniformInternal(GLint location,
-                                     GLsizei count,
-                                     GLboolean transpose,
-                                     const T *v);
+    void setMatrixUniformInternal(GLint location,
+                                  GLsizei count,
+                                  GLboolean transpose,
+                                  const T *v);
     template <typename T>
     void updateSamplerUniform(const VariableLocation &locationInfo,
                               const uint8_t *destPointer,
@@ -566,9 +618,13 @@ class Program final : angle::NonCopyable, public LabeledObject
 
     InfoLog mInfoLog;
 
+    std::unique_ptr<LinkingJob> mLinkingJob;
+
     // Cache for sampler validation
     Optional<bool> mCachedValidateSamplersResult;
     std::vector<GLenum> mTextureUnitTypesCache;
+
+    unsigned int mValidationSerial;
 };
 }  // namespace gl
 
@@ -28,16 +28,15 @@ namespace
 template <typename ResourceType>
 GLuint AllocateEmptyObject(HandleAllocator *handleAllocator, ResourceMap<ResourceType> *objectMap)
 {
-    GLuint handle        = handleAllocator->allocate();
-    (*objectMap)[handle] = nullptr;
+    GLuint handle = handleAllocator->allocate();
+    objectMap->assign(handle, nullptr);
     return handle;
 }
 
 template <typename ResourceType>
 ResourceType *GetObject(const ResourceMap<ResourceType> &objectMap, GLuint handle)
 {
-    auto iter = objectMap.find(handle);
-    return iter != objectMap.end() ? iter->second : nullptr;
+    return objectMap.query(handle);
 }
 
 }  // anonymous namespace
@@ -72,9 +71,15 @@ TypedResourceManager<ResourceType, HandleAllocatorType, ImplT>::~TypedResourceMa
 template <typename ResourceType, typename HandleAllocatorType, typename ImplT>
 void TypedResourceManager<ResourceType, HandleAllocatorType, ImplT>::reset(const Context *context)
 {
-    while (!mObjectMap.empty())
+    // Deleting the objects in place avoids restarting the map iteration for every handle.
+    for (const auto &object : mObjectMap)
     {
-        deleteObject(context, mObjectMap.begin()->first);
+        if (object.second != nullptr)
+        {
+            object.second->destroy(context);
+            ImplT::DeleteObject(object.second);
+        }
+        this->mHandleAllocator.release(object.first);
     }
     mObjectMap.clear();
 }
@@ -84,42 +89,36 @@ void TypedResourceManager<ResourceType, HandleAllocatorType, ImplT>::deleteObjec
     const Context *context,
     GLuint handle)
 {
-    auto objectIter = mObjectMap.find(handle);
-    if (objectIter == mObjectMap.end())
+    ResourceType *object = nullptr;
+    if (!mObjectMap.erase(handle, &object))
     {
         return;
     }
 
-    if (objectIter->second != nullptr)
+    if (object != nullptr)
     {
-        objectIter->second->destroy(context);
-        ImplT::DeleteObject(objectIter->second);
+        object->destroy(context);
+        ImplT::DeleteObject(object);
     }
 
     // Requires an explicit this-> because of C++ template rules.
-    this->mHandleAllocator.release(objectIter->first);
-    mObjectMap.erase(objectIter);
+    this->mHandleAllocator.release(handle);
 }
 
 template <typename ResourceType, typename HandleAllocatorType, typename ImplT>
 template <typename... ArgTypes>
 ResourceType *TypedResourceManager<ResourceType, HandleAllocatorType, ImplT>::allocateObject(
-    typename ResourceMap<ResourceType>::iterator &objectMapIter,
     rx::GLImplFactory *factory,
     GLuint handle,
     ArgTypes... args)
 {
     ResourceType *object = ImplT::AllocateNewObject(factory, handle, args...);
 
-    if (objectMapIter != mObjectMap.end())
-    {
-        objectMapIter->second = object;
-    }
-    else
+    if (!mObjectMap.contains(handle))
     {
         this->mHandleAllocator.reserve(handle);
-        mObjectMap[handle] = object;
     }
+    mObjectMap.assign(handle, object);
 
     return object;
 }
@@ -128,31 +127,26 @@ template class ResourceManagerBase<HandleAllocator>;
 template class ResourceManagerBase<HandleRangeAllocator>;
 template class TypedResourceManager<Buffer, HandleAllocator, BufferManager>;
 template Buffer *TypedResourceManager<Buffer, HandleAllocator, BufferManager>::allocateObject(
-    ResourceMap<Buffer>::iterator &,
     rx::GLImplFactory *,
     GLuint);
 template class TypedResourceManager<Texture, HandleAllocator, TextureManager>;
 template Texture *TypedResourceManager<Texture, HandleAllocator, TextureManager>::allocateObject(
-    ResourceMap<Texture>::iterator &,
     rx::GLImplFactory *,
     GLuint,
     GLenum);
 template class TypedResourceManager<Renderbuffer, HandleAllocator, RenderbufferManager>;
 template Renderbuffer *
 TypedResourceManager<Renderbuffer, HandleAllocator, RenderbufferManager>::allocateObject(
-    ResourceMap<Renderbuffer>::iterator &,
     rx::GLImplFactory *,
     GLuint);
 template class TypedResourceManager<Sampler, HandleAllocator, SamplerManager>;
 template Sampler *TypedResourceManager<Sampler, HandleAllocator, SamplerManager>::allocateObject(
-    ResourceMap<Sampler>::iterator &,
     rx::GLImplFactory *,
     GLuint);
 template class TypedResourceManager<FenceSync, HandleAllocator, FenceSyncManager>;
 template class TypedResourceManager<Framebuffer, HandleAllocator, FramebufferManager>;
 template Framebuffer *
 TypedResourceManager<Framebuffer, HandleAllocator, FramebufferManager>::allocateObject(
-    ResourceMap<Framebuffer>::iterator &,
     rx::GLImplFactory *,
     GLuint,
     const Caps &);
@@ -185,7 +179,7 @@ Buffer *BufferManager::getBuffer(GLuint handle) const
 
 bool BufferManager::isBufferGenerated(GLuint buffer) const
 {
-    return buffer == 0 || mObjectMap.find(buffer) != mObjectMap.end();
+    return buffer == 0 || mObjectMap.contains(buffer);
 }
 
 // ShaderProgramManager Implementation.
@@ -216,7 +210,7 @@ GLuint ShaderProgramManager::createShader(rx::GLImplFactory *factory,
 {
     ASSERT(type == GL_VERTEX_SHADER || type == GL_FRAGMENT_SHADER || type == GL_COMPUTE_SHADER);
     GLuint handle    = mHandleAllocator.allocate();
-    mShaders[handle] = new Shader(this, factory, rendererLimitations, type, handle);
+    mShaders.assign(handle, new Shader(this, factory, rendererLimitations, type, handle));
     return handle;
 }
 
@@ -233,7 +227,7 @@ Shader *ShaderProgramManager::getShader(GLuint handle) const
 GLuint ShaderProgramManager::createProgram(rx::GLImplFactory *factory)
 {
     GLuint handle     = mHandleAllocator.allocate();
-    mPrograms[handle] = new Program(factory, this, handle);
+    mPrograms.assign(handle, new Program(factory, this, handle));
     return handle;
 }
 
@@ -247,24 +241,42 @@ Program *ShaderProgramManager::getProgram(GLuint handle) const
     return GetObject(mPrograms, handle);
 }
 
+void ShaderProgramManager::resolveCompilesAndLinks()
+{
+    for (auto &program : mPrograms)
+    {
+        if (program.second)
+        {
+            program.second->resolveLink();
+        }
+    }
+
+    for (auto &shader : mShaders)
+    {
+        if (shader.second)
+        {
+            shader.second->resolveCompile();
+        }
+    }
+}
+
 template <typename ObjectType>
 void ShaderProgramManager::deleteObject(const Context *context,
                                         ResourceMap<ObjectType> *objectMap,
                                         GLuint id)
 {
-    auto iter = objectMap->find(id);
-    if (iter == objectMap->end())
+    ObjectType *object = objectMap->query(id);
+    if (!object)
     {
         return;
     }
 
-    auto object = iter->second;
     if (object->getRefCount() == 0)
     {
         mHandleAllocator.release(id);
         object->destroy(context);
         SafeDelete(object);
-        objectMap->erase(iter);
+        objectMap->erase(id, &object);
     }
     else
     {
@@ -301,7 +313,7 @@ Texture *TextureManager::getTexture(GLuint handle) const
 
 bool TextureManager::isTextureGenerated(GLuint texture) const
 {
-    return texture == 0 || mObjectMap.find(texture) != mObjectMap.end();
+    return texture == 0 || mObjectMap.contains(texture);
 }
 
 void TextureManager::invalidateTextureComplenessCache()
@@ -343,7 +355,7 @@ Renderbuffer *RenderbufferManager::getRenderbuffer(GLuint handle)
 
 bool RenderbufferManager::isRenderbufferGenerated(GLuint renderbuffer) const
 {
-    return renderbuffer == 0 || mObjectMap.find(renderbuffer) != mObjectMap.end();
+    return renderbuffer == 0 || mObjectMap.contains(renderbuffer);
 }
 
 // SamplerManager Implementation.
@@ -374,7 +386,7 @@ Sampler *SamplerManager::getSampler(GLuint handle)
 
 bool SamplerManager::isSampler(GLuint sampler)
 {
-    return mObjectMap.find(sampler) != mObjectMap.end();
+    return mObjectMap.contains(sampler);
 }
 
 // FenceSyncManager Implementation.
@@ -390,7 +402,7 @@ GLuint FenceSyncManager::createFenceSync(rx::GLImplFactory *factory)
     GLuint handle        = mHandleAllocator.allocate();
     FenceSync *fenceSync = new FenceSync(factory->createFenceSync(), handle);
     fenceSync->addRef();
-    mObjectMap[handle] = fenceSync;
+    mObjectMap.assign(handle, fenceSync);
     return handle;
 }
 
@@ -415,13 +427,11 @@ ErrorOrResult<GLuint> PathManager::createPaths(rx::GLImplFactory *factory, GLsiz
         return Error(GL_OUT_OF_MEMORY, "Failed to allocate path objects.");
     }
 
-    auto hint = mPaths.begin();
-
     for (GLsizei i = 0; i < range; ++i)
     {
         const auto impl = paths[static_cast<unsigned>(i)];
         const auto id   = client + i;
-        hint            = mPaths.insert(hint, std::make_pair(id, new Path(impl)));
+        mPaths.assign(id, new Path(impl));
     }
     return client;
 }
@@ -431,20 +441,17 @@ void PathManager::deletePaths(GLuint first, GLsizei range)
     for (GLsizei i = 0; i < range; ++i)
     {
         const auto id = first + i;
-        const auto it = mPaths.find(id);
-        if (it == mPaths.end())
+        Path *p       = nullptr;
+        if (!mPaths.erase(id, &p))
             continue;
-        Path *p = it->second;
         delete p;
-        mPaths.erase(it);
     }
     mHandleAllocator.releaseRange(first, static_cast<GLuint>(range));
 }
 
 Path *PathManager::getPath(GLuint handle) const
 {
-    auto iter = mPaths.find(handle);
-    return iter != mPaths.end() ? iter->second : nullptr;
+    return mPaths.query(handle);
 }
 
 bool PathManager::hasPath(GLuint handle) const
@@ -461,7 +468,7 @@ void PathManager::reset(const Context *context)
 {
     for (auto path : mPaths)
     {
-        SafeDelete(path.second);
+        delete path.second;
     }
     mPaths.clear();
 }
@@ -499,13 +506,13 @@ Framebuffer *FramebufferManager::getFramebuffer(GLuint handle) const
 void FramebufferManager::setDefaultFramebuffer(Framebuffer *framebuffer)
 {
     ASSERT(framebuffer == nullptr || framebuffer->id() == 0);
-    mObjectMap[0] = framebuffer;
+    mObjectMap.assign(0, framebuffer);
 }
 
 bool FramebufferManager::isFramebufferGenerated(GLuint framebuffer)
 {
-    ASSERT(mObjectMap.find(0) != mObjectMap.end());
-    return mObjectMap.find(framebuffer) != mObjectMap.end();
+    ASSERT(mObjectMap.contains(0));
+    return mObjectMap.contains(framebuffer);
 }
 
 void FramebufferManager::invalidateFramebufferComplenessCache()
@@ -16,6 +16,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/HandleRangeAllocator.h"
+#include "libANGLE/ResourceMap.h"
 
 namespace rx
 {
@@ -71,11 +72,10 @@ class TypedResourceManager : public ResourceManagerBase<HandleAllocatorType>
     template <typename... ArgTypes>
     ResourceType *checkObjectAllocation(rx::GLImplFactory *factory, GLuint handle, ArgTypes... args)
     {
-        auto objectMapIter = mObjectMap.find(handle);
-
-        if (objectMapIter != mObjectMap.end() && objectMapIter->second != nullptr)
+        ResourceType *value = mObjectMap.query(handle);
+        if (value)
         {
-            return objectMapIter->second;
+            return value;
         }
 
         if (handle == 0)
@@ -83,14 +83,11 @@ class TypedResourceManager : public ResourceManagerBase<HandleAllocatorType>
             return nullptr;
         }
 
-        return allocateObject<ArgTypes...>(objectMapIter, factory, handle, args...);
+        return allocateObject<ArgTypes...>(factory, handle, args...);
     }
 
     template <typename... ArgTypes>
-    ResourceType *allocateObject(typename ResourceMap<ResourceType>::iterator &objectMapIter,
-                                 rx::GLImplFactory *factory,
-                                 GLuint handle,
-                                 ArgTypes... args);
+    ResourceType *allocateObject(rx::GLImplFactory *factory, GLuint handle, ArgTypes... args);
 
     void reset(const Context *context) override;
 
@@ -130,6 +127,10 @@ class ShaderProgramManager : public ResourceManagerBase<HandleAllocator>
     void deleteProgram(const Context *context, GLuint program);
     Program *getProgram(GLuint handle) const;
 
+    // Waits for the compiles and links running on worker threads, which may use a compiler or
+    // context that is going away.
+    void resolveCompilesAndLinks();
+
   protected:
     ~ShaderProgramManager() override;
 
@@ -6,9 +6,13 @@
 // Unit tests for ResourceManager.
 //
 
+#include <set>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "libANGLE/Buffer.h"
 #include "libANGLE/ResourceManager.h"
 #include "tests/angle_unittests_utils.h"
 
@@ -70,4 +74,105 @@ TEST_F(ResourceManagerTest, ReallocateBoundRenderbuffer)
     EXPECT_NE(1u, newRenderbuffer);
 }
 
+// Test that handles beyond the flat storage of the map still work.
+TEST_F(ResourceManagerTest, LargeBufferHandles)
+{
+    EXPECT_CALL(mMockFactory, createBuffer(_)).Times(2).RetiresOnSaturation();
+
+    const GLuint smallHandle = 3;
+    const GLuint largeHandle = 0x80000000u;
+
+    Buffer *small = mBufferManager->checkBufferAllocation(&mMockFactory, smallHandle);
+    Buffer *large = mBufferManager->checkBufferAllocation(&mMockFactory, largeHandle);
+    ASSERT_NE(nullptr, small);
+    ASSERT_NE(nullptr, large);
+    EXPECT_NE(small, large);
+
+    EXPECT_EQ(small, mBufferManager->getBuffer(smallHandle));
+    EXPECT_EQ(large, mBufferManager->getBuffer(largeHandle));
+    EXPECT_TRUE(mBufferManager->isBufferGenerated(largeHandle));
+    EXPECT_FALSE(mBufferManager->isBufferGenerated(largeHandle + 1));
+    EXPECT_EQ(nullptr, mBufferManager->getBuffer(largeHandle + 1));
+
+    mBufferManager->deleteObject(nullptr, largeHandle);
+    EXPECT_FALSE(mBufferManager->isBufferGenerated(largeHandle));
+    EXPECT_EQ(nullptr, mBufferManager->getBuffer(largeHandle));
+    EXPECT_EQ(small, mBufferManager->getBuffer(smallHandle));
+}
+
+// Test that generated but unbound handles are tracked until they are deleted.
+TEST_F(ResourceManagerTest, GeneratedBufferHandles)
+{
+    std::vector<GLuint> handles;
+    for (int i = 0; i < 5000; i++)
+    {
+        handles.push_back(mBufferManager->createBuffer());
+    }
+
+    for (size_t i = 0; i < handles.size(); i++)
+    {
+        EXPECT_TRUE(mBufferManager->isBufferGenerated(handles[i]));
+        EXPECT_EQ(nullptr, mBufferManager->getBuffer(handles[i]));
+        if (i % 2 == 0)
+        {
+            mBufferManager->deleteObject(nullptr, handles[i]);
+        }
+    }
+
+    for (size_t i = 0; i < handles.size(); i++)
+    {
+        EXPECT_EQ(i % 2 != 0, mBufferManager->isBufferGenerated(handles[i]));
+    }
+}
+
+// Test the hybrid flat and hashed storage of ResourceMap directly.
+TEST(ResourceMapTest, AssignQueryEraseAndIterate)
+{
+    ResourceMap<int> map;
+    std::vector<int> values(6);
+
+    const GLuint handles[] = {0, 1, ResourceMap<int>::kInitialFlatResourcesSize + 1,
+                              ResourceMap<int>::kFlatResourcesLimit - 1,
+                              ResourceMap<int>::kFlatResourcesLimit, 0xFFFFFFFFu};
+
+    EXPECT_TRUE(map.empty());
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        EXPECT_FALSE(map.contains(handles[i]));
+        map.assign(handles[i], &values[i]);
+        EXPECT_TRUE(map.contains(handles[i]));
+        EXPECT_EQ(&values[i], map.query(handles[i]));
+    }
+    EXPECT_EQ(values.size(), map.size());
+
+    // Reserved handles are contained but have no object.
+    map.assign(2, nullptr);
+    EXPECT_TRUE(map.contains(2));
+    EXPECT_EQ(nullptr, map.query(2));
+    EXPECT_EQ(values.size() + 1, map.size());
+
+    std::set<GLuint> visited;
+    for (const auto &entry : map)
+    {
+        EXPECT_TRUE(visited.insert(entry.first).second);
+        EXPECT_EQ(map.query(entry.first), entry.second);
+    }
+    EXPECT_EQ(map.size(), visited.size());
+
+    int *erased = nullptr;
+    EXPECT_TRUE(map.erase(handles[4], &erased));
+    EXPECT_EQ(&values[4], erased);
+    EXPECT_FALSE(map.erase(handles[4], &erased));
+    EXPECT_TRUE(map.erase(handles[1], &erased));
+    EXPECT_EQ(&values[1], erased);
+    EXPECT_FALSE(map.contains(handles[1]));
+    EXPECT_EQ(nullptr, map.query(handles[1]));
+    EXPECT_EQ(values.size() - 1, map.size());
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(handles[5]));
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
 }  // anonymous namespace
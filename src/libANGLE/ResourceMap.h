@@ -0,0 +1,218 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ResourceMap.h: Defines the gl::ResourceMap class, a map of GL object handles to objects.
+// Handles from HandleAllocator are small and dense, so they index straight into an array. Names
+// above a fixed limit, such as those picked by the application, fall back to a hash map.
+
+#ifndef LIBANGLE_RESOURCEMAP_H_
+#define LIBANGLE_RESOURCEMAP_H_
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+#include "common/debug.h"
+
+namespace gl
+{
+
+template <typename ResourceType>
+class ResourceMap final : angle::NonCopyable
+{
+  public:
+    using IndexAndResource = std::pair<GLuint, ResourceType *>;
+    using HashMap          = std::unordered_map<GLuint, ResourceType *>;
+
+    class Iterator final
+    {
+      public:
+        bool operator==(const Iterator &other) const
+        {
+            return mFlatIndex == other.mFlatIndex && mHashIndex == other.mHashIndex;
+        }
+        bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+        Iterator &operator++()
+        {
+            if (mFlatIndex < mOrigin.mFlatResources.size())
+            {
+                mFlatIndex = mOrigin.nextFlatIndex(mFlatIndex + 1);
+            }
+            else
+            {
+                ++mHashIndex;
+            }
+            updateValue();
+            return *this;
+        }
+
+        const IndexAndResource *operator->() const { return &mValue; }
+        const IndexAndResource &operator*() const { return mValue; }
+
+      private:
+        friend class ResourceMap;
+        Iterator(const ResourceMap &origin,
+                 size_t flatIndex,
+                 typename HashMap::const_iterator hashIndex)
+            : mOrigin(origin), mFlatIndex(flatIndex), mHashIndex(hashIndex), mValue()
+        {
+            updateValue();
+        }
+
+        void updateValue()
+        {
+            if (mFlatIndex < mOrigin.mFlatResources.size())
+            {
+                mValue.first  = static_cast<GLuint>(mFlatIndex);
+                mValue.second = mOrigin.mFlatResources[mFlatIndex];
+            }
+            else if (mHashIndex != mOrigin.mHashedResources.end())
+            {
+                mValue = *mHashIndex;
+            }
+        }
+
+        const ResourceMap &mOrigin;
+        size_t mFlatIndex;
+        typename HashMap::const_iterator mHashIndex;
+        IndexAndResource mValue;
+    };
+
+    ResourceMap() : mFlatResources(kInitialFlatResourcesSize, InvalidPointer()), mSize(0) {}
+
+    // Returns nullptr for handles that are unused or reserved without an object.
+    ResourceType *query(GLuint handle) const
+    {
+        if (handle < mFlatResources.size())
+        {
+            ResourceType *value = mFlatResources[handle];
+            return (value == InvalidPointer() ? nullptr : value);
+        }
+        auto it = mHashedResources.find(handle);
+        return (it == mHashedResources.end() ? nullptr : it->second);
+    }
+
+    bool contains(GLuint handle) const
+    {
+        if (handle < mFlatResources.size())
+        {
+            return mFlatResources[handle] != InvalidPointer();
+        }
+        return mHashedResources.find(handle) != mHashedResources.end();
+    }
+
+    // A null |resource| marks the handle as used without creating an object for it yet.
+    void assign(GLuint handle, ResourceType *resource)
+    {
+        ASSERT(resource != InvalidPointer());
+
+        if (handle < kFlatResourcesLimit)
+        {
+            if (handle >= mFlatResources.size())
+            {
+                size_t newSize = mFlatResources.size();
+                while (newSize <= handle)
+                {
+                    newSize *= 2;
+                }
+                mFlatResources.resize(std::min(newSize, static_cast<size_t>(kFlatResourcesLimit)),
+                                      InvalidPointer());
+            }
+
+            if (mFlatResources[handle] == InvalidPointer())
+            {
+                mSize++;
+            }
+            mFlatResources[handle] = resource;
+        }
+        else
+        {
+            auto result = mHashedResources.insert(std::make_pair(handle, resource));
+            if (result.second)
+            {
+                mSize++;
+            }
+            else
+            {
+                result.first->second = resource;
+            }
+        }
+    }
+
+    // Returns false if the handle was not in the map.
+    bool erase(GLuint handle, ResourceType **resourceOut)
+    {
+        if (handle < mFlatResources.size())
+        {
+            ResourceType *value = mFlatResources[handle];
+            if (value == InvalidPointer())
+            {
+                return false;
+            }
+            mFlatResources[handle] = InvalidPointer();
+            *resourceOut           = value;
+        }
+        else
+        {
+            auto it = mHashedResources.find(handle);
+            if (it == mHashedResources.end())
+            {
+                return false;
+            }
+            *resourceOut = it->second;
+            mHashedResources.erase(it);
+        }
+
+        mSize--;
+        return true;
+    }
+
+    void clear()
+    {
+        mFlatResources.assign(kInitialFlatResourcesSize, InvalidPointer());
+        mHashedResources.clear();
+        mSize = 0;
+    }
+
+    bool empty() const { return mSize == 0; }
+    size_t size() const { return mSize; }
+
+    Iterator begin() const { return Iterator(*this, nextFlatIndex(0), mHashedResources.begin()); }
+    Iterator end() const { return Iterator(*this, mFlatResources.size(), mHashedResources.end()); }
+
+    static constexpr GLuint kInitialFlatResourcesSize = 0x40;
+    static constexpr GLuint kFlatResourcesLimit       = 0x4000;
+
+  private:
+    friend class Iterator;
+
+    // Marks unused slots of the flat array, so that null can still mean "reserved".
+    static ResourceType *InvalidPointer()
+    {
+        return reinterpret_cast<ResourceType *>(static_cast<uintptr_t>(-1));
+    }
+
+    size_t nextFlatIndex(size_t flatIndex) const
+    {
+        while (flatIndex < mFlatResources.size() && mFlatResources[flatIndex] == InvalidPointer())
+        {
+            flatIndex++;
+        }
+        return flatIndex;
+    }
+
+    std::vector<ResourceType *> mFlatResources;
+    HashMap mHashedResources;
+    size_t mSize;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_RESOURCEMAP_H_
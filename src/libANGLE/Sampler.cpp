@@ -16,7 +16,11 @@ namespace gl
 {
 
 Sampler::Sampler(rx::GLImplFactory *factory, GLuint id)
-    : RefCountObject(id), mImpl(factory->createSampler()), mLabel(), mSamplerState()
+    : RefCountObject(id),
+      mImpl(factory->createSampler()),
+      mLabel(),
+      mSamplerState(),
+      mSamplerStateSerial(0)
 {
 }
 
@@ -38,6 +42,7 @@ const std::string &Sampler::getLabel() const
 void Sampler::setMinFilter(GLenum minFilter)
 {
     mSamplerState.minFilter = minFilter;
+    mSamplerStateSerial++;
 }
 
 GLenum Sampler::getMinFilter() const
@@ -48,6 +53,7 @@ GLenum Sampler::getMinFilter() const
 void Sampler::setMagFilter(GLenum magFilter)
 {
     mSamplerState.magFilter = magFilter;
+    mSamplerStateSerial++;
 }
 
 GLenum Sampler::getMagFilter() const
@@ -58,6 +64,7 @@ GLenum Sampler::getMagFilter() const
 void Sampler::setWrapS(GLenum wrapS)
 {
     mSamplerState.wrapS = wrapS;
+    mSamplerStateSerial++;
 }
 
 GLenum Sampler::getWrapS() const
@@ -68,6 +75,7 @@ GLenum Sampler::getWrapS() const
 void Sampler::setWrapT(GLenum wrapT)
 {
     mSamplerState.wrapT = wrapT;
+    mSamplerStateSerial++;
 }
 
 GLenum Sampler::getWrapT() const
@@ -78,6 +86,7 @@ GLenum Sampler::getWrapT() const
 void Sampler::setWrapR(GLenum wrapR)
 {
     mSamplerState.wrapR = wrapR;
+    mSamplerStateSerial++;
 }
 
 GLenum Sampler::getWrapR() const
@@ -88,6 +97,7 @@ GLenum Sampler::getWrapR() const
 void Sampler::setMaxAnisotropy(float maxAnisotropy)
 {
     mSamplerState.maxAnisotropy = maxAnisotropy;
+    mSamplerStateSerial++;
 }
 
 float Sampler::getMaxAnisotropy() const
@@ -98,6 +108,7 @@ float Sampler::getMaxAnisotropy() const
 void Sampler::setMinLod(GLfloat minLod)
 {
     mSamplerState.minLod = minLod;
+    mSamplerStateSerial++;
 }
 
 GLfloat Sampler::getMinLod() const
@@ -108,6 +119,7 @@ GLfloat Sampler::getMinLod() const
 void Sampler::setMaxLod(GLfloat maxLod)
 {
     mSamplerState.maxLod = maxLod;
+    mSamplerStateSerial++;
 }
 
 GLfloat Sampler::getMaxLod() const
@@ -118,6 +130,7 @@ GLfloat Sampler::getMaxLod() const
 void Sampler::setCompareMode(GLenum compareMode)
 {
     mSamplerState.compareMode = compareMode;
+    mSamplerStateSerial++;
 }
 
 GLenum Sampler::getCompareMode() const
@@ -128,6 +141,7 @@ GLenum Sampler::getCompareMode() const
 void Sampler::setCompareFunc(GLenum compareFunc)
 {
     mSamplerState.compareFunc = compareFunc;
+    mSamplerStateSerial++;
 }
 
 GLenum Sampler::getCompareFunc() const
@@ -138,6 +152,7 @@ GLenum Sampler::getCompareFunc() const
 void Sampler::setSRGBDecode(GLenum sRGBDecode)
 {
     mSamplerState.sRGBDecode = sRGBDecode;
+    mSamplerStateSerial++;
 }
 
 GLenum Sampler::getSRGBDecode() const
@@ -68,6 +68,8 @@ class Sampler final : public RefCountObject, public LabeledObject
     GLenum getSRGBDecode() const;
 
     const SamplerState &getSamplerState() const;
+    // Changes whenever the sampler state is modified.
+    unsigned int getSamplerStateSerial() const { return mSamplerStateSerial; }
 
     rx::SamplerImpl *getImplementation() const;
 
@@ -77,6 +79,7 @@ class Sampler final : public RefCountObject, public LabeledObject
     std::string mLabel;
 
     SamplerState mSamplerState;
+    unsigned int mSamplerStateSerial;
 };
 
 }
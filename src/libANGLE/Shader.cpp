@@ -12,6 +12,7 @@
 
 #include <sstream>
 
+#include "common/WorkerThread.h"
 #include "common/utilities.h"
 #include "GLSLANG/ShaderLang.h"
 #include "libANGLE/Caps.h"
@@ -21,6 +22,7 @@
 #include "libANGLE/renderer/ShaderImpl.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Program.h"
 
 namespace gl
 {
@@ -52,6 +54,128 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
 
 }  // anonymous namespace
 
+// Translates the shader with a compiler handle that no other compile uses, from copies of the
+// shader's sources, so that it can run on a worker thread. The results are kept until the shader
+// resolves the compile.
+struct Shader::CompileJob final : public angle::Closure
+{
+    CompileJob(Compiler *compilerIn,
+               ShHandle compilerHandleIn,
+               GLenum shaderTypeIn,
+               ShCompileOptions compileOptionsIn,
+               const std::string &sourcePathIn,
+               std::string &&sourceIn,
+               const std::string &originalSourceIn)
+        : compiler(compilerIn),
+          compilerHandle(compilerHandleIn),
+          shaderType(shaderTypeIn),
+          compileOptions(compileOptionsIn),
+          sourcePath(sourcePathIn),
+          source(std::move(sourceIn)),
+          originalSource(originalSourceIn),
+          translated(false),
+          shaderVersion(100)
+    {
+        localSize.fill(-1);
+    }
+
+    void operator()() override;
+
+    Compiler *compiler;
+    ShHandle compilerHandle;
+    GLenum shaderType;
+    ShCompileOptions compileOptions;
+    std::string sourcePath;
+    std::string source;
+    std::string originalSource;
+
+    angle::WaitableEvent waitEvent;
+
+    bool translated;
+    std::string infoLog;
+    std::string translatedSource;
+    int shaderVersion;
+    sh::WorkGroupSize localSize;
+    std::vector<sh::Varying> varyings;
+    std::vector<sh::Uniform> uniforms;
+    std::vector<sh::InterfaceBlock> interfaceBlocks;
+    std::vector<sh::Attribute> activeAttributes;
+    std::vector<sh::OutputVariable> activeOutputVariables;
+};
+
+void Shader::CompileJob::operator()()
+{
+    std::vector<const char *> sourceCStrings;
+
+    if (!sourcePath.empty())
+    {
+        sourceCStrings.push_back(sourcePath.c_str());
+    }
+
+    sourceCStrings.push_back(source.c_str());
+
+    if (!sh::Compile(compilerHandle, &sourceCStrings[0], sourceCStrings.size(), compileOptions))
+    {
+        infoLog = sh::GetInfoLog(compilerHandle);
+        return;
+    }
+
+    translated       = true;
+    translatedSource = sh::GetObjectCode(compilerHandle);
+
+#ifndef NDEBUG
+    // Prefix translated shader with commented out un-translated shader.
+    // Useful in diagnostics tools which capture the shader source.
+    std::ostringstream shaderStream;
+    shaderStream << "// GLSL\n";
+    shaderStream << "//\n";
+
+    std::istringstream inputSourceStream(originalSource);
+    std::string line;
+    while (std::getline(inputSourceStream, line))
+    {
+        // Remove null characters from the source line
+        line.erase(std::remove(line.begin(), line.end(), '\0'), line.end());
+
+        shaderStream << "// " << line;
+    }
+    shaderStream << "\n\n";
+    shaderStream << translatedSource;
+    translatedSource = shaderStream.str();
+#endif
+
+    // Gather the shader information
+    shaderVersion = sh::GetShaderVersion(compilerHandle);
+
+    varyings        = GetShaderVariables(sh::GetVaryings(compilerHandle));
+    uniforms        = GetShaderVariables(sh::GetUniforms(compilerHandle));
+    interfaceBlocks = GetShaderVariables(sh::GetInterfaceBlocks(compilerHandle));
+
+    switch (shaderType)
+    {
+        case GL_COMPUTE_SHADER:
+        {
+            localSize = sh::GetComputeShaderLocalGroupSize(compilerHandle);
+            break;
+        }
+        case GL_VERTEX_SHADER:
+        {
+            activeAttributes = GetActiveShaderVariables(sh::GetAttributes(compilerHandle));
+            break;
+        }
+        case GL_FRAGMENT_SHADER:
+        {
+            // TODO(jmadill): Figure out why we only sort in the FS, and if we need to.
+            std::sort(varyings.begin(), varyings.end(), CompareShaderVar);
+            activeOutputVariables =
+                GetActiveShaderVariables(sh::GetOutputVariables(compilerHandle));
+            break;
+        }
+        default:
+            UNREACHABLE();
+    }
+}
+
 // true if varying x has a higher priority in packing than y
 bool CompareShaderVar(const sh::ShaderVariable &x, const sh::ShaderVariable &y)
 {
@@ -101,8 +225,14 @@ Shader::Shader(ShaderProgramManager *manager,
     ASSERT(mImplementation);
 }
 
+void Shader::destroy(const Context *context)
+{
+    resolveCompile();
+}
+
 Shader::~Shader()
 {
+    ASSERT(!mCompileJob && mPendingLinks.empty());
     SafeDelete(mImplementation);
 }
 
@@ -230,6 +360,13 @@ void Shader::getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length,
 
 void Shader::compile(const Context *context)
 {
+    // The links that read the current results are done with them first.
+    while (!mPendingLinks.empty())
+    {
+        mPendingLinks.back()->resolveLink();
+    }
+    resolveCompile();
+
     mState.mTranslatedSource.clear();
     mInfoLog.clear();
     mState.mShaderVersion = 100;
@@ -240,7 +377,6 @@ void Shader::compile(const Context *context)
     mState.mActiveOutputVariables.clear();
 
     Compiler *compiler = context->getCompiler();
-    ShHandle compilerHandle = compiler->getCompilerHandle(mState.mShaderType);
 
     std::stringstream sourceStream;
 
@@ -266,84 +402,74 @@ void Shader::compile(const Context *context)
         compileOptions |= SH_VALIDATE_LOOP_INDEXING;
     }
 
-    std::string sourceString  = sourceStream.str();
-    std::vector<const char *> sourceCStrings;
+    mCompileJob.reset(new CompileJob(compiler, compiler->getInstance(mState.mShaderType),
+                                     mState.mShaderType, compileOptions, sourcePath,
+                                     sourceStream.str(), mState.mSource));
 
-    if (!sourcePath.empty())
+    angle::WorkerThreadPool *workerPool = context->getWorkerThreadPool();
+    if (workerPool)
     {
-        sourceCStrings.push_back(sourcePath.c_str());
+        mCompileJob->waitEvent = workerPool->postWorkerTask(mCompileJob.get());
+        return;
     }
 
-    sourceCStrings.push_back(sourceString.c_str());
-
-    bool result =
-        sh::Compile(compilerHandle, &sourceCStrings[0], sourceCStrings.size(), compileOptions);
+    (*mCompileJob)();
+    resolveCompile();
+}
 
-    if (!result)
+void Shader::resolveCompile()
+{
+    if (!mCompileJob)
     {
-        mInfoLog = sh::GetInfoLog(compilerHandle);
-        WARN() << std::endl << mInfoLog;
-        mCompiled = false;
         return;
     }
 
-    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
+    mCompileJob->waitEvent.wait();
 
-#ifndef NDEBUG
-    // Prefix translated shader with commented out un-translated shader.
-    // Useful in diagnostics tools which capture the shader source.
-    std::ostringstream shaderStream;
-    shaderStream << "// GLSL\n";
-    shaderStream << "//\n";
-
-    std::istringstream inputSourceStream(mState.mSource);
-    std::string line;
-    while (std::getline(inputSourceStream, line))
+    std::unique_ptr<CompileJob> job(std::move(mCompileJob));
+    if (!job->translated)
     {
-        // Remove null characters from the source line
-        line.erase(std::remove(line.begin(), line.end(), '\0'), line.end());
-
-        shaderStream << "// " << line;
+        mInfoLog = std::move(job->infoLog);
+        WARN() << std::endl << mInfoLog;
+        mCompiled = false;
     }
-    shaderStream << "\n\n";
-    shaderStream << mState.mTranslatedSource;
-    mState.mTranslatedSource = shaderStream.str();
-#endif
-
-    // Gather the shader information
-    mState.mShaderVersion = sh::GetShaderVersion(compilerHandle);
-
-    mState.mVaryings        = GetShaderVariables(sh::GetVaryings(compilerHandle));
-    mState.mUniforms        = GetShaderVariables(sh::GetUniforms(compilerHandle));
-    mState.mInterfaceBlocks = GetShaderVariables(sh::GetInterfaceBlocks(compilerHandle));
-
-    switch (mState.mShaderType)
+    else
     {
-        case GL_COMPUTE_SHADER:
-        {
-            mState.mLocalSize = sh::GetComputeShaderLocalGroupSize(compilerHandle);
-            break;
-        }
-        case GL_VERTEX_SHADER:
-        {
-            mState.mActiveAttributes = GetActiveShaderVariables(sh::GetAttributes(compilerHandle));
-            break;
-        }
-        case GL_FRAGMENT_SHADER:
+        mState.mTranslatedSource      = std::move(job->translatedSource);
+        mState.mShaderVersion         = job->shaderVersion;
+        mState.mVaryings              = std::move(job->varyings);
+        mState.mUniforms              = std::move(job->uniforms);
+        mState.mInterfaceBlocks       = std::move(job->interfaceBlocks);
+        mState.mActiveAttributes      = std::move(job->activeAttributes);
+        mState.mActiveOutputVariables = std::move(job->activeOutputVariables);
+        if (mState.mShaderType == GL_COMPUTE_SHADER)
         {
-            // TODO(jmadill): Figure out why we only sort in the FS, and if we need to.
-            std::sort(mState.mVaryings.begin(), mState.mVaryings.end(), CompareShaderVar);
-            mState.mActiveOutputVariables =
-                GetActiveShaderVariables(sh::GetOutputVariables(compilerHandle));
-            break;
+            mState.mLocalSize = job->localSize;
         }
-        default:
-            UNREACHABLE();
+
+        ASSERT(!mState.mTranslatedSource.empty());
+
+        mCompiled =
+            mImplementation->postTranslateCompile(job->compiler, job->compilerHandle, &mInfoLog);
     }
 
-    ASSERT(!mState.mTranslatedSource.empty());
+    job->compiler->putInstance(mState.mShaderType, job->compilerHandle);
+}
 
-    mCompiled = mImplementation->postTranslateCompile(compiler, &mInfoLog);
+bool Shader::isCompiling() const
+{
+    return mCompileJob && !mCompileJob->waitEvent.isReady();
+}
+
+void Shader::addPendingLink(Program *program)
+{
+    mPendingLinks.push_back(program);
+}
+
+void Shader::removePendingLink(Program *program)
+{
+    mPendingLinks.erase(std::remove(mPendingLinks.begin(), mPendingLinks.end(), program),
+                        mPendingLinks.end());
 }
 
 void Shader::addRef()
@@ -14,6 +14,7 @@
 
 #include <string>
 #include <list>
+#include <memory>
 #include <vector>
 
 #include "angle_gl.h"
@@ -35,6 +36,7 @@ namespace gl
 class Compiler;
 class ContextState;
 struct Limitations;
+class Program;
 class ShaderProgramManager;
 class Context;
 
@@ -89,7 +91,7 @@ class Shader final : angle::NonCopyable, public LabeledObject
            GLenum type,
            GLuint handle);
 
-    void destroy(const Context *context) {}
+    void destroy(const Context *context);
     virtual ~Shader();
 
     void setLabel(const std::string &label) override;
@@ -112,9 +114,18 @@ class Shader final : angle::NonCopyable, public LabeledObject
     void getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer) const;
     void getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer) const;
 
+    // Translates the shader on the context's worker threads if it has any. The results are taken
+    // by resolveCompile, which the shader lookups of the context call.
     void compile(const Context *context);
+    void resolveCompile();
+    bool isCompiling() const;
     bool isCompiled() const { return mCompiled; }
 
+    // Programs whose link reads the compiled state of the shader while the link isn't resolved.
+    // Compiling the shader again resolves them first.
+    void addPendingLink(Program *program);
+    void removePendingLink(Program *program);
+
     void addRef();
     void release(const Context *context);
     unsigned int getRefCount() const;
@@ -134,6 +145,8 @@ class Shader final : angle::NonCopyable, public LabeledObject
     const sh::WorkGroupSize &getWorkGroupSize() const { return mState.mLocalSize; }
 
   private:
+    struct CompileJob;
+
     static void getSourceImpl(const std::string &source, GLsizei bufSize, GLsizei *length, char *buffer);
 
     ShaderState mState;
@@ -146,6 +159,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
     bool mCompiled;             // Indicates if this shader has been successfully compiled
     std::string mInfoLog;
 
+    std::unique_ptr<CompileJob> mCompileJob;
+    std::vector<Program *> mPendingLinks;
+
     ShaderProgramManager *mResourceManager;
 };
 
@@ -0,0 +1,126 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// SizedMRUCache.h: Defines the angle::SizedMRUCache class, a most recently used cache whose
+// entries each have a size, and which evicts the least recently used entries once the sum of
+// the sizes goes above a limit.
+
+#ifndef LIBANGLE_SIZEDMRUCACHE_H_
+#define LIBANGLE_SIZEDMRUCACHE_H_
+
+#include "common/angleutils.h"
+#include "common/debug.h"
+
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace angle
+{
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class SizedMRUCache final : angle::NonCopyable
+{
+  public:
+    explicit SizedMRUCache(size_t maximumTotalSize)
+        : mMaximumTotalSize(maximumTotalSize), mCurrentSize(0)
+    {
+    }
+
+    // Adds the value, replacing any value stored under the same key. Returns nullptr when the
+    // value alone is larger than the maximum total size, in which case it isn't stored.
+    const Value *put(const Key &key, Value &&value, size_t size)
+    {
+        if (size > mMaximumTotalSize)
+        {
+            return nullptr;
+        }
+
+        eraseByKey(key);
+
+        mEntries.emplace_front(key, ValueAndSize(std::move(value), size));
+        mIndex.emplace(key, mEntries.begin());
+        mCurrentSize += size;
+
+        shrinkToSize(mMaximumTotalSize);
+        return &mEntries.front().second.value;
+    }
+
+    // Marks the entry as the most recently used one. The pointer stays valid until the entry is
+    // replaced or evicted.
+    bool get(const Key &key, const Value **valueOut)
+    {
+        auto indexIter = mIndex.find(key);
+        if (indexIter == mIndex.end())
+        {
+            return false;
+        }
+
+        mEntries.splice(mEntries.begin(), mEntries, indexIter->second);
+        *valueOut = &indexIter->second->second.value;
+        return true;
+    }
+
+    bool eraseByKey(const Key &key)
+    {
+        auto indexIter = mIndex.find(key);
+        if (indexIter == mIndex.end())
+        {
+            return false;
+        }
+
+        ASSERT(mCurrentSize >= indexIter->second->second.size);
+        mCurrentSize -= indexIter->second->second.size;
+        mEntries.erase(indexIter->second);
+        mIndex.erase(indexIter);
+        return true;
+    }
+
+    // Evicts the least recently used entries until the total size is at most |limit|.
+    void shrinkToSize(size_t limit)
+    {
+        while (mCurrentSize > limit)
+        {
+            ASSERT(!mEntries.empty());
+            const auto &oldest = mEntries.back();
+            mCurrentSize -= oldest.second.size;
+            mIndex.erase(oldest.first);
+            mEntries.pop_back();
+        }
+    }
+
+    void clear()
+    {
+        mEntries.clear();
+        mIndex.clear();
+        mCurrentSize = 0;
+    }
+
+    size_t entryCount() const { return mEntries.size(); }
+    size_t size() const { return mCurrentSize; }
+    size_t maxSize() const { return mMaximumTotalSize; }
+
+  private:
+    struct ValueAndSize
+    {
+        ValueAndSize(Value &&value, size_t size) : value(std::move(value)), size(size) {}
+
+        Value value;
+        size_t size;
+    };
+
+    // Ordered from the most to the least recently used entry.
+    using EntryList = std::list<std::pair<Key, ValueAndSize>>;
+
+    EntryList mEntries;
+    std::unordered_map<Key, typename EntryList::iterator, Hash> mIndex;
+    const size_t mMaximumTotalSize;
+    size_t mCurrentSize;
+};
+
+}  // namespace angle
+
+#endif  // LIBANGLE_SIZEDMRUCACHE_H_
@@ -0,0 +1,122 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for SizedMRUCache.
+//
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/SizedMRUCache.h"
+
+namespace
+{
+
+using Cache = angle::SizedMRUCache<int, std::string>;
+
+// Test that values can be put in and found again, and that missing keys aren't found.
+TEST(SizedMRUCacheTest, PutAndGet)
+{
+    Cache cache(100);
+
+    const std::string *value = nullptr;
+    EXPECT_FALSE(cache.get(1, &value));
+
+    EXPECT_NE(nullptr, cache.put(1, "one", 10));
+    EXPECT_NE(nullptr, cache.put(2, "two", 20));
+    EXPECT_EQ(2u, cache.entryCount());
+    EXPECT_EQ(30u, cache.size());
+
+    ASSERT_TRUE(cache.get(1, &value));
+    EXPECT_EQ("one", *value);
+    ASSERT_TRUE(cache.get(2, &value));
+    EXPECT_EQ("two", *value);
+    EXPECT_FALSE(cache.get(3, &value));
+}
+
+// Test that putting a value under an existing key replaces it.
+TEST(SizedMRUCacheTest, Replace)
+{
+    Cache cache(100);
+
+    cache.put(1, "one", 10);
+    cache.put(1, "uno", 40);
+    EXPECT_EQ(1u, cache.entryCount());
+    EXPECT_EQ(40u, cache.size());
+
+    const std::string *value = nullptr;
+    ASSERT_TRUE(cache.get(1, &value));
+    EXPECT_EQ("uno", *value);
+}
+
+// Test that the least recently used entries are evicted to stay within the maximum size, and that
+// get counts as a use.
+TEST(SizedMRUCacheTest, EvictsLeastRecentlyUsed)
+{
+    Cache cache(100);
+
+    cache.put(1, "one", 40);
+    cache.put(2, "two", 40);
+
+    const std::string *value = nullptr;
+    ASSERT_TRUE(cache.get(1, &value));
+
+    cache.put(3, "three", 40);
+    EXPECT_EQ(2u, cache.entryCount());
+    EXPECT_EQ(80u, cache.size());
+    EXPECT_TRUE(cache.get(1, &value));
+    EXPECT_FALSE(cache.get(2, &value));
+    EXPECT_TRUE(cache.get(3, &value));
+
+    // A large value can evict several entries at once.
+    cache.put(4, "four", 90);
+    EXPECT_EQ(1u, cache.entryCount());
+    EXPECT_EQ(90u, cache.size());
+    EXPECT_TRUE(cache.get(4, &value));
+}
+
+// Test that a value larger than the cache isn't stored and doesn't evict anything.
+TEST(SizedMRUCacheTest, TooLarge)
+{
+    Cache cache(100);
+
+    cache.put(1, "one", 10);
+    EXPECT_EQ(nullptr, cache.put(2, "two", 101));
+    EXPECT_EQ(1u, cache.entryCount());
+
+    const std::string *value = nullptr;
+    EXPECT_TRUE(cache.get(1, &value));
+    EXPECT_FALSE(cache.get(2, &value));
+}
+
+// Test erasing, shrinking and clearing.
+TEST(SizedMRUCacheTest, EraseShrinkAndClear)
+{
+    Cache cache(100);
+
+    cache.put(1, "one", 10);
+    cache.put(2, "two", 20);
+    cache.put(3, "three", 30);
+
+    EXPECT_TRUE(cache.eraseByKey(2));
+    EXPECT_FALSE(cache.eraseByKey(2));
+    EXPECT_EQ(40u, cache.size());
+
+    cache.shrinkToSize(35);
+    EXPECT_EQ(1u, cache.entryCount());
+    EXPECT_EQ(30u, cache.size());
+
+    const std::string *value = nullptr;
+    EXPECT_TRUE(cache.get(3, &value));
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.entryCount());
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_EQ(100u, cache.maxSize());
+    EXPECT_FALSE(cache.get(3, &value));
+}
+
+}  // anonymous namespace
@@ -63,7 +63,11 @@ State::State()
       mMultiSampling(false),
       mSampleAlphaToOne(false),
       mFramebufferSRGB(true),
-      mRobustResourceInit(false)
+      mRobustResourceInit(false),
+      mMaxShaderCompilerThreads(std::numeric_limits<GLuint>::max()),
+      mDrawStatesCacheValid(false),
+      mDrawStatesCacheFramebufferSerial(0),
+      mDrawStatesCacheProgramSerial(0)
 {
 }
 
@@ -166,33 +170,19 @@ void State::initialize(const Caps &caps,
 
     mUniformBuffers.resize(caps.maxUniformBufferBindings);
 
-    mSamplerTextures[GL_TEXTURE_2D].resize(caps.maxCombinedTextureImageUnits);
-    mSamplerTextures[GL_TEXTURE_CUBE_MAP].resize(caps.maxCombinedTextureImageUnits);
-    if (clientVersion >= Version(3, 0))
-    {
-        // TODO: These could also be enabled via extension
-        mSamplerTextures[GL_TEXTURE_2D_ARRAY].resize(caps.maxCombinedTextureImageUnits);
-        mSamplerTextures[GL_TEXTURE_3D].resize(caps.maxCombinedTextureImageUnits);
-    }
+    // The zero textures of the texture types this context supports are bound later, in
+    // initializeZeroTextures.
+    ASSERT(caps.maxCombinedTextureImageUnits <= IMPLEMENTATION_MAX_ACTIVE_TEXTURES);
+    mBoundTextureUnits.reset();
+
     if (clientVersion >= Version(3, 1))
     {
-        mSamplerTextures[GL_TEXTURE_2D_MULTISAMPLE].resize(caps.maxCombinedTextureImageUnits);
-
         mAtomicCounterBuffers.resize(caps.maxAtomicCounterBufferBindings);
         mShaderStorageBuffers.resize(caps.maxShaderStorageBufferBindings);
     }
-    if (extensions.eglImageExternal || extensions.eglStreamConsumerExternal)
-    {
-        mSamplerTextures[GL_TEXTURE_EXTERNAL_OES].resize(caps.maxCombinedTextureImageUnits);
-    }
 
     mSamplers.resize(caps.maxCombinedTextureImageUnits);
-
-    mActiveQueries[GL_ANY_SAMPLES_PASSED].set(nullptr);
-    mActiveQueries[GL_ANY_SAMPLES_PASSED_CONSERVATIVE].set(nullptr);
-    mActiveQueries[GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN].set(nullptr);
-    mActiveQueries[GL_TIME_ELAPSED_EXT].set(nullptr);
-    mActiveQueries[GL_COMMANDS_COMPLETED_CHROMIUM].set(nullptr);
+    mSamplerCompletenessCache.resize(caps.maxCombinedTextureImageUnits);
 
     mProgram = nullptr;
 
@@ -223,18 +213,19 @@ void State::initialize(const Caps &caps,
 
 void State::reset(const Context *context)
 {
-    for (TextureBindingMap::iterator bindingVec = mSamplerTextures.begin(); bindingVec != mSamplerTextures.end(); bindingVec++)
+    for (TextureBindingArray &textureArray : mSamplerTextures)
     {
-        TextureBindingVector &textureVector = bindingVec->second;
-        for (size_t textureIdx = 0; textureIdx < textureVector.size(); textureIdx++)
+        for (size_t textureIdx = 0; textureIdx < mMaxCombinedTextureImageUnits; textureIdx++)
         {
-            textureVector[textureIdx].set(NULL);
+            textureArray[textureIdx].set(NULL);
         }
     }
+    mBoundTextureUnits.reset();
     for (size_t samplerIdx = 0; samplerIdx < mSamplers.size(); samplerIdx++)
     {
         mSamplers[samplerIdx].set(NULL);
     }
+    mSamplerCompletenessCache.assign(mSamplerCompletenessCache.size(), SamplerCompletenessCache());
 
     mArrayBuffer.set(NULL);
     mDrawIndirectBuffer.set(NULL);
@@ -248,9 +239,9 @@ void State::reset(const Context *context)
 
     mTransformFeedback.set(NULL);
 
-    for (State::ActiveQueryMap::iterator i = mActiveQueries.begin(); i != mActiveQueries.end(); i++)
+    for (BindingPointer<Query> &activeQuery : mActiveQueries)
     {
-        i->second.set(NULL);
+        activeQuery.set(NULL);
     }
 
     mGenericUniformBuffer.set(NULL);
@@ -338,6 +329,7 @@ void State::setDepthMask(bool mask)
 {
     mDepthStencil.depthMask = mask;
     mDirtyBits.set(DIRTY_BIT_DEPTH_MASK);
+    invalidateDrawStatesCache();
 }
 
 bool State::isRasterizerDiscardEnabled() const
@@ -383,6 +375,7 @@ void State::setDepthTest(bool enabled)
 {
     mDepthStencil.depthTest = enabled;
     mDirtyBits.set(DIRTY_BIT_DEPTH_TEST_ENABLED);
+    invalidateDrawStatesCache();
 }
 
 void State::setDepthFunc(GLenum depthFunc)
@@ -458,6 +451,7 @@ void State::setStencilTest(bool enabled)
 {
     mDepthStencil.stencilTest = enabled;
     mDirtyBits.set(DIRTY_BIT_STENCIL_TEST_ENABLED);
+    invalidateDrawStatesCache();
 }
 
 void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stencilMask)
@@ -466,6 +460,7 @@ void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stenci
     mStencilRef = (stencilRef > 0) ? stencilRef : 0;
     mDepthStencil.stencilMask = stencilMask;
     mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_FRONT);
+    invalidateDrawStatesCache();
 }
 
 void State::setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, GLuint stencilBackMask)
@@ -474,18 +469,21 @@ void State::setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, G
     mStencilBackRef = (stencilBackRef > 0) ? stencilBackRef : 0;
     mDepthStencil.stencilBackMask = stencilBackMask;
     mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_BACK);
+    invalidateDrawStatesCache();
 }
 
 void State::setStencilWritemask(GLuint stencilWritemask)
 {
     mDepthStencil.stencilWritemask = stencilWritemask;
     mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+    invalidateDrawStatesCache();
 }
 
 void State::setStencilBackWritemask(GLuint stencilBackWritemask)
 {
     mDepthStencil.stencilBackWritemask = stencilBackWritemask;
     mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+    invalidateDrawStatesCache();
 }
 
 void State::setStencilOperations(GLenum stencilFail, GLenum stencilPassDepthFail, GLenum stencilPassDepthPass)
@@ -776,7 +774,10 @@ unsigned int State::getActiveSampler() const
 
 void State::setSamplerTexture(GLenum type, Texture *texture)
 {
-    mSamplerTextures[type][mActiveSampler].set(texture);
+    mSamplerTextures[GetTextureType(type)][mActiveSampler].set(texture);
+    updateBoundTextureUnit(mActiveSampler);
+    mSamplerCompletenessCache[mActiveSampler] = SamplerCompletenessCache();
+    invalidateDrawStatesCache();
 }
 
 Texture *State::getTargetTexture(GLenum target) const
@@ -786,18 +787,14 @@ Texture *State::getTargetTexture(GLenum target) const
 
 Texture *State::getSamplerTexture(unsigned int sampler, GLenum type) const
 {
-    const auto it = mSamplerTextures.find(type);
-    ASSERT(it != mSamplerTextures.end());
-    ASSERT(sampler < it->second.size());
-    return it->second[sampler].get();
+    ASSERT(sampler < mMaxCombinedTextureImageUnits);
+    return mSamplerTextures[GetTextureType(type)][sampler].get();
 }
 
 GLuint State::getSamplerTextureId(unsigned int sampler, GLenum type) const
 {
-    const auto it = mSamplerTextures.find(type);
-    ASSERT(it != mSamplerTextures.end());
-    ASSERT(sampler < it->second.size());
-    return it->second[sampler].id();
+    ASSERT(sampler < mMaxCombinedTextureImageUnits);
+    return mSamplerTextures[GetTextureType(type)][sampler].id();
 }
 
 void State::detachTexture(const Context *context, const TextureMap &zeroTextures, GLuint texture)
@@ -811,21 +808,30 @@ void State::detachTexture(const Context *context, const TextureMap &zeroTextures
     // If a texture object is deleted, it is as if all texture units which are bound to that texture object are
     // rebound to texture object zero
 
-    for (auto &bindingVec : mSamplerTextures)
+    // Only units with a non-default texture bound can refer to a deleted texture.
+    ASSERT(texture != 0);
+    for (size_t textureIdx : angle::IterateBitSet(mBoundTextureUnits))
     {
-        GLenum textureType = bindingVec.first;
-        TextureBindingVector &textureVector = bindingVec.second;
-        for (size_t textureIdx = 0; textureIdx < textureVector.size(); textureIdx++)
+        bool detached = false;
+        for (size_t typeIndex = 0; typeIndex < TEXTURE_TYPE_MAX; typeIndex++)
         {
-            BindingPointer<Texture> &binding = textureVector[textureIdx];
+            BindingPointer<Texture> &binding = mSamplerTextures[typeIndex][textureIdx];
             if (binding.id() == texture)
             {
-                auto it = zeroTextures.find(textureType);
+                auto it = zeroTextures.find(GetTextureTarget(static_cast<TextureType>(typeIndex)));
                 ASSERT(it != zeroTextures.end());
                 // Zero textures are the "default" textures instead of NULL
                 binding.set(it->second.get());
+                detached = true;
             }
         }
+
+        if (detached)
+        {
+            updateBoundTextureUnit(textureIdx);
+            mSamplerCompletenessCache[textureIdx] = SamplerCompletenessCache();
+            invalidateDrawStatesCache();
+        }
     }
 
     // [OpenGL ES 2.0.24] section 4.4 page 112:
@@ -848,18 +854,69 @@ void State::initializeZeroTextures(const TextureMap &zeroTextures)
 {
     for (const auto &zeroTexture : zeroTextures)
     {
-        auto &samplerTextureArray = mSamplerTextures[zeroTexture.first];
+        auto &samplerTextureArray = mSamplerTextures[GetTextureType(zeroTexture.first)];
 
-        for (size_t textureUnit = 0; textureUnit < samplerTextureArray.size(); ++textureUnit)
+        for (size_t textureUnit = 0; textureUnit < mMaxCombinedTextureImageUnits; ++textureUnit)
         {
             samplerTextureArray[textureUnit].set(zeroTexture.second.get());
         }
     }
+    mBoundTextureUnits.reset();
+    mSamplerCompletenessCache.assign(mSamplerCompletenessCache.size(), SamplerCompletenessCache());
+
+    invalidateDrawStatesCache();
+}
+
+bool State::isSamplerTextureComplete(const ContextState &data,
+                                     unsigned int sampler,
+                                     GLenum type) const
+{
+    const Texture *texture = getSamplerTexture(sampler, type);
+    if (texture == nullptr)
+    {
+        return false;
+    }
+
+    const TextureState &textureState = texture->getTextureState();
+    const Sampler *samplerObject     = mSamplers[sampler].get();
+    unsigned int textureSerial       = textureState.getCompletenessSerial();
+    unsigned int samplerSerial       = samplerObject ? samplerObject->getSamplerStateSerial() : 0;
+
+    SamplerCompletenessCache &cacheEntry = mSamplerCompletenessCache[sampler];
+    if (cacheEntry.texture != texture || cacheEntry.textureSerial != textureSerial ||
+        cacheEntry.samplerSerial != samplerSerial)
+    {
+        const SamplerState &samplerState =
+            samplerObject ? samplerObject->getSamplerState() : textureState.getSamplerState();
+
+        cacheEntry.texture         = texture;
+        cacheEntry.textureSerial   = textureSerial;
+        cacheEntry.samplerSerial   = samplerSerial;
+        cacheEntry.samplerComplete = textureState.isSamplerComplete(samplerState, data);
+    }
+
+    return cacheEntry.samplerComplete;
+}
+
+void State::updateBoundTextureUnit(size_t textureUnit)
+{
+    bool bound = false;
+    for (const TextureBindingArray &textureArray : mSamplerTextures)
+    {
+        bound = bound || textureArray[textureUnit].id() != 0;
+    }
+    mBoundTextureUnits.set(textureUnit, bound);
+}
+
+State::SamplerCompletenessCache::SamplerCompletenessCache()
+    : texture(nullptr), textureSerial(0), samplerSerial(0), samplerComplete(false)
+{
 }
 
 void State::setSamplerBinding(GLuint textureUnit, Sampler *sampler)
 {
     mSamplers[textureUnit].set(sampler);
+    mSamplerCompletenessCache[textureUnit] = SamplerCompletenessCache();
 }
 
 GLuint State::getSamplerId(GLuint textureUnit) const
@@ -885,6 +942,7 @@ void State::detachSampler(GLuint sampler)
         if (samplerBinding.id() == sampler)
         {
             samplerBinding.set(NULL);
+            mSamplerCompletenessCache[textureUnit] = SamplerCompletenessCache();
         }
     }
 }
@@ -956,6 +1014,7 @@ void State::setDrawFramebufferBinding(Framebuffer *framebuffer)
 
     mDrawFramebuffer = framebuffer;
     mDirtyBits.set(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
+    invalidateDrawStatesCache();
 
     if (mDrawFramebuffer && mDrawFramebuffer->hasAnyDirtyBit())
     {
@@ -1102,6 +1161,8 @@ void State::setProgram(const Context *context, Program *newProgram)
         {
             newProgram->addRef();
         }
+
+        invalidateDrawStatesCache();
     }
 }
 
@@ -1139,9 +1200,9 @@ bool State::removeTransformFeedbackBinding(GLuint transformFeedback)
 
 bool State::isQueryActive(const GLenum type) const
 {
-    for (auto &iter : mActiveQueries)
+    for (const BindingPointer<Query> &activeQuery : mActiveQueries)
     {
-        const Query *query = iter.second.get();
+        const Query *query = activeQuery.get();
         if (query != nullptr && ActiveQueryType(query->getType()) == ActiveQueryType(type))
         {
             return true;
@@ -1153,9 +1214,9 @@ bool State::isQueryActive(const GLenum type) const
 
 bool State::isQueryActive(Query *query) const
 {
-    for (auto &iter : mActiveQueries)
+    for (const BindingPointer<Query> &activeQuery : mActiveQueries)
     {
-        if (iter.second.get() == query)
+        if (activeQuery.get() == query)
         {
             return true;
         }
@@ -1166,7 +1227,7 @@ bool State::isQueryActive(Query *query) const
 
 void State::setActiveQuery(GLenum target, Query *query)
 {
-    mActiveQueries[target].set(query);
+    mActiveQueries[GetQueryType(target)].set(query);
 }
 
 GLuint State::getActiveQueryId(GLenum target) const
@@ -1177,12 +1238,7 @@ GLuint State::getActiveQueryId(GLenum target) const
 
 Query *State::getActiveQuery(GLenum target) const
 {
-    const auto it = mActiveQueries.find(target);
-
-    // All query types should already exist in the activeQueries map
-    ASSERT(it != mActiveQueries.end());
-
-    return it->second.get();
+    return mActiveQueries[GetQueryType(target)].get();
 }
 
 void State::setArrayBufferBinding(Buffer *buffer)
@@ -1209,6 +1265,7 @@ void State::setGenericUniformBufferBinding(Buffer *buffer)
 void State::setIndexedUniformBufferBinding(GLuint index, Buffer *buffer, GLintptr offset, GLsizeiptr size)
 {
     mUniformBuffers[index].set(buffer, offset, size);
+    invalidateDrawStatesCache();
 }
 
 const OffsetBindingPointer<Buffer> &State::getIndexedUniformBuffer(size_t index) const
@@ -1322,6 +1379,7 @@ void State::detachBuffer(GLuint bufferName)
     }
 
     getVertexArray()->detachBuffer(bufferName);
+    invalidateDrawStatesCache();
 }
 
 void State::setEnableVertexAttribArray(unsigned int attribNum, bool enabled)
@@ -1610,6 +1668,16 @@ bool State::getFramebufferSRGB() const
     return mFramebufferSRGB;
 }
 
+void State::setMaxShaderCompilerThreads(GLuint count)
+{
+    mMaxShaderCompilerThreads = count;
+}
+
+GLuint State::getMaxShaderCompilerThreads() const
+{
+    return mMaxShaderCompilerThreads;
+}
+
 void State::getBooleanv(GLenum pname, GLboolean *params)
 {
     switch (pname)
@@ -1966,6 +2034,9 @@ void State::getIntegerv(const Context *context, GLenum pname, GLint *params)
       case GL_SHADER_STORAGE_BUFFER_BINDING:
           *params = mGenericShaderStorageBuffer.id();
           break;
+      case GL_MAX_SHADER_COMPILER_THREADS_KHR:
+          *params = clampCast<GLint>(mMaxShaderCompilerThreads);
+          break;
       default:
         UNREACHABLE();
         break;
@@ -2077,6 +2148,46 @@ void State::getBooleani_v(GLenum target, GLuint index, GLboolean *data)
     UNREACHABLE();
 }
 
+bool State::isDrawStatesCacheValid() const
+{
+    return mDrawStatesCacheValid && mDrawFramebuffer && mProgram &&
+           mDrawFramebuffer->getCompletenessSerial() == mDrawStatesCacheFramebufferSerial &&
+           mProgram->getValidationSerial() == mDrawStatesCacheProgramSerial &&
+           !uniformBufferSizesChanged();
+}
+
+void State::setDrawStatesCacheValid() const
+{
+    ASSERT(mDrawFramebuffer && mProgram);
+    mDrawStatesCacheValid             = true;
+    mDrawStatesCacheFramebufferSerial = mDrawFramebuffer->getCompletenessSerial();
+    mDrawStatesCacheProgramSerial     = mProgram->getValidationSerial();
+
+    mDrawStatesCacheUniformBufferSizes.clear();
+    for (unsigned int uniformBlockIndex = 0;
+         uniformBlockIndex < mProgram->getActiveUniformBlockCount(); uniformBlockIndex++)
+    {
+        GLuint blockBinding  = mProgram->getUniformBlockBinding(uniformBlockIndex);
+        const Buffer *buffer = mUniformBuffers[blockBinding].get();
+        ASSERT(buffer);
+        mDrawStatesCacheUniformBufferSizes.emplace_back(buffer, buffer->getSize());
+    }
+}
+
+bool State::uniformBufferSizesChanged() const
+{
+    // The buffers can be resized by any context in the share group, so their sizes are compared
+    // instead of relying on this context's calls. Rebinding them drops the cache.
+    for (const auto &bufferSize : mDrawStatesCacheUniformBufferSizes)
+    {
+        if (bufferSize.first->getSize() != bufferSize.second)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool State::hasMappedBuffer(GLenum target) const
 {
     if (target == GL_ARRAY_BUFFER)
@@ -2106,6 +2217,13 @@ bool State::hasMappedBuffer(GLenum target) const
 
 void State::syncDirtyObjects(const Context *context)
 {
+    // Uniform updates don't go through the State and can target any program, so the current
+    // program is checked directly.
+    if (mProgram && mProgram->hasDirtyUniforms())
+    {
+        mDirtyObjects.set(DIRTY_OBJECT_PROGRAM);
+    }
+
     if (!mDirtyObjects.any())
         return;
 
@@ -2131,7 +2249,10 @@ void State::syncDirtyObjects(const Context *context, const DirtyObjects &bitset)
                 mVertexArray->syncImplState(context);
                 break;
             case DIRTY_OBJECT_PROGRAM:
-                // TODO(jmadill): implement this
+                if (mProgram)
+                {
+                    mProgram->syncState(context);
+                }
                 break;
             default:
                 UNREACHABLE();
@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_STATE_H_
 #define LIBANGLE_STATE_H_
 
+#include <array>
 #include <bitset>
 #include <memory>
 
@@ -30,6 +31,7 @@ namespace gl
 class Query;
 class VertexArray;
 class Context;
+class ContextState;
 struct Caps;
 
 typedef std::map<GLenum, BindingPointer<Texture>> TextureMap;
@@ -170,6 +172,11 @@ class State : angle::NonCopyable
     GLuint getSamplerTextureId(unsigned int sampler, GLenum type) const;
     void detachTexture(const Context *context, const TextureMap &zeroTextures, GLuint texture);
     void initializeZeroTextures(const TextureMap &zeroTextures);
+    // Units that have a non-default texture bound to any target.
+    const ActiveTextureMask &getBoundTextureUnits() const { return mBoundTextureUnits; }
+    // Sampler completeness of the texture bound to |type| on |sampler|, sampled with the unit's
+    // sampler object if there is one. Cached until the binding or the objects change.
+    bool isSamplerTextureComplete(const ContextState &data, unsigned int sampler, GLenum type) const;
 
     // Sampler object binding manipulation
     void setSamplerBinding(GLuint textureUnit, Sampler *sampler);
@@ -332,6 +339,10 @@ class State : angle::NonCopyable
     void setFramebufferSRGB(bool sRGB);
     bool getFramebufferSRGB() const;
 
+    // GL_KHR_parallel_shader_compile
+    void setMaxShaderCompilerThreads(GLuint count);
+    GLuint getMaxShaderCompilerThreads() const;
+
     // State query functions
     void getBooleanv(GLenum pname, GLboolean *params);
     void getFloatv(GLenum pname, GLfloat *params);
@@ -344,6 +355,14 @@ class State : angle::NonCopyable
     bool hasMappedBuffer(GLenum target) const;
     bool isRobustResourceInitEnabled() const { return mRobustResourceInit; }
 
+    // Cache of a successful ValidateDrawBase state walk. It is dropped by the state changes that
+    // feed into the walk (see invalidateDrawStatesCache), by changes to the bound framebuffer and
+    // program, which are detected through their serials, and by resizing a uniform buffer that
+    // the program uses.
+    bool isDrawStatesCacheValid() const;
+    void setDrawStatesCacheValid() const;
+    void invalidateDrawStatesCache() { mDrawStatesCacheValid = false; }
+
     enum DirtyBitType
     {
         DIRTY_BIT_SCISSOR_TEST_ENABLED,
@@ -429,7 +448,11 @@ class State : angle::NonCopyable
     const DirtyBits &getDirtyBits() const { return mDirtyBits; }
     void clearDirtyBits() { mDirtyBits.reset(); }
     void clearDirtyBits(const DirtyBits &bitset) { mDirtyBits &= ~bitset; }
-    void setAllDirtyBits() { mDirtyBits.set(); }
+    void setAllDirtyBits()
+    {
+        mDirtyBits.set();
+        invalidateDrawStatesCache();
+    }
 
     typedef std::bitset<DIRTY_OBJECT_MAX> DirtyObjects;
     void clearDirtyObjects() { mDirtyObjects.reset(); }
@@ -440,6 +463,9 @@ class State : angle::NonCopyable
     void setObjectDirty(GLenum target);
 
   private:
+    void updateBoundTextureUnit(size_t textureUnit);
+    bool uniformBufferSizesChanged() const;
+
     // Cached values from Context's caps
     GLuint mMaxDrawBuffers;
     GLuint mMaxCombinedTextureImageUnits;
@@ -488,15 +514,28 @@ class State : angle::NonCopyable
     // Texture and sampler bindings
     size_t mActiveSampler;   // Active texture unit selector - GL_TEXTURE0
 
-    typedef std::vector<BindingPointer<Texture>> TextureBindingVector;
-    typedef std::map<GLenum, TextureBindingVector> TextureBindingMap;
-    TextureBindingMap mSamplerTextures;
+    typedef std::array<BindingPointer<Texture>, IMPLEMENTATION_MAX_ACTIVE_TEXTURES>
+        TextureBindingArray;
+    std::array<TextureBindingArray, TEXTURE_TYPE_MAX> mSamplerTextures;
+    ActiveTextureMask mBoundTextureUnits;
 
     typedef std::vector<BindingPointer<Sampler>> SamplerBindingVector;
     SamplerBindingVector mSamplers;
 
-    typedef std::map<GLenum, BindingPointer<Query>> ActiveQueryMap;
-    ActiveQueryMap mActiveQueries;
+    // One entry per texture unit, reset when the unit's texture or sampler bindings change. The
+    // serials catch modifications of the bound objects, which may happen in other contexts.
+    struct SamplerCompletenessCache
+    {
+        SamplerCompletenessCache();
+
+        const Texture *texture;
+        unsigned int textureSerial;
+        unsigned int samplerSerial;
+        bool samplerComplete;
+    };
+    mutable std::vector<SamplerCompletenessCache> mSamplerCompletenessCache;
+
+    std::array<BindingPointer<Query>, QUERY_TYPE_MAX> mActiveQueries;
 
     BindingPointer<Buffer> mGenericUniformBuffer;
     typedef std::vector<OffsetBindingPointer<Buffer>> BufferVector;
@@ -538,8 +577,17 @@ class State : angle::NonCopyable
     // GL_ANGLE_robust_resource_intialization
     bool mRobustResourceInit;
 
+    // GL_KHR_parallel_shader_compile
+    GLuint mMaxShaderCompilerThreads;
+
     DirtyBits mDirtyBits;
     DirtyObjects mDirtyObjects;
+
+    // Draw validation cache, filled in by validation on a successful draw.
+    mutable bool mDrawStatesCacheValid;
+    mutable unsigned int mDrawStatesCacheFramebufferSerial;
+    mutable unsigned int mDrawStatesCacheProgramSerial;
+    mutable std::vector<std::pair<const Buffer *, GLint64>> mDrawStatesCacheUniformBufferSizes;
 };
 
 }  // namespace gl
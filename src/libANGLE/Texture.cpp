@@ -98,7 +98,7 @@ TextureState::TextureState(GLenum target)
       mUsage(GL_NONE),
       mImageDescs((IMPLEMENTATION_MAX_TEXTURE_LEVELS + 1) *
                   (target == GL_TEXTURE_CUBE_MAP ? 6 : 1)),
-      mCompletenessCache()
+      mCompletenessSerial(0)
 {
 }
 
@@ -199,35 +199,6 @@ bool TextureState::isCubeComplete() const
 
 bool TextureState::isSamplerComplete(const SamplerState &samplerState,
                                      const ContextState &data) const
-{
-    bool newEntry  = false;
-    auto cacheIter = mCompletenessCache.find(data.getContextID());
-    if (cacheIter == mCompletenessCache.end())
-    {
-        // Add a new cache entry
-        cacheIter = mCompletenessCache
-                        .insert(std::make_pair(data.getContextID(), SamplerCompletenessCache()))
-                        .first;
-        newEntry = true;
-    }
-
-    SamplerCompletenessCache *cacheEntry = &cacheIter->second;
-    if (newEntry || cacheEntry->samplerState != samplerState)
-    {
-        cacheEntry->samplerState    = samplerState;
-        cacheEntry->samplerComplete = computeSamplerCompleteness(samplerState, data);
-    }
-
-    return cacheEntry->samplerComplete;
-}
-
-void TextureState::invalidateCompletenessCache()
-{
-    mCompletenessCache.clear();
-}
-
-bool TextureState::computeSamplerCompleteness(const SamplerState &samplerState,
-                                              const ContextState &data) const
 {
     if (mBaseLevel > mMaxLevel)
     {
@@ -508,11 +479,6 @@ void TextureState::clearImageDescs()
     invalidateCompletenessCache();
 }
 
-TextureState::SamplerCompletenessCache::SamplerCompletenessCache()
-    : samplerState(), samplerComplete(false)
-{
-}
-
 Texture::Texture(rx::GLImplFactory *factory, GLuint id, GLenum target)
     : egl::ImageSibling(id),
       mState(target),
@@ -601,6 +567,7 @@ GLenum Texture::getSwizzleAlpha() const
 void Texture::setMinFilter(GLenum minFilter)
 {
     mState.mSamplerState.minFilter = minFilter;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_MIN_FILTER);
 }
 
@@ -612,6 +579,7 @@ GLenum Texture::getMinFilter() const
 void Texture::setMagFilter(GLenum magFilter)
 {
     mState.mSamplerState.magFilter = magFilter;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_MAG_FILTER);
 }
 
@@ -623,6 +591,7 @@ GLenum Texture::getMagFilter() const
 void Texture::setWrapS(GLenum wrapS)
 {
     mState.mSamplerState.wrapS = wrapS;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_WRAP_S);
 }
 
@@ -634,6 +603,7 @@ GLenum Texture::getWrapS() const
 void Texture::setWrapT(GLenum wrapT)
 {
     mState.mSamplerState.wrapT = wrapT;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_WRAP_T);
 }
 
@@ -645,6 +615,7 @@ GLenum Texture::getWrapT() const
 void Texture::setWrapR(GLenum wrapR)
 {
     mState.mSamplerState.wrapR = wrapR;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_WRAP_R);
 }
 
@@ -656,6 +627,7 @@ GLenum Texture::getWrapR() const
 void Texture::setMaxAnisotropy(float maxAnisotropy)
 {
     mState.mSamplerState.maxAnisotropy = maxAnisotropy;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_MAX_ANISOTROPY);
 }
 
@@ -667,6 +639,7 @@ float Texture::getMaxAnisotropy() const
 void Texture::setMinLod(GLfloat minLod)
 {
     mState.mSamplerState.minLod = minLod;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_MIN_LOD);
 }
 
@@ -678,6 +651,7 @@ GLfloat Texture::getMinLod() const
 void Texture::setMaxLod(GLfloat maxLod)
 {
     mState.mSamplerState.maxLod = maxLod;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_MAX_LOD);
 }
 
@@ -689,6 +663,7 @@ GLfloat Texture::getMaxLod() const
 void Texture::setCompareMode(GLenum compareMode)
 {
     mState.mSamplerState.compareMode = compareMode;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_COMPARE_MODE);
 }
 
@@ -700,6 +675,7 @@ GLenum Texture::getCompareMode() const
 void Texture::setCompareFunc(GLenum compareFunc)
 {
     mState.mSamplerState.compareFunc = compareFunc;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_COMPARE_FUNC);
 }
 
@@ -711,6 +687,7 @@ GLenum Texture::getCompareFunc() const
 void Texture::setSRGBDecode(GLenum sRGBDecode)
 {
     mState.mSamplerState.sRGBDecode = sRGBDecode;
+    mState.invalidateCompletenessCache();
     mDirtyBits.set(DIRTY_BIT_SRGB_DECODE);
 }
 
@@ -100,7 +100,10 @@ struct TextureState final : public angle::NonCopyable
     bool isCubeComplete() const;
     bool isSamplerComplete(const SamplerState &samplerState, const ContextState &data) const;
 
-    void invalidateCompletenessCache();
+    // Sampler completeness is cached by each context's State, this serial changes whenever the
+    // texture state that completeness depends on is modified.
+    void invalidateCompletenessCache() { mCompletenessSerial++; }
+    unsigned int getCompletenessSerial() const { return mCompletenessSerial; }
 
     const ImageDesc &getImageDesc(GLenum target, size_t level) const;
 
@@ -116,8 +119,6 @@ struct TextureState final : public angle::NonCopyable
     friend class rx::TextureGL;
     friend bool operator==(const TextureState &a, const TextureState &b);
 
-    bool computeSamplerCompleteness(const SamplerState &samplerState,
-                                    const ContextState &data) const;
     bool computeMipmapCompleteness() const;
     bool computeLevelCompleteness(GLenum target, size_t level) const;
 
@@ -155,19 +156,7 @@ struct TextureState final : public angle::NonCopyable
 
     std::vector<ImageDesc> mImageDescs;
 
-    struct SamplerCompletenessCache
-    {
-        SamplerCompletenessCache();
-
-        // All values that affect sampler completeness that are not stored within
-        // the texture itself
-        SamplerState samplerState;
-
-        // Result of the sampler completeness with the above parameters
-        bool samplerComplete;
-    };
-
-    mutable std::unordered_map<ContextID, SamplerCompletenessCache> mCompletenessCache;
+    unsigned int mCompletenessSerial;
 };
 
 bool operator==(const TextureState &a, const TextureState &b);
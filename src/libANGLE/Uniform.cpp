@@ -6,8 +6,10 @@
 
 #include "libANGLE/Uniform.h"
 
+#include "common/mathutil.h"
 #include "common/utilities.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace gl
@@ -44,15 +46,10 @@ LinkedUniform::LinkedUniform(const sh::Uniform &uniform)
 LinkedUniform::LinkedUniform(const LinkedUniform &uniform)
     : sh::Uniform(uniform), blockIndex(uniform.blockIndex), blockInfo(uniform.blockInfo)
 {
-    // This function is not intended to be called during runtime.
-    ASSERT(uniform.mLazyData.empty());
 }
 
 LinkedUniform &LinkedUniform::operator=(const LinkedUniform &uniform)
 {
-    // This function is not intended to be called during runtime.
-    ASSERT(uniform.mLazyData.empty());
-
     sh::Uniform::operator=(uniform);
     blockIndex           = uniform.blockIndex;
     blockInfo            = uniform.blockInfo;
@@ -69,69 +66,125 @@ bool LinkedUniform::isInDefaultBlock() const
     return blockIndex == -1;
 }
 
-size_t LinkedUniform::dataSize() const
+bool LinkedUniform::isSampler() const
 {
-    ASSERT(type != GL_STRUCT_ANGLEX);
-    if (mLazyData.empty())
-    {
-        mLazyData.resize(VariableExternalSize(type) * elementCount());
-        ASSERT(!mLazyData.empty());
-    }
+    return IsSamplerType(type);
+}
 
-    return mLazyData.size();
+bool LinkedUniform::isImage() const
+{
+    return IsImageType(type);
 }
 
-uint8_t *LinkedUniform::data()
+bool LinkedUniform::isField() const
 {
-    if (mLazyData.empty())
-    {
-        // dataSize() will init the data store.
-        size_t size = dataSize();
-        memset(mLazyData.data(), 0, size);
-    }
+    return name.find('.') != std::string::npos;
+}
 
-    return mLazyData.data();
+size_t LinkedUniform::getElementSize() const
+{
+    return VariableExternalSize(type);
 }
 
-const uint8_t *LinkedUniform::data() const
+size_t LinkedUniform::getElementComponents() const
 {
-    return const_cast<LinkedUniform *>(this)->data();
+    return VariableComponentCount(type);
 }
 
-bool LinkedUniform::isSampler() const
+UniformStorage::UniformStorage() : mData(nullptr), mSize(0)
 {
-    return IsSamplerType(type);
 }
 
-bool LinkedUniform::isImage() const
+UniformStorage::~UniformStorage()
 {
-    return IsImageType(type);
 }
 
-bool LinkedUniform::isField() const
+bool UniformStorage::init(const std::vector<LinkedUniform> &uniforms)
 {
-    return name.find('.') != std::string::npos;
+    mEntries.resize(uniforms.size());
+    mDirtyUniforms.clear();
+
+    size_t offset = 0;
+    for (size_t uniformIndex = 0; uniformIndex < uniforms.size(); ++uniformIndex)
+    {
+        const LinkedUniform &uniform = uniforms[uniformIndex];
+        Entry &entry                 = mEntries[uniformIndex];
+
+        // Uniforms in blocks are backed by buffers and have no values of their own.
+        ASSERT(uniform.type != GL_STRUCT_ANGLEX);
+        entry.offset      = offset;
+        entry.elementSize = uniform.isInDefaultBlock() ? uniform.getElementSize() : 0;
+        entry.dirtyRange  = {0, 0};
+
+        offset += entry.elementSize * uniform.elementCount();
+    }
+
+    mSize = offset;
+    if (mSize == 0)
+    {
+        mBuffer.resize(0);
+        mData = nullptr;
+        return true;
+    }
+
+    // Over-allocate so the start of the values can be aligned to a cache line.
+    if (!mBuffer.resize(mSize + kAlignment - 1))
+    {
+        mEntries.clear();
+        mData = nullptr;
+        mSize = 0;
+        return false;
+    }
+
+    uintptr_t address = reinterpret_cast<uintptr_t>(mBuffer.data());
+    mData             = mBuffer.data() + (rx::roundUp<uintptr_t>(address, kAlignment) - address);
+    memset(mData, 0, mSize);
+    return true;
 }
 
-size_t LinkedUniform::getElementSize() const
+uint8_t *UniformStorage::getElementData(size_t uniformIndex, unsigned int element)
 {
-    return VariableExternalSize(type);
+    ASSERT(uniformIndex < mEntries.size());
+    const Entry &entry = mEntries[uniformIndex];
+    return mData + entry.offset + entry.elementSize * element;
 }
 
-size_t LinkedUniform::getElementComponents() const
+const uint8_t *UniformStorage::getElementData(size_t uniformIndex, unsigned int element) const
 {
-    return VariableComponentCount(type);
+    return const_cast<UniformStorage *>(this)->getElementData(uniformIndex, element);
+}
+
+void UniformStorage::markDirty(size_t uniformIndex, unsigned int element, unsigned int elementCount)
+{
+    ASSERT(uniformIndex < mEntries.size() && elementCount > 0);
+    UniformElementRange &range = mEntries[uniformIndex].dirtyRange;
+
+    if (range.empty())
+    {
+        mDirtyUniforms.push_back(uniformIndex);
+        range.begin = element;
+        range.end   = element + elementCount;
+    }
+    else
+    {
+        range.begin = std::min(range.begin, element);
+        range.end   = std::max(range.end, element + elementCount);
+    }
 }
 
-uint8_t *LinkedUniform::getDataPtrToElement(size_t elementIndex)
+void UniformStorage::clearDirty()
 {
-    ASSERT((!isArray() && elementIndex == 0) || (isArray() && elementIndex < arraySize));
-    return data() + (elementIndex > 0 ? (getElementSize() * elementIndex) : 0u);
+    for (size_t uniformIndex : mDirtyUniforms)
+    {
+        mEntries[uniformIndex].dirtyRange = {0, 0};
+    }
+    mDirtyUniforms.clear();
 }
 
-const uint8_t *LinkedUniform::getDataPtrToElement(size_t elementIndex) const
+const UniformElementRange &UniformStorage::getDirtyRange(size_t uniformIndex) const
 {
-    return const_cast<LinkedUniform *>(this)->getDataPtrToElement(elementIndex);
+    ASSERT(uniformIndex < mEntries.size());
+    return mEntries[uniformIndex].dirtyRange;
 }
 
 UniformBlock::UniformBlock()
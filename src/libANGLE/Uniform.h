@@ -36,23 +36,66 @@ struct LinkedUniform : public sh::Uniform
     LinkedUniform &operator=(const LinkedUniform &uniform);
     ~LinkedUniform();
 
-    size_t dataSize() const;
-    uint8_t *data();
-    const uint8_t *data() const;
     bool isSampler() const;
     bool isImage() const;
     bool isInDefaultBlock() const;
     bool isField() const;
     size_t getElementSize() const;
     size_t getElementComponents() const;
-    uint8_t *getDataPtrToElement(size_t elementIndex);
-    const uint8_t *getDataPtrToElement(size_t elementIndex) const;
 
     int blockIndex;
     sh::BlockMemberInfo blockInfo;
+};
+
+// Range of array elements of a uniform, [begin, end).
+struct UniformElementRange
+{
+    bool empty() const { return begin >= end; }
+
+    unsigned int begin;
+    unsigned int end;
+};
+
+// Holds the values of all the default block uniforms of a program in a single cache-line aligned
+// block. Values are stored in their GL type, with booleans as GLint. Every write records the
+// modified elements so the implementation only has to upload those when it syncs.
+class UniformStorage final : angle::NonCopyable
+{
+  public:
+    UniformStorage();
+    ~UniformStorage();
+
+    // Lays out zero-initialized storage for the uniforms, nothing is dirty afterwards. Returns false
+    // if the storage can't be allocated.
+    bool init(const std::vector<LinkedUniform> &uniforms);
+
+    uint8_t *getElementData(size_t uniformIndex, unsigned int element);
+    const uint8_t *getElementData(size_t uniformIndex, unsigned int element) const;
+
+    void markDirty(size_t uniformIndex, unsigned int element, unsigned int elementCount);
+    void clearDirty();
+    bool hasDirtyUniforms() const { return !mDirtyUniforms.empty(); }
+    const std::vector<size_t> &getDirtyUniforms() const { return mDirtyUniforms; }
+    const UniformElementRange &getDirtyRange(size_t uniformIndex) const;
+
+    size_t size() const { return mSize; }
 
   private:
-    mutable angle::MemoryBuffer mLazyData;
+    static constexpr size_t kAlignment = 64;
+
+    struct Entry
+    {
+        size_t offset;
+        size_t elementSize;
+        UniformElementRange dirtyRange;
+    };
+
+    angle::MemoryBuffer mBuffer;
+    uint8_t *mData;
+    size_t mSize;
+
+    std::vector<Entry> mEntries;
+    std::vector<size_t> mDirtyUniforms;
 };
 
 // Helper struct representing a single shader uniform block
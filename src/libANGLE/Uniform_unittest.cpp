@@ -0,0 +1,103 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for the uniform value storage of programs.
+//
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/Uniform.h"
+
+using namespace gl;
+
+namespace
+{
+
+std::vector<LinkedUniform> MakeUniforms()
+{
+    std::vector<LinkedUniform> uniforms;
+    uniforms.emplace_back(GL_FLOAT_VEC4, GL_HIGH_FLOAT, "a", 0, -1, -1, -1,
+                          sh::BlockMemberInfo::getDefaultBlockInfo());
+    uniforms.emplace_back(GL_FLOAT, GL_HIGH_FLOAT, "b", 8, -1, -1, -1,
+                          sh::BlockMemberInfo::getDefaultBlockInfo());
+    uniforms.emplace_back(GL_FLOAT_VEC4, GL_HIGH_FLOAT, "blockMember", 0, -1, -1, 0,
+                          sh::BlockMemberInfo::getDefaultBlockInfo());
+    uniforms.emplace_back(GL_INT, GL_HIGH_INT, "c", 0, -1, -1, -1,
+                          sh::BlockMemberInfo::getDefaultBlockInfo());
+    return uniforms;
+}
+
+// Test that the values are laid out contiguously in zero-initialized, aligned storage.
+TEST(UniformStorageTest, Layout)
+{
+    UniformStorage storage;
+    ASSERT_TRUE(storage.init(MakeUniforms()));
+
+    // Uniforms in blocks take no space.
+    EXPECT_EQ(16u + 8u * 4u + 4u, storage.size());
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(storage.getElementData(0, 0)) % 64u);
+    EXPECT_EQ(storage.getElementData(0, 0) + 16, storage.getElementData(1, 0));
+    EXPECT_EQ(storage.getElementData(1, 0) + 12, storage.getElementData(1, 3));
+    EXPECT_EQ(storage.getElementData(1, 0) + 32, storage.getElementData(3, 0));
+
+    for (size_t offset = 0; offset < storage.size(); ++offset)
+    {
+        EXPECT_EQ(0u, storage.getElementData(0, 0)[offset]);
+    }
+    EXPECT_FALSE(storage.hasDirtyUniforms());
+}
+
+// Test that dirty ranges grow to cover every written element until they are cleared.
+TEST(UniformStorageTest, DirtyRanges)
+{
+    UniformStorage storage;
+    ASSERT_TRUE(storage.init(MakeUniforms()));
+
+    storage.markDirty(1, 5, 2);
+    storage.markDirty(3, 0, 1);
+    storage.markDirty(1, 2, 1);
+
+    ASSERT_TRUE(storage.hasDirtyUniforms());
+    ASSERT_EQ(2u, storage.getDirtyUniforms().size());
+    EXPECT_EQ(1u, storage.getDirtyUniforms()[0]);
+    EXPECT_EQ(3u, storage.getDirtyUniforms()[1]);
+
+    EXPECT_EQ(2u, storage.getDirtyRange(1).begin);
+    EXPECT_EQ(7u, storage.getDirtyRange(1).end);
+    EXPECT_EQ(0u, storage.getDirtyRange(3).begin);
+    EXPECT_EQ(1u, storage.getDirtyRange(3).end);
+    EXPECT_TRUE(storage.getDirtyRange(0).empty());
+
+    storage.clearDirty();
+    EXPECT_FALSE(storage.hasDirtyUniforms());
+    EXPECT_TRUE(storage.getDirtyRange(1).empty());
+
+    storage.markDirty(1, 7, 1);
+    EXPECT_EQ(7u, storage.getDirtyRange(1).begin);
+    EXPECT_EQ(8u, storage.getDirtyRange(1).end);
+}
+
+// Test that re-initializing clears the values and the dirty state.
+TEST(UniformStorageTest, Reinitialize)
+{
+    UniformStorage storage;
+    ASSERT_TRUE(storage.init(MakeUniforms()));
+
+    GLint value = 42;
+    memcpy(storage.getElementData(3, 0), &value, sizeof(value));
+    storage.markDirty(3, 0, 1);
+
+    ASSERT_TRUE(storage.init(MakeUniforms()));
+    EXPECT_FALSE(storage.hasDirtyUniforms());
+    memcpy(&value, storage.getElementData(3, 0), sizeof(value));
+    EXPECT_EQ(0, value);
+
+    ASSERT_TRUE(storage.init(std::vector<LinkedUniform>()));
+    EXPECT_EQ(0u, storage.size());
+}
+
+}  // anonymous namespace
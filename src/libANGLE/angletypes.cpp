@@ -39,6 +39,70 @@ PrimitiveType GetPrimitiveType(GLenum drawMode)
     }
 }
 
+TextureType GetTextureType(GLenum target)
+{
+    switch (target)
+    {
+        case GL_TEXTURE_2D:
+            return TEXTURE_TYPE_2D;
+        case GL_TEXTURE_CUBE_MAP:
+            return TEXTURE_TYPE_CUBE_MAP;
+        case GL_TEXTURE_2D_ARRAY:
+            return TEXTURE_TYPE_2D_ARRAY;
+        case GL_TEXTURE_3D:
+            return TEXTURE_TYPE_3D;
+        case GL_TEXTURE_2D_MULTISAMPLE:
+            return TEXTURE_TYPE_2D_MULTISAMPLE;
+        case GL_TEXTURE_EXTERNAL_OES:
+            return TEXTURE_TYPE_EXTERNAL;
+        default:
+            UNREACHABLE();
+            return TEXTURE_TYPE_MAX;
+    }
+}
+
+GLenum GetTextureTarget(TextureType type)
+{
+    switch (type)
+    {
+        case TEXTURE_TYPE_2D:
+            return GL_TEXTURE_2D;
+        case TEXTURE_TYPE_CUBE_MAP:
+            return GL_TEXTURE_CUBE_MAP;
+        case TEXTURE_TYPE_2D_ARRAY:
+            return GL_TEXTURE_2D_ARRAY;
+        case TEXTURE_TYPE_3D:
+            return GL_TEXTURE_3D;
+        case TEXTURE_TYPE_2D_MULTISAMPLE:
+            return GL_TEXTURE_2D_MULTISAMPLE;
+        case TEXTURE_TYPE_EXTERNAL:
+            return GL_TEXTURE_EXTERNAL_OES;
+        default:
+            UNREACHABLE();
+            return GL_NONE;
+    }
+}
+
+QueryType GetQueryType(GLenum target)
+{
+    switch (target)
+    {
+        case GL_ANY_SAMPLES_PASSED:
+            return QUERY_TYPE_ANY_SAMPLES;
+        case GL_ANY_SAMPLES_PASSED_CONSERVATIVE:
+            return QUERY_TYPE_ANY_SAMPLES_CONSERVATIVE;
+        case GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN:
+            return QUERY_TYPE_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN;
+        case GL_TIME_ELAPSED_EXT:
+            return QUERY_TYPE_TIME_ELAPSED;
+        case GL_COMMANDS_COMPLETED_CHROMIUM:
+            return QUERY_TYPE_COMMANDS_COMPLETED;
+        default:
+            UNREACHABLE();
+            return QUERY_TYPE_MAX;
+    }
+}
+
 SamplerState::SamplerState()
     : minFilter(GL_NEAREST_MIPMAP_LINEAR),
       magFilter(GL_LINEAR),
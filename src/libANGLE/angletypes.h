@@ -35,6 +35,38 @@ enum PrimitiveType
 
 PrimitiveType GetPrimitiveType(GLenum drawMode);
 
+// Texture targets that can be bound to a texture unit, packed for array indexing.
+enum TextureType
+{
+    TEXTURE_TYPE_2D,
+    TEXTURE_TYPE_CUBE_MAP,
+    TEXTURE_TYPE_2D_ARRAY,
+    TEXTURE_TYPE_3D,
+    TEXTURE_TYPE_2D_MULTISAMPLE,
+    TEXTURE_TYPE_EXTERNAL,
+    TEXTURE_TYPE_MAX,
+};
+
+// The target must have passed validation. Other enums are unreachable and map to TEXTURE_TYPE_MAX,
+// which is not a valid index.
+TextureType GetTextureType(GLenum target);
+GLenum GetTextureTarget(TextureType type);
+
+// Query targets that can have an active query, packed for array indexing.
+enum QueryType
+{
+    QUERY_TYPE_ANY_SAMPLES,
+    QUERY_TYPE_ANY_SAMPLES_CONSERVATIVE,
+    QUERY_TYPE_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN,
+    QUERY_TYPE_TIME_ELAPSED,
+    QUERY_TYPE_COMMANDS_COMPLETED,
+    QUERY_TYPE_MAX,
+};
+
+// The target must have passed ValidQueryType. Other enums are unreachable and map to
+// QUERY_TYPE_MAX, which is not a valid index.
+QueryType GetQueryType(GLenum target);
+
 enum SamplerType
 {
     SAMPLER_PIXEL,
@@ -258,10 +290,8 @@ typedef std::bitset<MAX_VERTEX_ATTRIBS> AttributesMask;
 // Use in Program
 typedef std::bitset<IMPLEMENTATION_MAX_COMBINED_SHADER_UNIFORM_BUFFERS> UniformBlockBindingMask;
 
-// A map of GL objects indexed by object ID. The specific map implementation may change.
-// Client code should treat it as a std::map.
-template <class ResourceT>
-using ResourceMap = std::unordered_map<GLuint, ResourceT *>;
+// Used in State, one bit per texture unit.
+typedef std::bitset<IMPLEMENTATION_MAX_ACTIVE_TEXTURES> ActiveTextureMask;
 
 using ContextID = uintptr_t;
 }
@@ -573,6 +573,9 @@ void QueryProgramiv(const Program *program, GLenum pname, GLint *params)
         case GL_LINK_STATUS:
             *params = program->isLinked();
             return;
+        case GL_COMPLETION_STATUS_KHR:
+            *params = program->isLinking() ? GL_FALSE : GL_TRUE;
+            return;
         case GL_VALIDATE_STATUS:
             *params = program->isValidated();
             return;
@@ -690,6 +693,9 @@ void QueryShaderiv(const Shader *shader, GLenum pname, GLint *params)
         case GL_DELETE_STATUS:
             *params = shader->isFlaggedForDeletion();
             return;
+        case GL_COMPLETION_STATUS_KHR:
+            *params = shader->isCompiling() ? GL_FALSE : GL_TRUE;
+            return;
         case GL_COMPILE_STATUS:
             *params = shader->isCompiled() ? GL_TRUE : GL_FALSE;
             return;
@@ -1028,10 +1034,16 @@ GLuint QueryProgramResourceIndex(const Program *program,
         case GL_PROGRAM_OUTPUT:
             return program->getOutputResourceIndex(name);
 
-        // TODO(Jie): more interfaces.
         case GL_UNIFORM:
+            return program->getUniformIndex(name);
+
         case GL_UNIFORM_BLOCK:
+            return program->getUniformBlockIndex(name);
+
         case GL_TRANSFORM_FEEDBACK_VARYING:
+            return program->getTransformFeedbackVaryingResourceIndex(name);
+
+        // TODO(Jie): more interfaces.
         case GL_BUFFER_VARIABLE:
         case GL_SHADER_STORAGE_BLOCK:
             UNIMPLEMENTED();
@@ -0,0 +1,33 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BufferImpl.cpp: Defines the abstract rx::BufferImpl class.
+
+#include "libANGLE/renderer/BufferImpl.h"
+
+#include "libANGLE/formatutils.h"
+
+namespace rx
+{
+
+gl::Error BufferImpl::getIndexRanges(GLenum type,
+                                     const std::vector<gl::Range<size_t>> &indexSpans,
+                                     bool primitiveRestartEnabled,
+                                     std::vector<gl::IndexRange> *outRanges)
+{
+    const size_t typeBytes = gl::GetTypeInfo(type).bytes;
+
+    outRanges->resize(indexSpans.size());
+    for (size_t spanIndex = 0; spanIndex < indexSpans.size(); spanIndex++)
+    {
+        const gl::Range<size_t> &span = indexSpans[spanIndex];
+        ANGLE_TRY(getIndexRange(type, span.start * typeBytes, span.length(),
+                                primitiveRestartEnabled, &(*outRanges)[spanIndex]));
+    }
+    return gl::NoError();
+}
+
+}  // namespace rx
@@ -14,6 +14,7 @@
 #include "libANGLE/Error.h"
 
 #include <stdint.h>
+#include <vector>
 
 namespace gl
 {
@@ -60,6 +61,14 @@ class BufferImpl : angle::NonCopyable
                                     bool primitiveRestartEnabled,
                                     gl::IndexRange *outRange) = 0;
 
+    // Computes the index range of each of |indexSpans|, which are given in indices, are sorted and
+    // don't overlap. The default calls getIndexRange for every span, backends for which reading
+    // the data is expensive override it to read all of the spans at once.
+    virtual gl::Error getIndexRanges(GLenum type,
+                                     const std::vector<gl::Range<size_t>> &indexSpans,
+                                     bool primitiveRestartEnabled,
+                                     std::vector<gl::IndexRange> *outRanges);
+
   protected:
     const gl::BufferState &mState;
 };
@@ -32,6 +32,11 @@ class MockBufferImpl : public BufferImpl
     MOCK_METHOD2(unmap, gl::Error(ContextImpl *contextImpl, GLboolean *result));
 
     MOCK_METHOD5(getIndexRange, gl::Error(GLenum, size_t, size_t, bool, gl::IndexRange *));
+    MOCK_METHOD4(getIndexRanges,
+                 gl::Error(GLenum,
+                           const std::vector<gl::Range<size_t>> &,
+                           bool,
+                           std::vector<gl::IndexRange> *));
 
     MOCK_METHOD0(destructor, void());
 
@@ -52,27 +52,9 @@ class ProgramImpl : angle::NonCopyable
                             gl::InfoLog &infoLog) = 0;
     virtual GLboolean validate(const gl::Caps &caps, gl::InfoLog *infoLog) = 0;
 
-    virtual void setUniform1fv(GLint location, GLsizei count, const GLfloat *v) = 0;
-    virtual void setUniform2fv(GLint location, GLsizei count, const GLfloat *v) = 0;
-    virtual void setUniform3fv(GLint location, GLsizei count, const GLfloat *v) = 0;
-    virtual void setUniform4fv(GLint location, GLsizei count, const GLfloat *v) = 0;
-    virtual void setUniform1iv(GLint location, GLsizei count, const GLint *v) = 0;
-    virtual void setUniform2iv(GLint location, GLsizei count, const GLint *v) = 0;
-    virtual void setUniform3iv(GLint location, GLsizei count, const GLint *v) = 0;
-    virtual void setUniform4iv(GLint location, GLsizei count, const GLint *v) = 0;
-    virtual void setUniform1uiv(GLint location, GLsizei count, const GLuint *v) = 0;
-    virtual void setUniform2uiv(GLint location, GLsizei count, const GLuint *v) = 0;
-    virtual void setUniform3uiv(GLint location, GLsizei count, const GLuint *v) = 0;
-    virtual void setUniform4uiv(GLint location, GLsizei count, const GLuint *v) = 0;
-    virtual void setUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = 0;
-    virtual void setUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = 0;
-    virtual void setUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = 0;
-    virtual void setUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = 0;
-    virtual void setUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = 0;
-    virtual void setUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = 0;
-    virtual void setUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = 0;
-    virtual void setUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = 0;
-    virtual void setUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) = 0;
+    // Called before drawing when uniform values were written since the last sync. The written
+    // elements are listed in the uniform storage of the program state.
+    virtual void syncState(ContextImpl *contextImpl) {}
 
     // TODO: synchronize in syncState when dirty bits exist.
     virtual void setUniformBlockBinding(GLuint uniformBlockIndex, GLuint uniformBlockBinding) = 0;
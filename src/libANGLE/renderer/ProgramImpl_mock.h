@@ -31,29 +31,6 @@ class MockProgramImpl : public rx::ProgramImpl
     MOCK_METHOD3(link, LinkResult(ContextImpl *, const gl::VaryingPacking &, gl::InfoLog &));
     MOCK_METHOD2(validate, GLboolean(const gl::Caps &, gl::InfoLog *));
 
-    MOCK_METHOD3(setUniform1fv, void(GLint, GLsizei, const GLfloat *));
-    MOCK_METHOD3(setUniform2fv, void(GLint, GLsizei, const GLfloat *));
-    MOCK_METHOD3(setUniform3fv, void(GLint, GLsizei, const GLfloat *));
-    MOCK_METHOD3(setUniform4fv, void(GLint, GLsizei, const GLfloat *));
-    MOCK_METHOD3(setUniform1iv, void(GLint, GLsizei, const GLint *));
-    MOCK_METHOD3(setUniform2iv, void(GLint, GLsizei, const GLint *));
-    MOCK_METHOD3(setUniform3iv, void(GLint, GLsizei, const GLint *));
-    MOCK_METHOD3(setUniform4iv, void(GLint, GLsizei, const GLint *));
-    MOCK_METHOD3(setUniform1uiv, void(GLint, GLsizei, const GLuint *));
-    MOCK_METHOD3(setUniform2uiv, void(GLint, GLsizei, const GLuint *));
-    MOCK_METHOD3(setUniform3uiv, void(GLint, GLsizei, const GLuint *));
-    MOCK_METHOD3(setUniform4uiv, void(GLint, GLsizei, const GLuint *));
-
-    MOCK_METHOD4(setUniformMatrix2fv, void(GLint, GLsizei, GLboolean, const GLfloat *));
-    MOCK_METHOD4(setUniformMatrix3fv, void(GLint, GLsizei, GLboolean, const GLfloat *));
-    MOCK_METHOD4(setUniformMatrix4fv, void(GLint, GLsizei, GLboolean, const GLfloat *));
-    MOCK_METHOD4(setUniformMatrix2x3fv, void(GLint, GLsizei, GLboolean, const GLfloat *));
-    MOCK_METHOD4(setUniformMatrix3x2fv, void(GLint, GLsizei, GLboolean, const GLfloat *));
-    MOCK_METHOD4(setUniformMatrix2x4fv, void(GLint, GLsizei, GLboolean, const GLfloat *));
-    MOCK_METHOD4(setUniformMatrix4x2fv, void(GLint, GLsizei, GLboolean, const GLfloat *));
-    MOCK_METHOD4(setUniformMatrix3x4fv, void(GLint, GLsizei, GLboolean, const GLfloat *));
-    MOCK_METHOD4(setUniformMatrix4x3fv, void(GLint, GLsizei, GLboolean, const GLfloat *));
-
     MOCK_METHOD2(setUniformBlockBinding, void(GLuint, GLuint));
     MOCK_CONST_METHOD2(getUniformBlockSize, bool(const std::string &, size_t *));
     MOCK_CONST_METHOD2(getUniformBlockMemberInfo, bool(const std::string &, sh::BlockMemberInfo *));
@@ -1400,7 +1400,10 @@ LinkResult ProgramD3D::compileProgramExecutables(const gl::ContextState &context
                                                 workerPool->postWorkerTask(&pixelTask),
                                                 workerPool->postWorkerTask(&geometryTask)}};
 
-    WaitableEvent::WaitMany(&waitEvents);
+    for (WaitableEvent &waitEvent : waitEvents)
+    {
+        waitEvent.wait();
+    }
 
     infoLog << vertexTask.getInfoLog().str();
     infoLog << pixelTask.getInfoLog().str();
@@ -1762,136 +1765,83 @@ void ProgramD3D::dirtyAllUniforms()
     }
 }
 
-void ProgramD3D::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
-{
-    setUniform(location, count, v, GL_FLOAT);
-}
-
-void ProgramD3D::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
-{
-    setUniform(location, count, v, GL_FLOAT_VEC2);
-}
-
-void ProgramD3D::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
-{
-    setUniform(location, count, v, GL_FLOAT_VEC3);
-}
-
-void ProgramD3D::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
-{
-    setUniform(location, count, v, GL_FLOAT_VEC4);
-}
-
-void ProgramD3D::setUniformMatrix2fv(GLint location,
-                                     GLsizei count,
-                                     GLboolean transpose,
-                                     const GLfloat *value)
-{
-    setUniformMatrixfv<2, 2>(location, count, transpose, value, GL_FLOAT_MAT2);
-}
-
-void ProgramD3D::setUniformMatrix3fv(GLint location,
-                                     GLsizei count,
-                                     GLboolean transpose,
-                                     const GLfloat *value)
+void ProgramD3D::syncState(ContextImpl *contextImpl)
 {
-    setUniformMatrixfv<3, 3>(location, count, transpose, value, GL_FLOAT_MAT3);
-}
-
-void ProgramD3D::setUniformMatrix4fv(GLint location,
-                                     GLsizei count,
-                                     GLboolean transpose,
-                                     const GLfloat *value)
-{
-    setUniformMatrixfv<4, 4>(location, count, transpose, value, GL_FLOAT_MAT4);
-}
-
-void ProgramD3D::setUniformMatrix2x3fv(GLint location,
-                                       GLsizei count,
-                                       GLboolean transpose,
-                                       const GLfloat *value)
-{
-    setUniformMatrixfv<2, 3>(location, count, transpose, value, GL_FLOAT_MAT2x3);
-}
-
-void ProgramD3D::setUniformMatrix3x2fv(GLint location,
-                                       GLsizei count,
-                                       GLboolean transpose,
-                                       const GLfloat *value)
-{
-    setUniformMatrixfv<3, 2>(location, count, transpose, value, GL_FLOAT_MAT3x2);
-}
-
-void ProgramD3D::setUniformMatrix2x4fv(GLint location,
-                                       GLsizei count,
-                                       GLboolean transpose,
-                                       const GLfloat *value)
-{
-    setUniformMatrixfv<2, 4>(location, count, transpose, value, GL_FLOAT_MAT2x4);
-}
-
-void ProgramD3D::setUniformMatrix4x2fv(GLint location,
-                                       GLsizei count,
-                                       GLboolean transpose,
-                                       const GLfloat *value)
-{
-    setUniformMatrixfv<4, 2>(location, count, transpose, value, GL_FLOAT_MAT4x2);
-}
+    const gl::UniformStorage &uniformStorage       = mState.getUniformStorage();
+    const std::vector<gl::LinkedUniform> &uniforms = mState.getUniforms();
 
-void ProgramD3D::setUniformMatrix3x4fv(GLint location,
-                                       GLsizei count,
-                                       GLboolean transpose,
-                                       const GLfloat *value)
-{
-    setUniformMatrixfv<3, 4>(location, count, transpose, value, GL_FLOAT_MAT3x4);
-}
-
-void ProgramD3D::setUniformMatrix4x3fv(GLint location,
-                                       GLsizei count,
-                                       GLboolean transpose,
-                                       const GLfloat *value)
-{
-    setUniformMatrixfv<4, 3>(location, count, transpose, value, GL_FLOAT_MAT4x3);
-}
-
-void ProgramD3D::setUniform1iv(GLint location, GLsizei count, const GLint *v)
-{
-    setUniform(location, count, v, GL_INT);
-}
-
-void ProgramD3D::setUniform2iv(GLint location, GLsizei count, const GLint *v)
-{
-    setUniform(location, count, v, GL_INT_VEC2);
-}
-
-void ProgramD3D::setUniform3iv(GLint location, GLsizei count, const GLint *v)
-{
-    setUniform(location, count, v, GL_INT_VEC3);
-}
-
-void ProgramD3D::setUniform4iv(GLint location, GLsizei count, const GLint *v)
-{
-    setUniform(location, count, v, GL_INT_VEC4);
-}
+    for (size_t uniformIndex : uniformStorage.getDirtyUniforms())
+    {
+        const gl::LinkedUniform &uniform     = uniforms[uniformIndex];
+        const gl::UniformElementRange &range = uniformStorage.getDirtyRange(uniformIndex);
 
-void ProgramD3D::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
-{
-    setUniform(location, count, v, GL_UNSIGNED_INT);
-}
+        GLint location =
+            mState.getUniformElementLocation(static_cast<GLuint>(uniformIndex), range.begin);
+        ASSERT(location != -1);
+        GLsizei count       = static_cast<GLsizei>(range.end - range.begin);
+        const uint8_t *data = uniformStorage.getElementData(uniformIndex, range.begin);
 
-void ProgramD3D::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
-{
-    setUniform(location, count, v, GL_UNSIGNED_INT_VEC2);
-}
+        const GLfloat *floatData = reinterpret_cast<const GLfloat *>(data);
 
-void ProgramD3D::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
-{
-    setUniform(location, count, v, GL_UNSIGNED_INT_VEC3);
-}
+        // Convert the front-end values to the register layout. Matrices are stored column-major
+        // and booleans as integers by the front-end.
+        switch (uniform.type)
+        {
+            case GL_FLOAT_MAT2:
+                setUniformMatrixfv<2, 2>(location, count, GL_FALSE, floatData, uniform.type);
+                break;
+            case GL_FLOAT_MAT3:
+                setUniformMatrixfv<3, 3>(location, count, GL_FALSE, floatData, uniform.type);
+                break;
+            case GL_FLOAT_MAT4:
+                setUniformMatrixfv<4, 4>(location, count, GL_FALSE, floatData, uniform.type);
+                break;
+            case GL_FLOAT_MAT2x3:
+                setUniformMatrixfv<2, 3>(location, count, GL_FALSE, floatData, uniform.type);
+                break;
+            case GL_FLOAT_MAT3x2:
+                setUniformMatrixfv<3, 2>(location, count, GL_FALSE, floatData, uniform.type);
+                break;
+            case GL_FLOAT_MAT2x4:
+                setUniformMatrixfv<2, 4>(location, count, GL_FALSE, floatData, uniform.type);
+                break;
+            case GL_FLOAT_MAT4x2:
+                setUniformMatrixfv<4, 2>(location, count, GL_FALSE, floatData, uniform.type);
+                break;
+            case GL_FLOAT_MAT3x4:
+                setUniformMatrixfv<3, 4>(location, count, GL_FALSE, floatData, uniform.type);
+                break;
+            case GL_FLOAT_MAT4x3:
+                setUniformMatrixfv<4, 3>(location, count, GL_FALSE, floatData, uniform.type);
+                break;
+            default:
+                if (uniform.isSampler())
+                {
+                    setUniform(location, count, reinterpret_cast<const GLint *>(data), GL_INT);
+                    break;
+                }
 
-void ProgramD3D::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
-{
-    setUniform(location, count, v, GL_UNSIGNED_INT_VEC4);
+                switch (gl::VariableComponentType(uniform.type))
+                {
+                    case GL_FLOAT:
+                        setUniform(location, count, floatData, uniform.type);
+                        break;
+                    case GL_INT:
+                    case GL_BOOL:
+                        setUniform(location, count, reinterpret_cast<const GLint *>(data),
+                                   uniform.type);
+                        break;
+                    case GL_UNSIGNED_INT:
+                        setUniform(location, count, reinterpret_cast<const GLuint *>(data),
+                                   uniform.type);
+                        break;
+                    default:
+                        UNREACHABLE();
+                        break;
+                }
+                break;
+        }
+    }
 }
 
 void ProgramD3D::setUniformBlockBinding(GLuint /*uniformBlockIndex*/,
@@ -51,8 +51,8 @@ struct D3DUniform : angle::NonCopyable
     std::string name;
     unsigned int arraySize;
 
-    // Pointer to a system copy of the data.
-    // TODO(jmadill): remove this in favor of gl::LinkedUniform::data().
+    // The values in register layout, converted from the front-end uniform storage on sync. Kept
+    // since the constant buffers are rewritten entirely whenever a uniform changes.
     uint8_t *data;
 
     // Has the data been updated since the last sync?
@@ -186,6 +186,8 @@ class ProgramD3D : public ProgramImpl
                     gl::InfoLog &infoLog) override;
     GLboolean validate(const gl::Caps &caps, gl::InfoLog *infoLog) override;
 
+    void syncState(ContextImpl *contextImpl) override;
+
     bool getUniformBlockSize(const std::string &blockName, size_t *sizeOut) const override;
     bool getUniformBlockMemberInfo(const std::string &memberUniformName,
                                    sh::BlockMemberInfo *memberInfoOut) const override;
@@ -199,55 +201,6 @@ class ProgramD3D : public ProgramImpl
     gl::Error applyUniformBuffers(const gl::ContextState &data);
     void dirtyAllUniforms();
 
-    void setUniform1fv(GLint location, GLsizei count, const GLfloat *v);
-    void setUniform2fv(GLint location, GLsizei count, const GLfloat *v);
-    void setUniform3fv(GLint location, GLsizei count, const GLfloat *v);
-    void setUniform4fv(GLint location, GLsizei count, const GLfloat *v);
-    void setUniform1iv(GLint location, GLsizei count, const GLint *v);
-    void setUniform2iv(GLint location, GLsizei count, const GLint *v);
-    void setUniform3iv(GLint location, GLsizei count, const GLint *v);
-    void setUniform4iv(GLint location, GLsizei count, const GLint *v);
-    void setUniform1uiv(GLint location, GLsizei count, const GLuint *v);
-    void setUniform2uiv(GLint location, GLsizei count, const GLuint *v);
-    void setUniform3uiv(GLint location, GLsizei count, const GLuint *v);
-    void setUniform4uiv(GLint location, GLsizei count, const GLuint *v);
-    void setUniformMatrix2fv(GLint location,
-                             GLsizei count,
-                             GLboolean transpose,
-                             const GLfloat *value);
-    void setUniformMatrix3fv(GLint location,
-                             GLsizei count,
-                             GLboolean transpose,
-                             const GLfloat *value);
-    void setUniformMatrix4fv(GLint location,
-                             GLsizei count,
-                             GLboolean transpose,
-                             const GLfloat *value);
-    void setUniformMatrix2x3fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value);
-    void setUniformMatrix3x2fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value);
-    void setUniformMatrix2x4fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value);
-    void setUniformMatrix4x2fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value);
-    void setUniformMatrix3x4fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value);
-    void setUniformMatrix4x3fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value);
-
     void setUniformBlockBinding(GLuint uniformBlockIndex, GLuint uniformBlockBinding) override;
 
     const UniformStorageD3D &getVertexUniformStorage() const
@@ -219,6 +219,49 @@ gl::Error BufferGL::getIndexRange(GLenum type,
     return gl::NoError();
 }
 
+gl::Error BufferGL::getIndexRanges(GLenum type,
+                                   const std::vector<gl::Range<size_t>> &indexSpans,
+                                   bool primitiveRestartEnabled,
+                                   std::vector<gl::IndexRange> *outRanges)
+{
+    ASSERT(!mIsMapped);
+    ASSERT(!indexSpans.empty());
+
+    const gl::Type &typeInfo = gl::GetTypeInfo(type);
+    outRanges->resize(indexSpans.size());
+
+    // Map everything between the first and the last span once instead of mapping every span.
+    const size_t firstIndex   = indexSpans.front().start;
+    const size_t indexCount   = indexSpans.back().end - firstIndex;
+    const uint8_t *bufferData = nullptr;
+    if (mShadowBufferData)
+    {
+        bufferData = mShadowCopy.data() + firstIndex * typeInfo.bytes;
+    }
+    else
+    {
+        mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+        bufferData = MapBufferRangeWithFallback(mFunctions, DestBufferOperationTarget,
+                                                firstIndex * typeInfo.bytes,
+                                                indexCount * typeInfo.bytes, GL_MAP_READ_BIT);
+    }
+
+    for (size_t spanIndex = 0; spanIndex < indexSpans.size(); spanIndex++)
+    {
+        const gl::Range<size_t> &span = indexSpans[spanIndex];
+        (*outRanges)[spanIndex] =
+            gl::ComputeIndexRange(type, bufferData + (span.start - firstIndex) * typeInfo.bytes,
+                                  span.length(), primitiveRestartEnabled);
+    }
+
+    if (!mShadowBufferData)
+    {
+        mFunctions->unmapBuffer(DestBufferOperationTarget);
+    }
+
+    return gl::NoError();
+}
+
 GLuint BufferGL::getBufferID() const
 {
     return mBufferID;
@@ -54,6 +54,10 @@ class BufferGL : public BufferImpl
                             size_t count,
                             bool primitiveRestartEnabled,
                             gl::IndexRange *outRange) override;
+    gl::Error getIndexRanges(GLenum type,
+                             const std::vector<gl::Range<size_t>> &indexSpans,
+                             bool primitiveRestartEnabled,
+                             std::vector<gl::IndexRange> *outRanges) override;
 
     GLuint getBufferID() const;
 
@@ -92,11 +92,11 @@ gl::Error ProgramGL::save(gl::BinaryOutputStream *stream)
     std::vector<uint8_t> binary(binaryLength);
     GLenum binaryFormat = GL_NONE;
     mFunctions->getProgramBinary(mProgramID, binaryLength, &binaryLength, &binaryFormat,
-                                 &binary[0]);
+                                 binary.data());
 
     stream->writeInt(binaryFormat);
     stream->writeInt(binaryLength);
-    stream->writeBytes(&binary[0], binaryLength);
+    stream->writeBytes(binary.data(), binaryLength);
 
     return gl::NoError();
 }
@@ -207,6 +207,105 @@ GLboolean ProgramGL::validate(const gl::Caps & /*caps*/, gl::InfoLog * /*infoLog
     return true;
 }
 
+void ProgramGL::syncState(ContextImpl *contextImpl)
+{
+    const gl::UniformStorage &uniformStorage       = mState.getUniformStorage();
+    const std::vector<gl::LinkedUniform> &uniforms = mState.getUniforms();
+
+    for (size_t uniformIndex : uniformStorage.getDirtyUniforms())
+    {
+        const gl::LinkedUniform &uniform     = uniforms[uniformIndex];
+        const gl::UniformElementRange &range = uniformStorage.getDirtyRange(uniformIndex);
+
+        // Uploading from the location of the first dirty element also covers the following ones.
+        GLint location =
+            mState.getUniformElementLocation(static_cast<GLuint>(uniformIndex), range.begin);
+        ASSERT(location != -1);
+        GLsizei count       = static_cast<GLsizei>(range.end - range.begin);
+        const uint8_t *data = uniformStorage.getElementData(uniformIndex, range.begin);
+
+        const GLfloat *floatData = reinterpret_cast<const GLfloat *>(data);
+        const GLint *intData     = reinterpret_cast<const GLint *>(data);
+        const GLuint *uintData   = reinterpret_cast<const GLuint *>(data);
+
+        // The front-end stores matrices column-major and booleans as integers.
+        switch (uniform.type)
+        {
+            case GL_FLOAT:
+                setUniform1fv(location, count, floatData);
+                break;
+            case GL_FLOAT_VEC2:
+                setUniform2fv(location, count, floatData);
+                break;
+            case GL_FLOAT_VEC3:
+                setUniform3fv(location, count, floatData);
+                break;
+            case GL_FLOAT_VEC4:
+                setUniform4fv(location, count, floatData);
+                break;
+            case GL_INT:
+            case GL_BOOL:
+                setUniform1iv(location, count, intData);
+                break;
+            case GL_INT_VEC2:
+            case GL_BOOL_VEC2:
+                setUniform2iv(location, count, intData);
+                break;
+            case GL_INT_VEC3:
+            case GL_BOOL_VEC3:
+                setUniform3iv(location, count, intData);
+                break;
+            case GL_INT_VEC4:
+            case GL_BOOL_VEC4:
+                setUniform4iv(location, count, intData);
+                break;
+            case GL_UNSIGNED_INT:
+                setUniform1uiv(location, count, uintData);
+                break;
+            case GL_UNSIGNED_INT_VEC2:
+                setUniform2uiv(location, count, uintData);
+                break;
+            case GL_UNSIGNED_INT_VEC3:
+                setUniform3uiv(location, count, uintData);
+                break;
+            case GL_UNSIGNED_INT_VEC4:
+                setUniform4uiv(location, count, uintData);
+                break;
+            case GL_FLOAT_MAT2:
+                setUniformMatrix2fv(location, count, GL_FALSE, floatData);
+                break;
+            case GL_FLOAT_MAT3:
+                setUniformMatrix3fv(location, count, GL_FALSE, floatData);
+                break;
+            case GL_FLOAT_MAT4:
+                setUniformMatrix4fv(location, count, GL_FALSE, floatData);
+                break;
+            case GL_FLOAT_MAT2x3:
+                setUniformMatrix2x3fv(location, count, GL_FALSE, floatData);
+                break;
+            case GL_FLOAT_MAT3x2:
+                setUniformMatrix3x2fv(location, count, GL_FALSE, floatData);
+                break;
+            case GL_FLOAT_MAT2x4:
+                setUniformMatrix2x4fv(location, count, GL_FALSE, floatData);
+                break;
+            case GL_FLOAT_MAT4x2:
+                setUniformMatrix4x2fv(location, count, GL_FALSE, floatData);
+                break;
+            case GL_FLOAT_MAT3x4:
+                setUniformMatrix3x4fv(location, count, GL_FALSE, floatData);
+                break;
+            case GL_FLOAT_MAT4x3:
+                setUniformMatrix4x3fv(location, count, GL_FALSE, floatData);
+                break;
+            default:
+                ASSERT(uniform.isSampler());
+                setUniform1iv(location, count, intData);
+                break;
+        }
+    }
+}
+
 void ProgramGL::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
 {
     if (mFunctions->programUniform1fv != nullptr)
@@ -525,7 +525,10 @@ void GenerateCaps(const FunctionsGL *functions,
 
     // Determine the max combined texture image units by adding the vertex and fragment limits.  If
     // the real cap is queried, it would contain the limits for shader types that are not available to ES.
-    caps->maxCombinedTextureImageUnits = caps->maxVertexTextureImageUnits + caps->maxTextureImageUnits;
+    // gl::State tracks texture units in a fixed size bitset, so the sum is clamped to that size.
+    caps->maxCombinedTextureImageUnits =
+        std::min(caps->maxVertexTextureImageUnits + caps->maxTextureImageUnits,
+                 static_cast<GLuint>(gl::IMPLEMENTATION_MAX_ACTIVE_TEXTURES));
 
     // Table 6.34, implementation dependent transform feedback limits
     if (functions->isAtLeastGL(gl::Version(4, 0)) ||
@@ -54,117 +54,6 @@ GLboolean ProgramNULL::validate(const gl::Caps &caps, gl::InfoLog *infoLog)
     return GL_TRUE;
 }
 
-void ProgramNULL::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
-{
-}
-
-void ProgramNULL::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
-{
-}
-
-void ProgramNULL::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
-{
-}
-
-void ProgramNULL::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
-{
-}
-
-void ProgramNULL::setUniform1iv(GLint location, GLsizei count, const GLint *v)
-{
-}
-
-void ProgramNULL::setUniform2iv(GLint location, GLsizei count, const GLint *v)
-{
-}
-
-void ProgramNULL::setUniform3iv(GLint location, GLsizei count, const GLint *v)
-{
-}
-
-void ProgramNULL::setUniform4iv(GLint location, GLsizei count, const GLint *v)
-{
-}
-
-void ProgramNULL::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
-{
-}
-
-void ProgramNULL::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
-{
-}
-
-void ProgramNULL::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
-{
-}
-
-void ProgramNULL::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
-{
-}
-
-void ProgramNULL::setUniformMatrix2fv(GLint location,
-                                      GLsizei count,
-                                      GLboolean transpose,
-                                      const GLfloat *value)
-{
-}
-
-void ProgramNULL::setUniformMatrix3fv(GLint location,
-                                      GLsizei count,
-                                      GLboolean transpose,
-                                      const GLfloat *value)
-{
-}
-
-void ProgramNULL::setUniformMatrix4fv(GLint location,
-                                      GLsizei count,
-                                      GLboolean transpose,
-                                      const GLfloat *value)
-{
-}
-
-void ProgramNULL::setUniformMatrix2x3fv(GLint location,
-                                        GLsizei count,
-                                        GLboolean transpose,
-                                        const GLfloat *value)
-{
-}
-
-void ProgramNULL::setUniformMatrix3x2fv(GLint location,
-                                        GLsizei count,
-                                        GLboolean transpose,
-                                        const GLfloat *value)
-{
-}
-
-void ProgramNULL::setUniformMatrix2x4fv(GLint location,
-                                        GLsizei count,
-                                        GLboolean transpose,
-                                        const GLfloat *value)
-{
-}
-
-void ProgramNULL::setUniformMatrix4x2fv(GLint location,
-                                        GLsizei count,
-                                        GLboolean transpose,
-                                        const GLfloat *value)
-{
-}
-
-void ProgramNULL::setUniformMatrix3x4fv(GLint location,
-                                        GLsizei count,
-                                        GLboolean transpose,
-                                        const GLfloat *value)
-{
-}
-
-void ProgramNULL::setUniformMatrix4x3fv(GLint location,
-                                        GLsizei count,
-                                        GLboolean transpose,
-                                        const GLfloat *value)
-{
-}
-
 void ProgramNULL::setUniformBlockBinding(GLuint uniformBlockIndex, GLuint uniformBlockBinding)
 {
 }
@@ -33,55 +33,6 @@ class ProgramNULL : public ProgramImpl
                     gl::InfoLog &infoLog) override;
     GLboolean validate(const gl::Caps &caps, gl::InfoLog *infoLog) override;
 
-    void setUniform1fv(GLint location, GLsizei count, const GLfloat *v) override;
-    void setUniform2fv(GLint location, GLsizei count, const GLfloat *v) override;
-    void setUniform3fv(GLint location, GLsizei count, const GLfloat *v) override;
-    void setUniform4fv(GLint location, GLsizei count, const GLfloat *v) override;
-    void setUniform1iv(GLint location, GLsizei count, const GLint *v) override;
-    void setUniform2iv(GLint location, GLsizei count, const GLint *v) override;
-    void setUniform3iv(GLint location, GLsizei count, const GLint *v) override;
-    void setUniform4iv(GLint location, GLsizei count, const GLint *v) override;
-    void setUniform1uiv(GLint location, GLsizei count, const GLuint *v) override;
-    void setUniform2uiv(GLint location, GLsizei count, const GLuint *v) override;
-    void setUniform3uiv(GLint location, GLsizei count, const GLuint *v) override;
-    void setUniform4uiv(GLint location, GLsizei count, const GLuint *v) override;
-    void setUniformMatrix2fv(GLint location,
-                             GLsizei count,
-                             GLboolean transpose,
-                             const GLfloat *value) override;
-    void setUniformMatrix3fv(GLint location,
-                             GLsizei count,
-                             GLboolean transpose,
-                             const GLfloat *value) override;
-    void setUniformMatrix4fv(GLint location,
-                             GLsizei count,
-                             GLboolean transpose,
-                             const GLfloat *value) override;
-    void setUniformMatrix2x3fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value) override;
-    void setUniformMatrix3x2fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value) override;
-    void setUniformMatrix2x4fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value) override;
-    void setUniformMatrix4x2fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value) override;
-    void setUniformMatrix3x4fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value) override;
-    void setUniformMatrix4x3fv(GLint location,
-                               GLsizei count,
-                               GLboolean transpose,
-                               const GLfloat *value) override;
-
     // TODO: synchronize in syncState when dirty bits exist.
     void setUniformBlockBinding(GLuint uniformBlockIndex, GLuint uniformBlockBinding) override;
 
@@ -120,138 +120,6 @@ GLboolean ProgramVk::validate(const gl::Caps &caps, gl::InfoLog *infoLog)
     return GLboolean();
 }
 
-void ProgramVk::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform1iv(GLint location, GLsizei count, const GLint *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform2iv(GLint location, GLsizei count, const GLint *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform3iv(GLint location, GLsizei count, const GLint *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform4iv(GLint location, GLsizei count, const GLint *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniformMatrix2fv(GLint location,
-                                    GLsizei count,
-                                    GLboolean transpose,
-                                    const GLfloat *value)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniformMatrix3fv(GLint location,
-                                    GLsizei count,
-                                    GLboolean transpose,
-                                    const GLfloat *value)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniformMatrix4fv(GLint location,
-                                    GLsizei count,
-                                    GLboolean transpose,
-                                    const GLfloat *value)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniformMatrix2x3fv(GLint location,
-                                      GLsizei count,
-                                      GLboolean transpose,
-                                      const GLfloat *value)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniformMatrix3x2fv(GLint location,
-                                      GLsizei count,
-                                      GLboolean transpose,
-                                      const GLfloat *value)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniformMatrix2x4fv(GLint location,
-                                      GLsizei count,
-                                      GLboolean transpose,
-                                      const GLfloat *value)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniformMatrix4x2fv(GLint location,
-                                      GLsizei count,
-                                      GLboolean transpose,
-                                      const GLfloat *value)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniformMatrix3x4fv(GLint location,
-                                      GLsizei count,
-                                      GLboolean transpose,
-                                      const GLfloat *value)
-{
-    UNIMPLEMENTED();
-}
-
-void ProgramVk::setUniformMatrix4x3fv(GLint location,
-                                      GLsizei count,
-                                      GLboolean transpose,
-                                      const GLfloat *value)
-{
-    UNIMPLEMENTED();
-}
-
 void ProgramVk::setUniformBlockBinding(GLuint uniformBlockIndex, GLuint uniformBlockBinding)
 {
     UNIMPLEMENTED();
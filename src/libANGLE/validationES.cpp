@@ -19,6 +19,7 @@
 #include "libANGLE/Image.h"
 #include "libANGLE/Query.h"
 #include "libANGLE/Program.h"
+#include "libANGLE/Shader.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/TransformFeedback.h"
 #include "libANGLE/VertexArray.h"
@@ -465,7 +466,8 @@ bool ValidateGetShaderivBase(Context *context, GLuint shader, GLenum pname, GLsi
         *length = 0;
     }
 
-    if (GetValidShader(context, shader) == nullptr)
+    // The query itself waits for the compile when it has to.
+    if (GetValidShaderNoResolveCompile(context, shader) == nullptr)
     {
         return false;
     }
@@ -479,6 +481,15 @@ bool ValidateGetShaderivBase(Context *context, GLuint shader, GLenum pname, GLsi
         case GL_SHADER_SOURCE_LENGTH:
             break;
 
+        case GL_COMPLETION_STATUS_KHR:
+            if (!context->getExtensions().parallelShaderCompile)
+            {
+                context->handleError(
+                    Error(GL_INVALID_ENUM, "GL_KHR_parallel_shader_compile is not enabled."));
+                return false;
+            }
+            break;
+
         case GL_TRANSLATED_SHADER_SOURCE_LENGTH_ANGLE:
             if (!context->getExtensions().translatedShaderSource)
             {
@@ -1821,6 +1832,113 @@ bool ValidateES2CopyTexImageParameters(ValidationContext *context,
     return (width > 0 && height > 0);
 }
 
+// Validates the draw states that only change through state setters, object binding changes or
+// framebuffer/program changes. The result of a successful call is cached in State.
+bool ValidateDrawStates(ValidationContext *context,
+                        Framebuffer *framebuffer,
+                        GLenum framebufferStatus)
+{
+    const State &state = context->getGLState();
+
+    // Note: these separate values are not supported in WebGL, due to D3D's limitations. See
+    // Section 6.10 of the WebGL 1.0 spec.
+    if (context->getLimitations().noSeparateStencilRefsAndMasks ||
+        context->getExtensions().webglCompatibility)
+    {
+        const FramebufferAttachment *dsAttachment =
+            framebuffer->getStencilOrDepthStencilAttachment();
+        GLuint stencilBits                = dsAttachment ? dsAttachment->getStencilSize() : 0;
+        GLuint minimumRequiredStencilMask = (1 << stencilBits) - 1;
+        const DepthStencilState &depthStencilState = state.getDepthStencilState();
+
+        bool differentRefs = state.getStencilRef() != state.getStencilBackRef();
+        bool differentWritemasks =
+            (depthStencilState.stencilWritemask & minimumRequiredStencilMask) !=
+            (depthStencilState.stencilBackWritemask & minimumRequiredStencilMask);
+        bool differentMasks = (depthStencilState.stencilMask & minimumRequiredStencilMask) !=
+                              (depthStencilState.stencilBackMask & minimumRequiredStencilMask);
+
+        if (differentRefs || differentWritemasks || differentMasks)
+        {
+            if (!context->getExtensions().webglCompatibility)
+            {
+                ERR() << "This ANGLE implementation does not support separate front/back stencil "
+                         "writemasks, reference values, or stencil mask values.";
+            }
+            context->handleError(Error(GL_INVALID_OPERATION));
+            return false;
+        }
+    }
+
+    if (framebufferStatus != GL_FRAMEBUFFER_COMPLETE)
+    {
+        context->handleError(Error(GL_INVALID_FRAMEBUFFER_OPERATION));
+        return false;
+    }
+
+    gl::Program *program = state.getProgram();
+    if (!program)
+    {
+        context->handleError(Error(GL_INVALID_OPERATION));
+        return false;
+    }
+
+    if (!program->validateSamplers(NULL, context->getCaps()))
+    {
+        context->handleError(Error(GL_INVALID_OPERATION));
+        return false;
+    }
+
+    // Uniform buffer validation
+    for (unsigned int uniformBlockIndex = 0;
+         uniformBlockIndex < program->getActiveUniformBlockCount(); uniformBlockIndex++)
+    {
+        const gl::UniformBlock &uniformBlock = program->getUniformBlockByIndex(uniformBlockIndex);
+        GLuint blockBinding                  = program->getUniformBlockBinding(uniformBlockIndex);
+        const OffsetBindingPointer<Buffer> &uniformBuffer =
+            state.getIndexedUniformBuffer(blockBinding);
+
+        if (uniformBuffer.get() == nullptr)
+        {
+            // undefined behaviour
+            context->handleError(
+                Error(GL_INVALID_OPERATION,
+                      "It is undefined behaviour to have a used but unbound uniform buffer."));
+            return false;
+        }
+
+        size_t uniformBufferSize = uniformBuffer.getSize();
+        if (uniformBufferSize == 0)
+        {
+            // Bind the whole buffer.
+            uniformBufferSize = static_cast<size_t>(uniformBuffer->getSize());
+        }
+
+        if (uniformBufferSize < uniformBlock.dataSize)
+        {
+            // undefined behaviour
+            context->handleError(
+                Error(GL_INVALID_OPERATION,
+                      "It is undefined behaviour to use a uniform buffer that is too small."));
+            return false;
+        }
+    }
+
+    // Detect rendering feedback loops for WebGL.
+    if (context->getExtensions().webglCompatibility)
+    {
+        if (framebuffer->formsRenderingFeedbackLoopWith(state))
+        {
+            context->handleError(
+                Error(GL_INVALID_OPERATION,
+                      "Rendering feedback loop formed between Framebuffer and active Texture."));
+            return false;
+        }
+    }
+
+    return true;
+}
+
 }  // anonymous namespace
 
 bool ValidTextureTarget(const ValidationContext *context, GLenum target)
@@ -2172,7 +2290,7 @@ bool ValidImageDataSize(ValidationContext *context,
     return true;
 }
 
-bool ValidQueryType(const Context *context, GLenum queryType)
+bool ValidQueryType(const ValidationContext *context, GLenum queryType)
 {
     static_assert(GL_ANY_SAMPLES_PASSED == GL_ANY_SAMPLES_PASSED_EXT,
                   "GL extension enums not equal.");
@@ -2243,17 +2361,37 @@ bool ValidateWebGLVertexAttribPointer(ValidationContext *context,
 }
 
 Program *GetValidProgram(ValidationContext *context, GLuint id)
+{
+    Program *validProgram = GetValidProgramNoResolveLink(context, id);
+    if (validProgram)
+    {
+        validProgram->resolveLink();
+    }
+    return validProgram;
+}
+
+Shader *GetValidShader(ValidationContext *context, GLuint id)
+{
+    Shader *validShader = GetValidShaderNoResolveCompile(context, id);
+    if (validShader)
+    {
+        validShader->resolveCompile();
+    }
+    return validShader;
+}
+
+Program *GetValidProgramNoResolveLink(ValidationContext *context, GLuint id)
 {
     // ES3 spec (section 2.11.1) -- "Commands that accept shader or program object names will
     // generate the error INVALID_VALUE if the provided name is not the name of either a shader
     // or program object and INVALID_OPERATION if the provided name identifies an object
     // that is not the expected type."
 
-    Program *validProgram = context->getProgram(id);
+    Program *validProgram = context->getProgramNoResolveLink(id);
 
     if (!validProgram)
     {
-        if (context->getShader(id))
+        if (context->getShaderNoResolveCompile(id))
         {
             context->handleError(
                 Error(GL_INVALID_OPERATION, "Expected a program name, but found a shader name"));
@@ -2267,15 +2405,15 @@ Program *GetValidProgram(ValidationContext *context, GLuint id)
     return validProgram;
 }
 
-Shader *GetValidShader(ValidationContext *context, GLuint id)
+Shader *GetValidShaderNoResolveCompile(ValidationContext *context, GLuint id)
 {
     // See ValidProgram for spec details.
 
-    Shader *validShader = context->getShader(id);
+    Shader *validShader = context->getShaderNoResolveCompile(id);
 
     if (!validShader)
     {
-        if (context->getProgram(id))
+        if (context->getProgramNoResolveLink(id))
         {
             context->handleError(
                 Error(GL_INVALID_OPERATION, "Expected a shader name, but found a program name"));
@@ -3612,101 +3750,19 @@ bool ValidateDrawBase(ValidationContext *context, GLenum mode, GLsizei count)
         return false;
     }
 
-    // Note: these separate values are not supported in WebGL, due to D3D's limitations. See
-    // Section 6.10 of the WebGL 1.0 spec.
+    // Checking the status first brings the framebuffer's completeness serial up to date, which the
+    // draw states cache is keyed on.
     Framebuffer *framebuffer = state.getDrawFramebuffer();
-    if (context->getLimitations().noSeparateStencilRefsAndMasks ||
-        context->getExtensions().webglCompatibility)
-    {
-        const FramebufferAttachment *dsAttachment =
-            framebuffer->getStencilOrDepthStencilAttachment();
-        GLuint stencilBits                = dsAttachment ? dsAttachment->getStencilSize() : 0;
-        GLuint minimumRequiredStencilMask = (1 << stencilBits) - 1;
-        const DepthStencilState &depthStencilState = state.getDepthStencilState();
-
-        bool differentRefs = state.getStencilRef() != state.getStencilBackRef();
-        bool differentWritemasks =
-            (depthStencilState.stencilWritemask & minimumRequiredStencilMask) !=
-            (depthStencilState.stencilBackWritemask & minimumRequiredStencilMask);
-        bool differentMasks = (depthStencilState.stencilMask & minimumRequiredStencilMask) !=
-                              (depthStencilState.stencilBackMask & minimumRequiredStencilMask);
-
-        if (differentRefs || differentWritemasks || differentMasks)
-        {
-            if (!context->getExtensions().webglCompatibility)
-            {
-                ERR() << "This ANGLE implementation does not support separate front/back stencil "
-                         "writemasks, reference values, or stencil mask values.";
-            }
-            context->handleError(Error(GL_INVALID_OPERATION));
-            return false;
-        }
-    }
-
-    if (framebuffer->checkStatus(context) != GL_FRAMEBUFFER_COMPLETE)
-    {
-        context->handleError(Error(GL_INVALID_FRAMEBUFFER_OPERATION));
-        return false;
-    }
-
-    gl::Program *program = state.getProgram();
-    if (!program)
-    {
-        context->handleError(Error(GL_INVALID_OPERATION));
-        return false;
-    }
-
-    if (!program->validateSamplers(NULL, context->getCaps()))
-    {
-        context->handleError(Error(GL_INVALID_OPERATION));
-        return false;
-    }
+    GLenum framebufferStatus = framebuffer->checkStatus(context);
 
-    // Uniform buffer validation
-    for (unsigned int uniformBlockIndex = 0;
-         uniformBlockIndex < program->getActiveUniformBlockCount(); uniformBlockIndex++)
+    if (!state.isDrawStatesCacheValid())
     {
-        const gl::UniformBlock &uniformBlock = program->getUniformBlockByIndex(uniformBlockIndex);
-        GLuint blockBinding                  = program->getUniformBlockBinding(uniformBlockIndex);
-        const OffsetBindingPointer<Buffer> &uniformBuffer =
-            state.getIndexedUniformBuffer(blockBinding);
-
-        if (uniformBuffer.get() == nullptr)
-        {
-            // undefined behaviour
-            context->handleError(
-                Error(GL_INVALID_OPERATION,
-                      "It is undefined behaviour to have a used but unbound uniform buffer."));
-            return false;
-        }
-
-        size_t uniformBufferSize = uniformBuffer.getSize();
-        if (uniformBufferSize == 0)
-        {
-            // Bind the whole buffer.
-            uniformBufferSize = static_cast<size_t>(uniformBuffer->getSize());
-        }
-
-        if (uniformBufferSize < uniformBlock.dataSize)
+        if (!ValidateDrawStates(context, framebuffer, framebufferStatus))
         {
-            // undefined behaviour
-            context->handleError(
-                Error(GL_INVALID_OPERATION,
-                      "It is undefined behaviour to use a uniform buffer that is too small."));
             return false;
         }
-    }
 
-    // Detect rendering feedback loops for WebGL.
-    if (context->getExtensions().webglCompatibility)
-    {
-        if (framebuffer->formsRenderingFeedbackLoopWith(state))
-        {
-            context->handleError(
-                Error(GL_INVALID_OPERATION,
-                      "Rendering feedback loop formed between Framebuffer and active Texture."));
-            return false;
-        }
+        state.setDrawStatesCacheValid();
     }
 
     // No-op if zero count
@@ -3971,23 +4027,10 @@ bool ValidateDrawElements(ValidationContext *context,
     }
 
     // Use max index to validate if our vertex buffers are large enough for the pull.
-    // TODO: offer fast path, with disabled index validation.
     // TODO: also disable index checking on back-ends that are robust to out-of-range accesses.
-    if (elementArrayBuffer)
+    if (!GetDrawElementsIndexRange(context, count, type, indices, indexRangeOut))
     {
-        uintptr_t offset = reinterpret_cast<uintptr_t>(indices);
-        Error error =
-            elementArrayBuffer->getIndexRange(type, static_cast<size_t>(offset), count,
-                                              state.isPrimitiveRestartEnabled(), indexRangeOut);
-        if (error.isError())
-        {
-            context->handleError(error);
-            return false;
-        }
-    }
-    else
-    {
-        *indexRangeOut = ComputeIndexRange(type, indices, count, state.isPrimitiveRestartEnabled());
+        return false;
     }
 
     // If we use an index greater than our maximum supported index range, return an error.
@@ -4009,6 +4052,40 @@ bool ValidateDrawElements(ValidationContext *context,
     return (indexRangeOut->vertexIndexCount > 0);
 }
 
+bool GetDrawElementsIndexRange(ValidationContext *context,
+                               GLsizei count,
+                               GLenum type,
+                               const GLvoid *indices,
+                               IndexRange *indexRangeOut)
+{
+    if (count <= 0)
+    {
+        return false;
+    }
+
+    const State &state             = context->getGLState();
+    gl::Buffer *elementArrayBuffer = state.getVertexArray()->getElementArrayBuffer().get();
+
+    if (elementArrayBuffer)
+    {
+        uintptr_t offset = reinterpret_cast<uintptr_t>(indices);
+        Error error =
+            elementArrayBuffer->getIndexRange(type, static_cast<size_t>(offset), count,
+                                              state.isPrimitiveRestartEnabled(), indexRangeOut);
+        if (error.isError())
+        {
+            context->handleError(error);
+            return false;
+        }
+    }
+    else
+    {
+        *indexRangeOut = ComputeIndexRange(type, indices, count, state.isPrimitiveRestartEnabled());
+    }
+
+    return true;
+}
+
 bool ValidateDrawElementsInstanced(Context *context,
                                    GLenum mode,
                                    GLsizei count,
@@ -5554,7 +5631,8 @@ bool ValidateGetProgramiv(Context *context, GLuint program, GLenum pname, GLsize
         *numParams = 1;
     }
 
-    Program *programObject = GetValidProgram(context, program);
+    // The query itself waits for the link when it has to.
+    Program *programObject = GetValidProgramNoResolveLink(context, program);
     if (!programObject)
     {
         return false;
@@ -5562,6 +5640,15 @@ bool ValidateGetProgramiv(Context *context, GLuint program, GLenum pname, GLsize
 
     switch (pname)
     {
+        case GL_COMPLETION_STATUS_KHR:
+            if (!context->getExtensions().parallelShaderCompile)
+            {
+                context->handleError(
+                    Error(GL_INVALID_ENUM, "GL_KHR_parallel_shader_compile is not enabled."));
+                return false;
+            }
+            break;
+
         case GL_DELETE_STATUS:
         case GL_LINK_STATUS:
         case GL_VALIDATE_STATUS:
@@ -63,7 +63,7 @@ bool ValidImageDataSize(ValidationContext *context,
                         const GLvoid *pixels,
                         GLsizei imageSize);
 
-bool ValidQueryType(const Context *context, GLenum queryType);
+bool ValidQueryType(const ValidationContext *context, GLenum queryType);
 
 bool ValidateWebGLVertexAttribPointer(ValidationContext *context,
                                       GLenum type,
@@ -82,6 +82,10 @@ Program *GetValidProgram(ValidationContext *context, GLuint id);
 // Errors INVALID_VALUE otherwise and returns NULL
 Shader *GetValidShader(ValidationContext *context, GLuint id);
 
+// Same as above, but don't wait for a link or compile that is still running.
+Program *GetValidProgramNoResolveLink(ValidationContext *context, GLuint id);
+Shader *GetValidShaderNoResolveCompile(ValidationContext *context, GLuint id);
+
 bool ValidateAttachmentTarget(Context *context, GLenum attachment);
 bool ValidateRenderbufferStorageParametersBase(ValidationContext *context,
                                                GLenum target,
@@ -274,6 +278,15 @@ bool ValidateDrawElements(ValidationContext *context,
                           GLsizei primcount,
                           IndexRange *indexRangeOut);
 
+// Used by the indexed draw entry points when validation is skipped (KHR_no_error). The back-ends
+// still need the index range, so this computes it without checking anything else. Returns false
+// if the draw should be dropped.
+bool GetDrawElementsIndexRange(ValidationContext *context,
+                               GLsizei count,
+                               GLenum type,
+                               const GLvoid *indices,
+                               IndexRange *indexRangeOut);
+
 bool ValidateDrawElementsInstanced(Context *context,
                                    GLenum mode,
                                    GLsizei count,
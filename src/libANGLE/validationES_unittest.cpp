@@ -7,6 +7,8 @@
 //   Unit tests for general ES validation functions.
 //
 
+#include <set>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -128,4 +130,74 @@ TEST(ValidationESTest, DISABLED_DrawElementsWithMaxIndexGivesError)
     SafeDelete(program);
 }
 
+// Test that every texture target that passes validation packs to a valid TextureType, so State
+// never indexes its bindings with TEXTURE_TYPE_MAX, and that other enums are rejected.
+TEST(ValidationESTest, InvalidTextureTargetsAreRejected)
+{
+    State state;
+    Caps caps;
+    TextureCapsMap textureCaps;
+    Extensions extensions;
+    Limitations limitations;
+    extensions.eglImageExternal = true;
+
+    NiceMock<MockValidationContext> testContext(nullptr, nullptr, Version(3, 1), &state, caps,
+                                                textureCaps, extensions, limitations, false);
+
+    std::set<TextureType> packedTypes;
+    for (GLenum target = 0; target <= 0xFFFF; ++target)
+    {
+        if (!ValidTextureTarget(&testContext, target) &&
+            !ValidTextureExternalTarget(&testContext, target))
+        {
+            continue;
+        }
+
+        TextureType type = GetTextureType(target);
+        ASSERT_LT(type, TEXTURE_TYPE_MAX);
+        EXPECT_EQ(target, GetTextureTarget(type));
+        packedTypes.insert(type);
+    }
+    EXPECT_EQ(static_cast<size_t>(TEXTURE_TYPE_MAX), packedTypes.size());
+
+    EXPECT_FALSE(ValidTextureTarget(&testContext, GL_NONE));
+    EXPECT_FALSE(ValidTextureTarget(&testContext, GL_TEXTURE_CUBE_MAP_POSITIVE_X));
+    EXPECT_FALSE(ValidTextureTarget(&testContext, GL_TEXTURE_BINDING_2D));
+    EXPECT_FALSE(ValidTextureExternalTarget(&testContext, GL_TEXTURE_2D));
+}
+
+// Test that every query target that passes validation packs to a valid QueryType, so State never
+// indexes its active queries with QUERY_TYPE_MAX, and that other enums are rejected.
+TEST(ValidationESTest, InvalidQueryTargetsAreRejected)
+{
+    State state;
+    Caps caps;
+    TextureCapsMap textureCaps;
+    Extensions extensions;
+    Limitations limitations;
+    extensions.disjointTimerQuery = true;
+    extensions.syncQuery          = true;
+
+    NiceMock<MockValidationContext> testContext(nullptr, nullptr, Version(3, 0), &state, caps,
+                                                textureCaps, extensions, limitations, false);
+
+    std::set<QueryType> packedTypes;
+    for (GLenum target = 0; target <= 0xFFFF; ++target)
+    {
+        if (!ValidQueryType(&testContext, target))
+        {
+            continue;
+        }
+
+        QueryType type = GetQueryType(target);
+        ASSERT_LT(type, QUERY_TYPE_MAX);
+        packedTypes.insert(type);
+    }
+    EXPECT_EQ(static_cast<size_t>(QUERY_TYPE_MAX), packedTypes.size());
+
+    EXPECT_FALSE(ValidQueryType(&testContext, GL_NONE));
+    EXPECT_FALSE(ValidQueryType(&testContext, GL_TIMESTAMP_EXT));
+    EXPECT_FALSE(ValidQueryType(&testContext, GL_QUERY_RESULT));
+}
+
 }  // anonymous namespace
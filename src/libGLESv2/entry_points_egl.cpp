@@ -1422,6 +1422,9 @@ __eglMustCastToProperFunctionPointerType EGLAPIENTRY GetProcAddress(const char *
         INSERT_PROC_ADDRESS(gl, GetObjectPtrLabelKHR);
         INSERT_PROC_ADDRESS(gl, GetPointervKHR);
 
+        // GL_KHR_parallel_shader_compile
+        INSERT_PROC_ADDRESS(gl, MaxShaderCompilerThreadsKHR);
+
         // GL_CHROMIUM_bind_uniform_location
         INSERT_PROC_ADDRESS(gl, BindUniformLocationCHROMIUM);
 
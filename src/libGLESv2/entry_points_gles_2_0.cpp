@@ -735,7 +735,14 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const GLv
     {
         // TODO(jmadill): Cache index range in the context.
         IndexRange indexRange;
-        if (!ValidateDrawElements(context, mode, count, type, indices, 1, &indexRange))
+        if (context->skipValidation())
+        {
+            if (!GetDrawElementsIndexRange(context, count, type, indices, &indexRange))
+            {
+                return;
+            }
+        }
+        else if (!ValidateDrawElements(context, mode, count, type, indices, 1, &indexRange))
         {
             return;
         }
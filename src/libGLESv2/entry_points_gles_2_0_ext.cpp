@@ -103,7 +103,7 @@ void GL_APIENTRY BeginQueryEXT(GLenum target, GLuint id)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateBeginQueryEXT(context, target, id))
+        if (!context->skipValidation() && !ValidateBeginQueryEXT(context, target, id))
         {
             return;
         }
@@ -124,7 +124,7 @@ void GL_APIENTRY EndQueryEXT(GLenum target)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateEndQueryEXT(context, target))
+        if (!context->skipValidation() && !ValidateEndQueryEXT(context, target))
         {
             return;
         }
@@ -145,7 +145,7 @@ void GL_APIENTRY QueryCounterEXT(GLuint id, GLenum target)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateQueryCounterEXT(context, id, target))
+        if (!context->skipValidation() && !ValidateQueryCounterEXT(context, id, target))
         {
             return;
         }
@@ -167,7 +167,7 @@ void GL_APIENTRY GetQueryivEXT(GLenum target, GLenum pname, GLint *params)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryivEXT(context, target, pname, params))
+        if (!context->skipValidation() && !ValidateGetQueryivEXT(context, target, pname, params))
         {
             return;
         }
@@ -183,7 +183,7 @@ void GL_APIENTRY GetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryObjectivEXT(context, id, pname, params))
+        if (!context->skipValidation() && !ValidateGetQueryObjectivEXT(context, id, pname, params))
         {
             return;
         }
@@ -199,7 +199,7 @@ void GL_APIENTRY GetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryObjectuivEXT(context, id, pname, params))
+        if (!context->skipValidation() && !ValidateGetQueryObjectuivEXT(context, id, pname, params))
         {
             return;
         }
@@ -215,7 +215,8 @@ void GL_APIENTRY GetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *params)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryObjecti64vEXT(context, id, pname, params))
+        if (!context->skipValidation() &&
+            !ValidateGetQueryObjecti64vEXT(context, id, pname, params))
         {
             return;
         }
@@ -231,7 +232,8 @@ void GL_APIENTRY GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *param
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryObjectui64vEXT(context, id, pname, params))
+        if (!context->skipValidation() &&
+            !ValidateGetQueryObjectui64vEXT(context, id, pname, params))
         {
             return;
         }
@@ -271,7 +273,8 @@ void GL_APIENTRY DrawArraysInstancedANGLE(GLenum mode,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateDrawArraysInstancedANGLE(context, mode, first, count, primcount))
+        if (!context->skipValidation() &&
+            !ValidateDrawArraysInstancedANGLE(context, mode, first, count, primcount))
         {
             return;
         }
@@ -295,8 +298,15 @@ void GL_APIENTRY DrawElementsInstancedANGLE(GLenum mode,
     if (context)
     {
         IndexRange indexRange;
-        if (!ValidateDrawElementsInstancedANGLE(context, mode, count, type, indices, primcount,
-                                                &indexRange))
+        if (context->skipValidation())
+        {
+            if (!GetDrawElementsIndexRange(context, count, type, indices, &indexRange))
+            {
+                return;
+            }
+        }
+        else if (!ValidateDrawElementsInstancedANGLE(context, mode, count, type, indices, primcount,
+                                                     &indexRange))
         {
             return;
         }
@@ -455,7 +465,8 @@ void GL_APIENTRY GetnUniformfvEXT(GLuint program, GLint location, GLsizei bufSiz
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetnUniformfvEXT(context, program, location, bufSize, params))
+        if (!context->skipValidation() &&
+            !ValidateGetnUniformfvEXT(context, program, location, bufSize, params))
         {
             return;
         }
@@ -475,7 +486,8 @@ void GL_APIENTRY GetnUniformivEXT(GLuint program, GLint location, GLsizei bufSiz
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetnUniformivEXT(context, program, location, bufSize, params))
+        if (!context->skipValidation() &&
+            !ValidateGetnUniformivEXT(context, program, location, bufSize, params))
         {
             return;
         }
@@ -744,7 +756,8 @@ void GL_APIENTRY GetProgramBinaryOES(GLuint program, GLsizei bufSize, GLsizei *l
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetProgramBinaryOES(context, program, bufSize, length, binaryFormat, binary))
+        if (!context->skipValidation() &&
+            !ValidateGetProgramBinaryOES(context, program, bufSize, length, binaryFormat, binary))
         {
             return;
         }
@@ -769,7 +782,8 @@ void GL_APIENTRY ProgramBinaryOES(GLuint program, GLenum binaryFormat, const voi
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramBinaryOES(context, program, binaryFormat, binary, length))
+        if (!context->skipValidation() &&
+            !ValidateProgramBinaryOES(context, program, binaryFormat, binary, length))
         {
             return;
         }
@@ -908,7 +922,7 @@ void GL_APIENTRY InsertEventMarkerEXT(GLsizei length, const char *marker)
             return;
         }
 
-        if (!ValidateInsertEventMarkerEXT(context, length, marker))
+        if (!context->skipValidation() && !ValidateInsertEventMarkerEXT(context, length, marker))
         {
             return;
         }
@@ -933,7 +947,7 @@ void GL_APIENTRY PushGroupMarkerEXT(GLsizei length, const char *marker)
             return;
         }
 
-        if (!ValidatePushGroupMarkerEXT(context, length, marker))
+        if (!context->skipValidation() && !ValidatePushGroupMarkerEXT(context, length, marker))
         {
             return;
         }
@@ -981,7 +995,8 @@ ANGLE_EXPORT void GL_APIENTRY EGLImageTargetTexture2DOES(GLenum target, GLeglIma
     {
         egl::Display *display   = thread->getDisplay();
         egl::Image *imageObject = reinterpret_cast<egl::Image *>(image);
-        if (!ValidateEGLImageTargetTexture2DOES(context, display, target, imageObject))
+        if (!context->skipValidation() &&
+            !ValidateEGLImageTargetTexture2DOES(context, display, target, imageObject))
         {
             return;
         }
@@ -1007,7 +1022,8 @@ ANGLE_EXPORT void GL_APIENTRY EGLImageTargetRenderbufferStorageOES(GLenum target
     {
         egl::Display *display   = thread->getDisplay();
         egl::Image *imageObject = reinterpret_cast<egl::Image *>(image);
-        if (!ValidateEGLImageTargetRenderbufferStorageOES(context, display, target, imageObject))
+        if (!context->skipValidation() &&
+            !ValidateEGLImageTargetRenderbufferStorageOES(context, display, target, imageObject))
         {
             return;
         }
@@ -1029,7 +1045,7 @@ void GL_APIENTRY BindVertexArrayOES(GLuint array)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateBindVertexArrayOES(context, array))
+        if (!context->skipValidation() && !ValidateBindVertexArrayOES(context, array))
         {
             return;
         }
@@ -1045,7 +1061,7 @@ void GL_APIENTRY DeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateDeleteVertexArraysOES(context, n))
+        if (!context->skipValidation() && !ValidateDeleteVertexArraysOES(context, n))
         {
             return;
         }
@@ -1067,7 +1083,7 @@ void GL_APIENTRY GenVertexArraysOES(GLsizei n, GLuint *arrays)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGenVertexArraysOES(context, n))
+        if (!context->skipValidation() && !ValidateGenVertexArraysOES(context, n))
         {
             return;
         }
@@ -1086,7 +1102,7 @@ GLboolean GL_APIENTRY IsVertexArrayOES(GLuint array)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateIsVertexArrayOES(context))
+        if (!context->skipValidation() && !ValidateIsVertexArrayOES(context))
         {
             return GL_FALSE;
         }
@@ -1119,7 +1135,8 @@ void GL_APIENTRY DebugMessageControlKHR(GLenum source,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateDebugMessageControlKHR(context, source, type, severity, count, ids, enabled))
+        if (!context->skipValidation() &&
+            !ValidateDebugMessageControlKHR(context, source, type, severity, count, ids, enabled))
         {
             return;
         }
@@ -1143,7 +1160,8 @@ void GL_APIENTRY DebugMessageInsertKHR(GLenum source,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateDebugMessageInsertKHR(context, source, type, id, severity, length, buf))
+        if (!context->skipValidation() &&
+            !ValidateDebugMessageInsertKHR(context, source, type, id, severity, length, buf))
         {
             return;
         }
@@ -1160,7 +1178,8 @@ void GL_APIENTRY DebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void *us
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateDebugMessageCallbackKHR(context, callback, userParam))
+        if (!context->skipValidation() &&
+            !ValidateDebugMessageCallbackKHR(context, callback, userParam))
         {
             return;
         }
@@ -1187,7 +1206,8 @@ GLuint GL_APIENTRY GetDebugMessageLogKHR(GLuint count,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetDebugMessageLogKHR(context, count, bufSize, sources, types, ids, severities,
+        if (!context->skipValidation() &&
+            !ValidateGetDebugMessageLogKHR(context, count, bufSize, sources, types, ids, severities,
                                            lengths, messageLog))
         {
             return 0;
@@ -1210,7 +1230,8 @@ void GL_APIENTRY PushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, con
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidatePushDebugGroupKHR(context, source, id, length, message))
+        if (!context->skipValidation() &&
+            !ValidatePushDebugGroupKHR(context, source, id, length, message))
         {
             return;
         }
@@ -1227,7 +1248,7 @@ void GL_APIENTRY PopDebugGroupKHR(void)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidatePopDebugGroupKHR(context))
+        if (!context->skipValidation() && !ValidatePopDebugGroupKHR(context))
         {
             return;
         }
@@ -1246,7 +1267,8 @@ void GL_APIENTRY ObjectLabelKHR(GLenum identifier, GLuint name, GLsizei length,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateObjectLabelKHR(context, identifier, name, length, label))
+        if (!context->skipValidation() &&
+            !ValidateObjectLabelKHR(context, identifier, name, length, label))
         {
             return;
         }
@@ -1266,7 +1288,8 @@ GetObjectLabelKHR(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *leng
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetObjectLabelKHR(context, identifier, name, bufSize, length, label))
+        if (!context->skipValidation() &&
+            !ValidateGetObjectLabelKHR(context, identifier, name, bufSize, length, label))
         {
             return;
         }
@@ -1283,7 +1306,7 @@ void GL_APIENTRY ObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLchar
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateObjectPtrLabelKHR(context, ptr, length, label))
+        if (!context->skipValidation() && !ValidateObjectPtrLabelKHR(context, ptr, length, label))
         {
             return;
         }
@@ -1305,7 +1328,8 @@ void GL_APIENTRY GetObjectPtrLabelKHR(const void *ptr,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetObjectPtrLabelKHR(context, ptr, bufSize, length, label))
+        if (!context->skipValidation() &&
+            !ValidateGetObjectPtrLabelKHR(context, ptr, bufSize, length, label))
         {
             return;
         }
@@ -1321,7 +1345,7 @@ void GL_APIENTRY GetPointervKHR(GLenum pname, void **params)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetPointervKHR(context, pname, params))
+        if (!context->skipValidation() && !ValidateGetPointervKHR(context, pname, params))
         {
             return;
         }
@@ -1330,6 +1354,22 @@ void GL_APIENTRY GetPointervKHR(GLenum pname, void **params)
     }
 }
 
+void GL_APIENTRY MaxShaderCompilerThreadsKHR(GLuint count)
+{
+    EVENT("(GLuint count = %u)", count);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        if (!context->skipValidation() && !ValidateMaxShaderCompilerThreadsKHR(context, count))
+        {
+            return;
+        }
+
+        context->maxShaderCompilerThreads(count);
+    }
+}
+
 ANGLE_EXPORT void GL_APIENTRY BindUniformLocationCHROMIUM(GLuint program,
                                                           GLint location,
                                                           const GLchar *name)
@@ -1340,7 +1380,8 @@ ANGLE_EXPORT void GL_APIENTRY BindUniformLocationCHROMIUM(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateBindUniformLocationCHROMIUM(context, program, location, name))
+        if (!context->skipValidation() &&
+            !ValidateBindUniformLocationCHROMIUM(context, program, location, name))
         {
             return;
         }
@@ -1356,7 +1397,7 @@ ANGLE_EXPORT void GL_APIENTRY CoverageModulationCHROMIUM(GLenum components)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateCoverageModulationCHROMIUM(context, components))
+        if (!context->skipValidation() && !ValidateCoverageModulationCHROMIUM(context, components))
         {
             return;
         }
@@ -2110,8 +2151,7 @@ ANGLE_EXPORT void GL_APIENTRY GetProgramivRobustANGLE(GLuint program,
             return;
         }
 
-        Program *programObject = context->getProgram(program);
-        QueryProgramiv(programObject, pname, params);
+        context->getProgramiv(program, pname, params);
         SetRobustLengthParam(length, numParams);
     }
 }
@@ -2160,8 +2200,7 @@ GetShaderivRobustANGLE(GLuint shader, GLenum pname, GLsizei bufSize, GLsizei *le
             return;
         }
 
-        Shader *shaderObject = context->getShader(shader);
-        QueryShaderiv(shaderObject, pname, params);
+        context->getShaderiv(shader, pname, params);
         SetRobustLengthParam(length, numParams);
     }
 }
@@ -54,9 +54,15 @@ void GL_APIENTRY DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsize
     if (context)
     {
         IndexRange indexRange;
-        if (!context->skipValidation() &&
-            !ValidateDrawRangeElements(context, mode, start, end, count, type, indices,
-                                       &indexRange))
+        if (context->skipValidation())
+        {
+            if (!GetDrawElementsIndexRange(context, count, type, indices, &indexRange))
+            {
+                return;
+            }
+        }
+        else if (!ValidateDrawRangeElements(context, mode, start, end, count, type, indices,
+                                            &indexRange))
         {
             return;
         }
@@ -237,7 +243,7 @@ void GL_APIENTRY BeginQuery(GLenum target, GLuint id)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateBeginQuery(context, target, id))
+        if (!context->skipValidation() && !ValidateBeginQuery(context, target, id))
         {
             return;
         }
@@ -258,7 +264,7 @@ void GL_APIENTRY EndQuery(GLenum target)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateEndQuery(context, target))
+        if (!context->skipValidation() && !ValidateEndQuery(context, target))
         {
             return;
         }
@@ -279,7 +285,7 @@ void GL_APIENTRY GetQueryiv(GLenum target, GLenum pname, GLint* params)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryiv(context, target, pname, params))
+        if (!context->skipValidation() && !ValidateGetQueryiv(context, target, pname, params))
         {
             return;
         }
@@ -295,7 +301,7 @@ void GL_APIENTRY GetQueryObjectuiv(GLuint id, GLenum pname, GLuint* params)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetQueryObjectuiv(context, id, pname, params))
+        if (!context->skipValidation() && !ValidateGetQueryObjectuiv(context, id, pname, params))
         {
             return;
         }
@@ -361,7 +367,8 @@ void GL_APIENTRY UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT2x3, location, count, transpose))
+        if (!context->skipValidation() &&
+            !ValidateUniformMatrix(context, GL_FLOAT_MAT2x3, location, count, transpose))
         {
             return;
         }
@@ -379,7 +386,8 @@ void GL_APIENTRY UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT3x2, location, count, transpose))
+        if (!context->skipValidation() &&
+            !ValidateUniformMatrix(context, GL_FLOAT_MAT3x2, location, count, transpose))
         {
             return;
         }
@@ -397,7 +405,8 @@ void GL_APIENTRY UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT2x4, location, count, transpose))
+        if (!context->skipValidation() &&
+            !ValidateUniformMatrix(context, GL_FLOAT_MAT2x4, location, count, transpose))
         {
             return;
         }
@@ -415,7 +424,8 @@ void GL_APIENTRY UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT4x2, location, count, transpose))
+        if (!context->skipValidation() &&
+            !ValidateUniformMatrix(context, GL_FLOAT_MAT4x2, location, count, transpose))
         {
             return;
         }
@@ -433,7 +443,8 @@ void GL_APIENTRY UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT3x4, location, count, transpose))
+        if (!context->skipValidation() &&
+            !ValidateUniformMatrix(context, GL_FLOAT_MAT3x4, location, count, transpose))
         {
             return;
         }
@@ -451,7 +462,8 @@ void GL_APIENTRY UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniformMatrix(context, GL_FLOAT_MAT4x3, location, count, transpose))
+        if (!context->skipValidation() &&
+            !ValidateUniformMatrix(context, GL_FLOAT_MAT4x3, location, count, transpose))
         {
             return;
         }
@@ -563,7 +575,7 @@ void GL_APIENTRY BindVertexArray(GLuint array)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateBindVertexArray(context, array))
+        if (!context->skipValidation() && !ValidateBindVertexArray(context, array))
         {
             return;
         }
@@ -620,7 +632,7 @@ GLboolean GL_APIENTRY IsVertexArray(GLuint array)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateIsVertexArray(context))
+        if (!context->skipValidation() && !ValidateIsVertexArray(context))
         {
             return GL_FALSE;
         }
@@ -969,7 +981,8 @@ void GL_APIENTRY GetUniformuiv(GLuint program, GLint location, GLuint* params)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetUniformuiv(context, program, location, params))
+        if (!context->skipValidation() &&
+            !ValidateGetUniformuiv(context, program, location, params))
         {
             return;
         }
@@ -1046,7 +1059,8 @@ void GL_APIENTRY Uniform1uiv(GLint location, GLsizei count, const GLuint* value)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_UNSIGNED_INT, location, count))
+        if (!context->skipValidation() &&
+            !ValidateUniform(context, GL_UNSIGNED_INT, location, count))
         {
             return;
         }
@@ -1064,7 +1078,8 @@ void GL_APIENTRY Uniform2uiv(GLint location, GLsizei count, const GLuint* value)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_UNSIGNED_INT_VEC2, location, count))
+        if (!context->skipValidation() &&
+            !ValidateUniform(context, GL_UNSIGNED_INT_VEC2, location, count))
         {
             return;
         }
@@ -1082,7 +1097,8 @@ void GL_APIENTRY Uniform3uiv(GLint location, GLsizei count, const GLuint* value)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_UNSIGNED_INT_VEC3, location, count))
+        if (!context->skipValidation() &&
+            !ValidateUniform(context, GL_UNSIGNED_INT_VEC3, location, count))
         {
             return;
         }
@@ -1100,7 +1116,8 @@ void GL_APIENTRY Uniform4uiv(GLint location, GLsizei count, const GLuint* value)
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateUniform(context, GL_UNSIGNED_INT_VEC4, location, count))
+        if (!context->skipValidation() &&
+            !ValidateUniform(context, GL_UNSIGNED_INT_VEC4, location, count))
         {
             return;
         }
@@ -1459,7 +1476,8 @@ void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GL
             return;
         }
 
-        if (!ValidateDrawArraysInstanced(context, mode, first, count, instanceCount))
+        if (!context->skipValidation() &&
+            !ValidateDrawArraysInstanced(context, mode, first, count, instanceCount))
         {
             return;
         }
@@ -1483,7 +1501,15 @@ void GL_APIENTRY DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type,
         }
 
         IndexRange indexRange;
-        if (!ValidateDrawElementsInstanced(context, mode, count, type, indices, instanceCount, &indexRange))
+        if (context->skipValidation())
+        {
+            if (!GetDrawElementsIndexRange(context, count, type, indices, &indexRange))
+            {
+                return;
+            }
+        }
+        else if (!ValidateDrawElementsInstanced(context, mode, count, type, indices, instanceCount,
+                                                &indexRange))
         {
             return;
         }
@@ -2132,7 +2158,8 @@ void GL_APIENTRY GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei* leng
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateGetProgramBinary(context, program, bufSize, length, binaryFormat, binary))
+        if (!context->skipValidation() &&
+            !ValidateGetProgramBinary(context, program, bufSize, length, binaryFormat, binary))
         {
             return;
         }
@@ -2157,7 +2184,8 @@ void GL_APIENTRY ProgramBinary(GLuint program, GLenum binaryFormat, const GLvoid
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramBinary(context, program, binaryFormat, binary, length))
+        if (!context->skipValidation() &&
+            !ValidateProgramBinary(context, program, binaryFormat, binary, length))
         {
             return;
         }
@@ -2243,7 +2271,8 @@ void GL_APIENTRY TexStorage2D(GLenum target, GLsizei levels, GLenum internalform
             return;
         }
 
-        if (!ValidateES3TexStorage2DParameters(context, target, levels, internalformat, width,
+        if (!context->skipValidation() &&
+            !ValidateES3TexStorage2DParameters(context, target, levels, internalformat, width,
                                                height, 1))
         {
             return;
@@ -2275,7 +2304,8 @@ void GL_APIENTRY TexStorage3D(GLenum target, GLsizei levels, GLenum internalform
             return;
         }
 
-        if (!ValidateES3TexStorage3DParameters(context, target, levels, internalformat, width,
+        if (!context->skipValidation() &&
+            !ValidateES3TexStorage3DParameters(context, target, levels, internalformat, width,
                                                height, depth))
         {
             return;
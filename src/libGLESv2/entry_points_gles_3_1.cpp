@@ -426,7 +426,8 @@ void GL_APIENTRY ProgramUniform1iv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform1iv(context, program, location, count, value))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform1iv(context, program, location, count, value))
         {
             return;
         }
@@ -449,7 +450,8 @@ void GL_APIENTRY ProgramUniform2iv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_INT_VEC2, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_INT_VEC2, program, location, count))
         {
             return;
         }
@@ -472,7 +474,8 @@ void GL_APIENTRY ProgramUniform3iv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_INT_VEC3, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_INT_VEC3, program, location, count))
         {
             return;
         }
@@ -495,7 +498,8 @@ void GL_APIENTRY ProgramUniform4iv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_INT_VEC4, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_INT_VEC4, program, location, count))
         {
             return;
         }
@@ -518,7 +522,8 @@ void GL_APIENTRY ProgramUniform1uiv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_UNSIGNED_INT, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_UNSIGNED_INT, program, location, count))
         {
             return;
         }
@@ -541,7 +546,8 @@ void GL_APIENTRY ProgramUniform2uiv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC2, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC2, program, location, count))
         {
             return;
         }
@@ -564,7 +570,8 @@ void GL_APIENTRY ProgramUniform3uiv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC3, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC3, program, location, count))
         {
             return;
         }
@@ -587,7 +594,8 @@ void GL_APIENTRY ProgramUniform4uiv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC4, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_UNSIGNED_INT_VEC4, program, location, count))
         {
             return;
         }
@@ -610,7 +618,8 @@ void GL_APIENTRY ProgramUniform1fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_FLOAT, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_FLOAT, program, location, count))
         {
             return;
         }
@@ -633,7 +642,8 @@ void GL_APIENTRY ProgramUniform2fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_FLOAT_VEC2, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_FLOAT_VEC2, program, location, count))
         {
             return;
         }
@@ -656,7 +666,8 @@ void GL_APIENTRY ProgramUniform3fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_FLOAT_VEC3, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_FLOAT_VEC3, program, location, count))
         {
             return;
         }
@@ -679,7 +690,8 @@ void GL_APIENTRY ProgramUniform4fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniform(context, GL_FLOAT_VEC4, program, location, count))
+        if (!context->skipValidation() &&
+            !ValidateProgramUniform(context, GL_FLOAT_VEC4, program, location, count))
         {
             return;
         }
@@ -703,7 +715,8 @@ void GL_APIENTRY ProgramUniformMatrix2fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2, program, location, count,
                                           transpose))
         {
             return;
@@ -728,7 +741,8 @@ void GL_APIENTRY ProgramUniformMatrix3fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3, program, location, count,
                                           transpose))
         {
             return;
@@ -753,7 +767,8 @@ void GL_APIENTRY ProgramUniformMatrix4fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4, program, location, count,
                                           transpose))
         {
             return;
@@ -778,7 +793,8 @@ void GL_APIENTRY ProgramUniformMatrix2x3fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2x3, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2x3, program, location, count,
                                           transpose))
         {
             return;
@@ -803,7 +819,8 @@ void GL_APIENTRY ProgramUniformMatrix3x2fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3x2, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3x2, program, location, count,
                                           transpose))
         {
             return;
@@ -828,7 +845,8 @@ void GL_APIENTRY ProgramUniformMatrix2x4fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2x4, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT2x4, program, location, count,
                                           transpose))
         {
             return;
@@ -853,7 +871,8 @@ void GL_APIENTRY ProgramUniformMatrix4x2fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4x2, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4x2, program, location, count,
                                           transpose))
         {
             return;
@@ -878,7 +897,8 @@ void GL_APIENTRY ProgramUniformMatrix3x4fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3x4, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT3x4, program, location, count,
                                           transpose))
         {
             return;
@@ -903,7 +923,8 @@ void GL_APIENTRY ProgramUniformMatrix4x3fv(GLuint program,
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        if (!ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4x3, program, location, count,
+        if (!context->skipValidation() &&
+            !ValidateProgramUniformMatrix(context, GL_FLOAT_MAT4x3, program, location, count,
                                           transpose))
         {
             return;
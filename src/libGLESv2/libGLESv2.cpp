@@ -1564,6 +1564,11 @@ void GL_APIENTRY glGetPointervKHR(GLenum pname, void **params)
     return gl::GetPointervKHR(pname, params);
 }
 
+void GL_APIENTRY glMaxShaderCompilerThreadsKHR(GLuint count)
+{
+    return gl::MaxShaderCompilerThreadsKHR(count);
+}
+
 void GL_APIENTRY glBindUniformLocationCHROMIUM(GLuint program, GLint location, const GLchar *name)
 {
     return gl::BindUniformLocationCHROMIUM(program, location, name);
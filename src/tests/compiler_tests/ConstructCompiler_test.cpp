@@ -43,3 +43,40 @@ TEST(ConstructCompilerTest, InvalidMaxDualSourceDrawBuffers)
                                               SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
     ASSERT_EQ(nullptr, compiler);
 }
+
+// Test that compilers built with different resources see their own built-in constants, and that
+// destroying a compiler doesn't affect the built-ins of another one with the same resources.
+TEST(ConstructCompilerTest, BuiltInsFollowResources)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "void main()\n"
+        "{\n"
+        "    float a[gl_MaxDrawBuffers - 3];\n"
+        "    a[0] = 0.0;\n"
+        "    gl_FragColor = vec4(a[0]);\n"
+        "}\n";
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.MaxDrawBuffers = 4;
+    ShHandle fourDrawBuffers = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                                     SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+    ShHandle sameResources   = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                                   SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+    resources.MaxDrawBuffers = 2;
+    ShHandle twoDrawBuffers  = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                                    SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+    ASSERT_NE(nullptr, fourDrawBuffers);
+    ASSERT_NE(nullptr, sameResources);
+    ASSERT_NE(nullptr, twoDrawBuffers);
+
+    EXPECT_TRUE(sh::Compile(fourDrawBuffers, &shaderString, 1, SH_OBJECT_CODE));
+    EXPECT_FALSE(sh::Compile(twoDrawBuffers, &shaderString, 1, SH_OBJECT_CODE));
+
+    sh::Destruct(fourDrawBuffers);
+    EXPECT_TRUE(sh::Compile(sameResources, &shaderString, 1, SH_OBJECT_CODE));
+
+    sh::Destruct(sameResources);
+    sh::Destruct(twoDrawBuffers);
+}
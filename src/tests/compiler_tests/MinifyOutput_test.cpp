@@ -0,0 +1,131 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MinifyOutput_test.cpp:
+//   Tests for the compact GLSL/ESSL output written with SH_MINIFY_OUTPUT.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+class MinifyOutputTest : public MatchOutputCodeTest
+{
+  public:
+    MinifyOutputTest() : MatchOutputCodeTest(GL_FRAGMENT_SHADER, SH_MINIFY_OUTPUT, SH_ESSL_OUTPUT)
+    {
+    }
+};
+
+// Local variables, parameters and functions get short names in the order they are written, but
+// the variables that are part of the interface of the shader keep their names.
+TEST_F(MinifyOutputTest, RenamesVariablesLocalToTheShader)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "out vec4 my_FragColor;\n"
+        "float square(float x) {\n"
+        "    return x * x;\n"
+        "}\n"
+        "void main() {\n"
+        "    float scale = square(u);\n"
+        "    my_FragColor = vec4(scale);\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("uniform mediump float u;"));
+    EXPECT_TRUE(foundInCode("out mediump vec4 my_FragColor;"));
+    EXPECT_TRUE(foundInCode("mediump float _a(in mediump float _b){return _b*_b;}"));
+    EXPECT_TRUE(foundInCode("void main(){mediump float _c=_a(u);my_FragColor=vec4(_c);}"));
+    EXPECT_TRUE(notFoundInCode("square"));
+    EXPECT_TRUE(notFoundInCode("scale"));
+}
+
+// The short names skip the names the shader already uses.
+TEST_F(MinifyOutputTest, AvoidsNamesUsedByTheShader)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float _a;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    float f = _a;\n"
+        "    my_FragColor = vec4(f);\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("mediump float _b=_a;"));
+    EXPECT_TRUE(foundInCode("my_FragColor=vec4(_b);"));
+}
+
+// Parentheses are only written where the precedence of the operators needs them, and operators
+// with the same sign are kept apart.
+TEST_F(MinifyOutputTest, LeavesOutRedundantParentheses)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "uniform vec2 v;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    my_FragColor.x = u - v.x - (u - v.y) * u;\n"
+        "    my_FragColor.y = u - -v.x + -(-u);\n"
+        "    my_FragColor.z = (u > 0.0 ? u : -u) + (v * 2.0).x;\n"
+        "    my_FragColor.w = u - -1.0;\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("my_FragColor.x=u-v.x-(u-v.y)*u;"));
+    EXPECT_TRUE(foundInCode("my_FragColor.y=u- -v.x+-(-u);"));
+    EXPECT_TRUE(foundInCode("my_FragColor.z=(u>0.0?u:-u)+(v*2.0).x;"));
+    EXPECT_TRUE(foundInCode("my_FragColor.w=u- -1.0;"));
+}
+
+// Consecutive declarations of local variables of the same type are merged.
+TEST_F(MinifyOutputTest, MergesDeclarations)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "uniform float w;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    float a = u;\n"
+        "    float b = a + u, c = b;\n"
+        "    highp float d = u;\n"
+        "    int i = 2;\n"
+        "    my_FragColor = vec4(a, b, c, d * float(i));\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("uniform mediump float u;uniform mediump float w;"));
+    EXPECT_TRUE(foundInCode("mediump float _a=u,_b=_a+u,_c=_b;highp float _d=u;mediump int _e=2;"));
+}
+
+// Without the option, the output is written as before.
+TEST_F(MinifyOutputTest, OnlyMinifiesWithTheOption)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    float scale = u * 2.0;\n"
+        "    my_FragColor = vec4(scale);\n"
+        "}\n";
+    compile(shaderString, 0);
+    EXPECT_TRUE(foundInCode("mediump float scale = (u * 2.0);"));
+    EXPECT_TRUE(foundInCode("(my_FragColor = vec4(scale));"));
+}
+
+}  // anonymous namespace
@@ -0,0 +1,208 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeTree_test.cpp:
+//   Tests for the constant propagation and dead code elimination done with SH_OPTIMIZE_TREE.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+class OptimizeTreeTest : public MatchOutputCodeTest
+{
+  public:
+    OptimizeTreeTest() : MatchOutputCodeTest(GL_FRAGMENT_SHADER, SH_OPTIMIZE_TREE, SH_ESSL_OUTPUT)
+    {
+    }
+};
+
+// Variables that are initialized with a constant and never written to are replaced by the
+// constant, and the expressions using them are folded.
+TEST_F(OptimizeTreeTest, PropagatesConstantVariables)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "out vec4 my_FragColor;\n"
+        "float scale = 4.0;\n"
+        "void main() {\n"
+        "    float halfScale = scale * 0.5;\n"
+        "    float offset = halfScale + 1.0;\n"
+        "    my_FragColor = vec4(u * offset);\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("3.0"));
+    EXPECT_TRUE(notFoundInCode("scale"));
+    EXPECT_TRUE(notFoundInCode("halfScale"));
+    EXPECT_TRUE(notFoundInCode("offset"));
+}
+
+// Variables that are written after their declaration keep their reads.
+TEST_F(OptimizeTreeTest, KeepsWrittenVariables)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    float f = 1.0;\n"
+        "    float g = 2.0;\n"
+        "    if (u > 0.0) {\n"
+        "        f = u;\n"
+        "    }\n"
+        "    g += u;\n"
+        "    my_FragColor = vec4(f, g, 0.0, 1.0);\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("f = u"));
+    EXPECT_TRUE(foundInCode("g += u"));
+    EXPECT_TRUE(foundInCode("vec4(f, g"));
+}
+
+// Branches with conditions that become constant are replaced by the code that runs, and the
+// functions that were only called from the other branches are pruned.
+TEST_F(OptimizeTreeTest, RemovesConstantBranchesAndTheirFunctions)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "out vec4 my_FragColor;\n"
+        "bool debugOutput = false;\n"
+        "vec4 debugColor(float x) {\n"
+        "    return vec4(x, 0.0, 1.0, 1.0);\n"
+        "}\n"
+        "void main() {\n"
+        "    int mode = 2;\n"
+        "    if (debugOutput) {\n"
+        "        my_FragColor = debugColor(u);\n"
+        "    } else {\n"
+        "        my_FragColor = vec4(mode == 2 ? u : 0.0);\n"
+        "    }\n"
+        "    while (debugOutput) {\n"
+        "        my_FragColor += debugColor(u);\n"
+        "    }\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(notFoundInCode("debug"));
+    EXPECT_TRUE(notFoundInCode("if ("));
+    EXPECT_TRUE(notFoundInCode("while"));
+    EXPECT_TRUE(notFoundInCode("mode"));
+    EXPECT_TRUE(foundInCode("my_FragColor = vec4(u)"));
+
+    compile(shaderString, SH_OPTIMIZE_TREE | SH_DONT_PRUNE_UNUSED_FUNCTIONS);
+    EXPECT_TRUE(foundInCode("debugColor("));
+    EXPECT_TRUE(notFoundInCode("if ("));
+}
+
+// Variables that are never read are removed along with the assignments to them, but the side
+// effects of their initializers and assigned values are kept.
+TEST_F(OptimizeTreeTest, RemovesUnreadVariables)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "out vec4 my_FragColor;\n"
+        "float counter = 0.0;\n"
+        "float count() {\n"
+        "    counter += 1.0;\n"
+        "    return counter;\n"
+        "}\n"
+        "void main() {\n"
+        "    vec4 unused = vec4(u, u * 2.0, 0.0, 1.0);\n"
+        "    float stored;\n"
+        "    stored = u * 3.0;\n"
+        "    float called = count();\n"
+        "    float assigned;\n"
+        "    assigned = count();\n"
+        "    my_FragColor = vec4(counter);\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(notFoundInCode("unused"));
+    EXPECT_TRUE(notFoundInCode("stored"));
+    EXPECT_TRUE(notFoundInCode("assigned"));
+    EXPECT_TRUE(foundInCode("called = count()"));
+    EXPECT_TRUE(foundInCode("count()", 3));
+}
+
+// Statements after a jump are removed, except in switch statements where they can be reached
+// from a later case label.
+TEST_F(OptimizeTreeTest, RemovesUnreachableStatements)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "uniform int i;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    my_FragColor = vec4(0.0);\n"
+        "    switch (i) {\n"
+        "        case 0:\n"
+        "            my_FragColor = vec4(1.0);\n"
+        "            break;\n"
+        "        case 1:\n"
+        "            my_FragColor = vec4(2.0);\n"
+        "            break;\n"
+        "    }\n"
+        "    if (u > 0.0) {\n"
+        "        return;\n"
+        "        my_FragColor = vec4(3.0);\n"
+        "    }\n"
+        "}\n";
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("vec4(1.0"));
+    EXPECT_TRUE(foundInCode("vec4(2.0"));
+    EXPECT_TRUE(notFoundInCode("vec4(3.0"));
+}
+
+// Constants propagated into pow() don't defeat the workaround that removes pow() with a constant
+// exponent, since the workarounds run on the optimized tree.
+TEST_F(OptimizeTreeTest, RemovesPowWithPropagatedExponent)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    float e = 2.0;\n"
+        "    my_FragColor = vec4(pow(u, e));\n"
+        "}\n";
+    compile(shaderString, SH_OPTIMIZE_TREE | SH_REMOVE_POW_WITH_CONSTANT_EXPONENT);
+    EXPECT_TRUE(notFoundInCode("pow("));
+    EXPECT_TRUE(foundInCode("exp2("));
+    EXPECT_TRUE(foundInCode("log2("));
+}
+
+// Without the option, the code is translated as it is written.
+TEST_F(OptimizeTreeTest, OnlyOptimizesWithTheOption)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform float u;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    float unused = 1.0;\n"
+        "    bool enabled = false;\n"
+        "    my_FragColor = vec4(enabled ? 0.0 : u);\n"
+        "}\n";
+    compile(shaderString, 0);
+    EXPECT_TRUE(foundInCode("unused"));
+    EXPECT_TRUE(foundInCode("enabled"));
+}
+
+}  // anonymous namespace
@@ -0,0 +1,304 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PassManager_test.cpp:
+//   Tests that fused passes see the same visits and make the same changes as when they traverse
+//   the tree on their own.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PassManager.h"
+#include "compiler/translator/PoolAlloc.h"
+
+using namespace sh;
+
+namespace
+{
+
+// Records the visits it gets. Returns false from the pre-visit of |skippedOp| nodes.
+class RecordingTraverser : public TIntermTraverser
+{
+  public:
+    RecordingTraverser(std::vector<std::string> *visits, TOperator skippedOp, bool postVisit = true)
+        : TIntermTraverser(true, false, postVisit), mVisits(visits), mSkippedOp(skippedOp)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        mVisits->push_back(node->getSymbol().c_str());
+    }
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        mVisits->push_back(visit == PreVisit ? "binary pre" : "binary post");
+        return node->getOp() != mSkippedOp;
+    }
+
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        mVisits->push_back(visit == PreVisit ? "unary pre" : "unary post");
+        return node->getOp() != mSkippedOp;
+    }
+
+    bool visitBlock(Visit visit, TIntermBlock *node) override
+    {
+        mVisits->push_back(visit == PreVisit ? "block pre" : "block post");
+        return true;
+    }
+
+  private:
+    std::vector<std::string> *mVisits;
+    TOperator mSkippedOp;
+};
+
+constexpr TNodeKinds kRecordedNodes = kSymbolNode | kBinaryNode | kUnaryNode | kBlockNode;
+
+// Replaces negations with their operand.
+class RemoveNegationTraverser : public TIntermTraverser
+{
+  public:
+    RemoveNegationTraverser() : TIntermTraverser(true, false, false) {}
+
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        if (node->getOp() == EOpNegative)
+        {
+            queueReplacement(node, node->getOperand(), OriginalNode::IS_DROPPED);
+        }
+        return true;
+    }
+
+    static TPassTraits Traits()
+    {
+        TPassTraits traits;
+        traits.visits               = kUnaryNode;
+        traits.replaces             = kUnaryNode;
+        traits.changes              = kExpressionParentNodes;
+        traits.changesInPlace       = false;
+        traits.usesTraversalContext = true;
+        return traits;
+    }
+};
+
+// Inserts a copy of |inserted| before the statements that are the symbol |name|.
+class InsertBeforeSymbolTraverser : public TIntermTraverser
+{
+  public:
+    InsertBeforeSymbolTraverser(const char *name, TIntermSymbol *inserted)
+        : TIntermTraverser(true, false, false), mName(name), mInserted(inserted)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        if (node->getSymbol() == mName && getParentNode()->getAsBlock())
+        {
+            insertStatementInParentBlock(mInserted->deepCopy());
+        }
+    }
+
+    static TPassTraits Traits()
+    {
+        TPassTraits traits;
+        traits.visits               = kSymbolNode | kBlockNode;
+        traits.replaces             = 0;
+        traits.changes              = kSymbolNode | kBlockNode;
+        traits.changesInPlace       = false;
+        traits.usesTraversalContext = true;
+        return traits;
+    }
+
+  private:
+    const char *mName;
+    TIntermSymbol *mInserted;
+};
+
+class PassManagerTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mAllocator.push();
+        SetGlobalPoolAllocator(&mAllocator);
+        mRoot = createTree();
+    }
+
+    void TearDown() override
+    {
+        SetGlobalPoolAllocator(nullptr);
+        mAllocator.pop();
+    }
+
+    TIntermSymbol *createSymbol(const char *name)
+    {
+        return new TIntermSymbol(0, name, TType(EbtFloat, EbpHigh, EvqTemporary));
+    }
+
+    // { a + -b; c; }
+    TIntermBlock *createTree()
+    {
+        TIntermTyped *negated = new TIntermUnary(EOpNegative, createSymbol("b"));
+        TIntermBlock *root    = new TIntermBlock();
+        root->appendStatement(new TIntermBinary(EOpAdd, createSymbol("a"), negated));
+        root->appendStatement(createSymbol("c"));
+        return root;
+    }
+
+    std::vector<std::string> traverseAlone(TOperator skippedOp,
+                                           TIntermBlock *root = nullptr,
+                                           bool postVisit     = true)
+    {
+        std::vector<std::string> visits;
+        RecordingTraverser traverser(&visits, skippedOp, postVisit);
+        (root ? root : mRoot)->traverse(&traverser);
+        return visits;
+    }
+
+    TPoolAllocator mAllocator;
+    TIntermBlock *mRoot = nullptr;
+};
+
+// Analyses that skip different subtrees still get the visits they would get on their own.
+TEST_F(PassManagerTest, FusedAnalysesMatchSeparateTraversals)
+{
+    std::vector<std::string> skipBinary, skipUnary, skipNone;
+    std::vector<TPassStatistics> statistics;
+    int finishedCount = 0;
+    {
+        TPassManager passes(mRoot, &statistics);
+        passes.addAnalysis("SkipBinary", kRecordedNodes,
+                           std::unique_ptr<TIntermTraverser>(
+                               new RecordingTraverser(&skipBinary, EOpAdd)));
+        passes.addAnalysis("SkipUnary", kRecordedNodes,
+                           std::unique_ptr<TIntermTraverser>(
+                               new RecordingTraverser(&skipUnary, EOpNegative)),
+                           [&finishedCount]() { ++finishedCount; });
+        passes.addAnalysis("SkipNone", kRecordedNodes,
+                           std::unique_ptr<TIntermTraverser>(
+                               new RecordingTraverser(&skipNone, EOpNull)));
+        EXPECT_EQ(0, finishedCount);
+        passes.flush();
+    }
+
+    EXPECT_EQ(1, finishedCount);
+    EXPECT_EQ(traverseAlone(EOpAdd), skipBinary);
+    EXPECT_EQ(traverseAlone(EOpNegative), skipUnary);
+    EXPECT_EQ(traverseAlone(EOpNull), skipNone);
+
+    ASSERT_EQ(1u, statistics.size());
+    EXPECT_EQ("SkipBinary+SkipUnary+SkipNone", statistics[0].name);
+}
+
+// Without post-visits, the fused traversal still tells where the skipped subtrees end.
+TEST_F(PassManagerTest, FusedPreVisitsMatchSeparateTraversals)
+{
+    std::vector<std::string> skipBinary, skipUnary;
+    {
+        TPassManager passes(mRoot, nullptr);
+        passes.addAnalysis("SkipBinary", kRecordedNodes,
+                           std::unique_ptr<TIntermTraverser>(
+                               new RecordingTraverser(&skipBinary, EOpAdd, false)));
+        passes.addAnalysis("SkipUnary", kRecordedNodes,
+                           std::unique_ptr<TIntermTraverser>(
+                               new RecordingTraverser(&skipUnary, EOpNegative, false)));
+        passes.flush();
+    }
+
+    EXPECT_EQ(traverseAlone(EOpAdd, mRoot, false), skipBinary);
+    EXPECT_EQ(traverseAlone(EOpNegative, mRoot, false), skipUnary);
+}
+
+// Passes that change the tree run the queued analyses first, and analyses still queued when the
+// manager goes away don't run at all.
+TEST_F(PassManagerTest, PassesFlushQueuedAnalyses)
+{
+    std::vector<std::string> first, dropped;
+    std::vector<TPassStatistics> statistics;
+    {
+        TPassManager passes(mRoot, &statistics);
+        passes.addAnalysis("First", kRecordedNodes,
+                           std::unique_ptr<TIntermTraverser>(
+                               new RecordingTraverser(&first, EOpNull)));
+        EXPECT_FALSE(passes.run("Fail", [&first]() { return first.empty(); }));
+        passes.addAnalysis("Dropped", kRecordedNodes,
+                           std::unique_ptr<TIntermTraverser>(
+                               new RecordingTraverser(&dropped, EOpNull)));
+    }
+
+    EXPECT_EQ(traverseAlone(EOpNull), first);
+    EXPECT_TRUE(dropped.empty());
+
+    ASSERT_EQ(2u, statistics.size());
+    EXPECT_EQ("First", statistics[0].name);
+    EXPECT_EQ("Fail", statistics[1].name);
+}
+
+// Rewrites that don't conflict share a traversal with the analyses queued before them, and make
+// the same changes as when they run one after the other, which needs their traversal context.
+TEST_F(PassManagerTest, FusedRewritesMatchSeparateRewrites)
+{
+    TIntermBlock *separateRoot = createTree();
+    {
+        TPassManager passes(separateRoot, nullptr);
+        passes.addRewrite("InsertBeforeC", InsertBeforeSymbolTraverser::Traits(),
+                          std::unique_ptr<TIntermTraverser>(
+                              new InsertBeforeSymbolTraverser("c", createSymbol("d"))));
+        passes.flush();
+        passes.addRewrite("RemoveNegation", RemoveNegationTraverser::Traits(),
+                          std::unique_ptr<TIntermTraverser>(new RemoveNegationTraverser()));
+        passes.flush();
+    }
+
+    std::vector<std::string> original = traverseAlone(EOpNull);
+    std::vector<std::string> analysis;
+    std::vector<TPassStatistics> statistics;
+    {
+        TPassManager passes(mRoot, &statistics);
+        passes.addAnalysis("Record", kRecordedNodes,
+                           std::unique_ptr<TIntermTraverser>(
+                               new RecordingTraverser(&analysis, EOpNull)));
+        passes.addRewrite("InsertBeforeC", InsertBeforeSymbolTraverser::Traits(),
+                          std::unique_ptr<TIntermTraverser>(
+                              new InsertBeforeSymbolTraverser("c", createSymbol("d"))));
+        passes.addRewrite("RemoveNegation", RemoveNegationTraverser::Traits(),
+                          std::unique_ptr<TIntermTraverser>(new RemoveNegationTraverser()));
+        passes.flush();
+    }
+
+    EXPECT_EQ(original, analysis);
+    EXPECT_EQ(traverseAlone(EOpNull, separateRoot), traverseAlone(EOpNull));
+    EXPECT_EQ(8u, traverseAlone(EOpNull).size());
+
+    ASSERT_EQ(1u, statistics.size());
+    EXPECT_EQ("Record+InsertBeforeC+RemoveNegation", statistics[0].name);
+}
+
+// A pass that depends on what a queued rewrite changes runs after the rewrite is done.
+TEST_F(PassManagerTest, ConflictingPassesDontShareTraversals)
+{
+    std::vector<std::string> analysis;
+    std::vector<TPassStatistics> statistics;
+    {
+        TPassManager passes(mRoot, &statistics);
+        passes.addRewrite("RemoveNegation", RemoveNegationTraverser::Traits(),
+                          std::unique_ptr<TIntermTraverser>(new RemoveNegationTraverser()));
+        passes.addAnalysis("Record", kRecordedNodes,
+                           std::unique_ptr<TIntermTraverser>(
+                               new RecordingTraverser(&analysis, EOpNull)));
+        passes.flush();
+    }
+
+    EXPECT_EQ(traverseAlone(EOpNull), analysis);
+    EXPECT_EQ(7u, analysis.size());
+
+    ASSERT_EQ(2u, statistics.size());
+    EXPECT_EQ("RemoveNegation", statistics[0].name);
+    EXPECT_EQ("Record", statistics[1].name);
+}
+
+}  // anonymous namespace
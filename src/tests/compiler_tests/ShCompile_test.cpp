@@ -7,6 +7,9 @@
 //   Test the sh::Compile interface with different parameters.
 //
 
+#include <thread>
+#include <vector>
+
 #include "angle_gl.h"
 #include "gtest/gtest.h"
 #include "GLSLANG/ShaderLang.h"
@@ -41,6 +44,8 @@ class ShCompileTest : public testing::Test
         EXPECT_EQ(expectation, success) << compileLog;
     }
 
+    ShHandle getCompiler() const { return mCompiler; }
+
   private:
     ShBuiltInResources mResources;
     ShHandle mCompiler;
@@ -81,3 +86,200 @@ TEST_F(ShCompileTest, TokensSplitInShaderStrings)
 
     testCompile(shaderStrings, 3, true);
 }
+
+// Test that the pool allocator statistics are filled in and that later compiles reuse the pages of
+// the first one.
+TEST_F(ShCompileTest, PoolAllocatorStats)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 u;\n"
+        "void main() {\n"
+        "    gl_FragColor = u * 2.0;\n"
+        "}";
+
+    testCompile(&shaderString, 1, true);
+    sh::PoolAllocatorStats firstStats = sh::GetPoolAllocatorStats(getCompiler());
+    EXPECT_LT(0u, firstStats.allocationCount);
+    EXPECT_LT(0u, firstStats.allocatedBytes);
+    EXPECT_LE(firstStats.allocatedBytes, firstStats.peakBytes);
+    EXPECT_LT(0u, firstStats.pageCount);
+
+    testCompile(&shaderString, 1, true);
+    sh::PoolAllocatorStats secondStats = sh::GetPoolAllocatorStats(getCompiler());
+    EXPECT_LT(firstStats.allocationCount, secondStats.allocationCount);
+    EXPECT_EQ(firstStats.peakBytes, secondStats.peakBytes);
+    EXPECT_EQ(firstStats.pageCount, secondStats.pageCount);
+}
+
+// Test that SH_COMPILE_STATISTICS records the stages of the compilation, and that they are left
+// empty otherwise.
+TEST_F(ShCompileTest, CompileStatistics)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 u;\n"
+        "void main() {\n"
+        "    gl_FragColor = u * 2.0;\n"
+        "}";
+
+    ASSERT_TRUE(sh::Compile(getCompiler(), &shaderString, 1,
+                            SH_OBJECT_CODE | SH_VARIABLES | SH_COMPILE_STATISTICS));
+    sh::CompileStatistics statistics = sh::GetCompileStatistics(getCompiler());
+    ASSERT_LT(2u, statistics.stages.size());
+    EXPECT_EQ("Preprocess", statistics.stages.front().name);
+    EXPECT_EQ("Parse", statistics.stages[1].name);
+    EXPECT_LT(0u, statistics.stages[1].allocatedBytes);
+    EXPECT_EQ("Output", statistics.stages.back().name);
+
+    bool variablesCollected = false;
+    double stageSeconds     = 0.0;
+    for (const sh::CompileStageStatistics &stage : statistics.stages)
+    {
+        variablesCollected = variablesCollected ||
+                             stage.name.find("CollectVariables") != std::string::npos;
+        EXPECT_LE(0.0, stage.seconds) << stage.name;
+        stageSeconds += stage.seconds;
+    }
+    EXPECT_TRUE(variablesCollected);
+    EXPECT_LE(stageSeconds, statistics.totalSeconds);
+    EXPECT_LT(0u, statistics.poolAllocator.allocatedBytes);
+
+    ASSERT_TRUE(sh::Compile(getCompiler(), &shaderString, 1, SH_OBJECT_CODE));
+    statistics = sh::GetCompileStatistics(getCompiler());
+    EXPECT_TRUE(statistics.stages.empty());
+    EXPECT_EQ(0.0, statistics.totalSeconds);
+}
+
+// Test compiling shaders on several threads at the same time, each with its own compiler.
+TEST(ShCompileThreadsTest, ConcurrentCompiles)
+{
+    const char *shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform sampler2D s;\n"
+        "in vec4 v;\n"
+        "out vec4 color;\n"
+        "vec4 f(vec4 value) { return clamp(value, vec4(0.0), vec4(1.0)); }\n"
+        "void main() {\n"
+        "    color = f(v) + texture(s, v.xy);\n"
+        "}";
+
+    const int kThreadCount = 4;
+    std::vector<std::thread> threads;
+    std::vector<int> successCounts(kThreadCount, 0);
+    for (int threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([threadIndex, shaderString, &successCounts]() {
+            ShBuiltInResources resources;
+            sh::InitBuiltInResources(&resources);
+            for (int iteration = 0; iteration < 10; ++iteration)
+            {
+                ShHandle compiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                                          SH_ESSL_OUTPUT, &resources);
+                if (compiler == nullptr)
+                {
+                    continue;
+                }
+                const char *source = shaderString;
+                if (sh::Compile(compiler, &source, 1, SH_OBJECT_CODE | SH_VARIABLES))
+                {
+                    ++successCounts[threadIndex];
+                }
+                sh::Destruct(compiler);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int successCount : successCounts)
+    {
+        EXPECT_EQ(10, successCount);
+    }
+}
+
+// Test that a batch compile returns the results of every job in order, on several threads.
+TEST(ShCompileThreadsTest, CompileBatch)
+{
+    const std::string vertexShader =
+        "#version 300 es\n"
+        "in vec4 position;\n"
+        "uniform mat4 transform;\n"
+        "out vec4 v;\n"
+        "void main() {\n"
+        "    v = position;\n"
+        "    gl_Position = transform * position;\n"
+        "}";
+    const std::string fragmentShader =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "in vec4 v;\n"
+        "out vec4 color;\n"
+        "void main() {\n"
+        "    color = v;\n"
+        "}";
+    const std::string invalidShader =
+        "#version 300 es\n"
+        "void main() {\n"
+        "    undeclared = 1.0;\n"
+        "}";
+
+    std::vector<sh::BatchCompileJob> jobs;
+    for (int jobIndex = 0; jobIndex < 30; ++jobIndex)
+    {
+        sh::BatchCompileJob job;
+        switch (jobIndex % 3)
+        {
+            case 0:
+                job.type    = GL_VERTEX_SHADER;
+                job.sources = {vertexShader};
+                break;
+            case 1:
+                job.type    = GL_FRAGMENT_SHADER;
+                job.sources = {fragmentShader};
+                break;
+            default:
+                job.type    = GL_FRAGMENT_SHADER;
+                job.sources = {invalidShader};
+                break;
+        }
+        job.compileOptions = SH_OBJECT_CODE | SH_VARIABLES;
+        jobs.push_back(job);
+    }
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    std::vector<sh::BatchCompileResult> results =
+        sh::CompileBatch(SH_GLES3_SPEC, SH_ESSL_OUTPUT, resources, jobs, 4);
+    ASSERT_EQ(jobs.size(), results.size());
+
+    for (size_t jobIndex = 0; jobIndex < results.size(); ++jobIndex)
+    {
+        const sh::BatchCompileResult &result = results[jobIndex];
+        switch (jobIndex % 3)
+        {
+            case 0:
+                ASSERT_TRUE(result.success) << result.infoLog;
+                EXPECT_EQ(300, result.shaderVersion);
+                EXPECT_NE(std::string::npos, result.objectCode.find("gl_Position"));
+                ASSERT_EQ(1u, result.uniforms.size());
+                EXPECT_EQ("transform", result.uniforms[0].name);
+                ASSERT_EQ(1u, result.attributes.size());
+                EXPECT_EQ("position", result.attributes[0].name);
+                break;
+            case 1:
+                ASSERT_TRUE(result.success) << result.infoLog;
+                ASSERT_EQ(1u, result.outputVariables.size());
+                EXPECT_EQ("color", result.outputVariables[0].name);
+                break;
+            default:
+                EXPECT_FALSE(result.success);
+                EXPECT_NE(std::string::npos, result.infoLog.find("undeclared"));
+                EXPECT_TRUE(result.objectCode.empty());
+                break;
+        }
+    }
+}
@@ -0,0 +1,281 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// EGLBlobCacheTest.cpp:
+//   Tests that linked programs are handed to the setBlob platform method and loaded back through
+//   getBlob by a later display, using the file backed blob cache from util/.
+
+#include <gtest/gtest.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <cstdio>
+#include <iostream>
+
+#include "FileBlobCache.h"
+#include "platform/Platform.h"
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_configs.h"
+
+using namespace angle;
+
+namespace
+{
+
+constexpr char kCachePath[] = "angle_blob_cache_test.bin";
+constexpr size_t kCacheSize = 1024 * 1024;
+
+struct BlobCacheContext
+{
+    FileBlobCache *cache     = nullptr;
+    unsigned int setCount    = 0;
+    unsigned int getHitCount = 0;
+};
+
+void BlobCache_setBlob(PlatformMethods *platform,
+                       const void *key,
+                       size_t keySize,
+                       const void *value,
+                       size_t valueSize)
+{
+    auto *context = static_cast<BlobCacheContext *>(platform->context);
+    context->setCount++;
+    context->cache->set(key, keySize, value, valueSize);
+}
+
+size_t BlobCache_getBlob(PlatformMethods *platform,
+                         const void *key,
+                         size_t keySize,
+                         void *value,
+                         size_t valueSize)
+{
+    auto *context   = static_cast<BlobCacheContext *>(platform->context);
+    size_t blobSize = context->cache->get(key, keySize, value, valueSize);
+    if (value != nullptr && blobSize > 0 && valueSize >= blobSize)
+    {
+        context->getHitCount++;
+    }
+    return blobSize;
+}
+
+const std::string kVertexShader =
+    "attribute vec4 position;\n"
+    "uniform vec4 offset;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = position + offset;\n"
+    "}\n";
+
+const std::string kFragmentShader =
+    "precision mediump float;\n"
+    "uniform vec4 color;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = color;\n"
+    "}\n";
+
+class EGLBlobCacheTest : public ANGLETest
+{
+  protected:
+    void SetUp() override { std::remove(kCachePath); }
+
+    void TearDown() override
+    {
+        terminateDisplay();
+        std::remove(kCachePath);
+    }
+
+    void initializeDisplay(FileBlobCache *cache)
+    {
+        initializeDisplay(cache, GetParam().getRenderer());
+    }
+
+    // Initializes a display of the given renderer with a current context. The blob cache platform
+    // methods are set after eglInitialize, which resets the platform methods that aren't set by the
+    // test harness.
+    void initializeDisplay(FileBlobCache *cache, EGLint renderer)
+    {
+        auto eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        ASSERT_NE(nullptr, eglGetPlatformDisplayEXT);
+
+        EGLint displayAttribs[] = {EGL_PLATFORM_ANGLE_TYPE_ANGLE, renderer, EGL_NONE};
+        mDisplay = eglGetPlatformDisplayEXT(
+            EGL_PLATFORM_ANGLE_ANGLE, reinterpret_cast<void *>(EGL_DEFAULT_DISPLAY), displayAttribs);
+        ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+        ASSERT_EGL_TRUE(eglInitialize(mDisplay, nullptr, nullptr));
+
+        mBlobCacheContext       = BlobCacheContext();
+        mBlobCacheContext.cache = cache;
+
+        PlatformMethods *platformMethods = nullptr;
+        ASSERT_TRUE(ANGLEGetDisplayPlatform(mDisplay, g_PlatformMethodNames, g_NumPlatformMethods,
+                                            &mBlobCacheContext, &platformMethods));
+        platformMethods->setBlob = BlobCache_setBlob;
+        platformMethods->getBlob = BlobCache_getBlob;
+
+        const EGLint configAttribs[] = {EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE,
+                                        EGL_OPENGL_ES2_BIT, EGL_NONE};
+        EGLConfig config  = 0;
+        EGLint numConfigs = 0;
+        ASSERT_EGL_TRUE(eglChooseConfig(mDisplay, configAttribs, &config, 1, &numConfigs));
+        ASSERT_EQ(1, numConfigs);
+
+        const EGLint surfaceAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+        mSurface = eglCreatePbufferSurface(mDisplay, config, surfaceAttribs);
+        ASSERT_NE(EGL_NO_SURFACE, mSurface);
+
+        const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, GetParam().majorVersion,
+                                         EGL_NONE};
+        mContext = eglCreateContext(mDisplay, config, EGL_NO_CONTEXT, contextAttribs);
+        ASSERT_NE(EGL_NO_CONTEXT, mContext);
+
+        ASSERT_EGL_TRUE(eglMakeCurrent(mDisplay, mSurface, mSurface, mContext));
+    }
+
+    // Terminating the display also drops the programs kept in memory, so the next display can
+    // only find them through getBlob.
+    void terminateDisplay()
+    {
+        if (mDisplay == EGL_NO_DISPLAY)
+        {
+            return;
+        }
+
+        eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (mContext != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(mDisplay, mContext);
+            mContext = EGL_NO_CONTEXT;
+        }
+        if (mSurface != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(mDisplay, mSurface);
+            mSurface = EGL_NO_SURFACE;
+        }
+        eglTerminate(mDisplay);
+        mDisplay = EGL_NO_DISPLAY;
+    }
+
+    EGLDisplay mDisplay = EGL_NO_DISPLAY;
+    EGLSurface mSurface = EGL_NO_SURFACE;
+    EGLContext mContext = EGL_NO_CONTEXT;
+    BlobCacheContext mBlobCacheContext;
+};
+
+// Tests that a program linked by one display is loaded from the cache file by the next one,
+// with the same uniform locations.
+TEST_P(EGLBlobCacheTest, ProgramIsLoadedFromFile)
+{
+    GLint colorLocation = -1;
+    {
+        FileBlobCache cache(kCachePath, kCacheSize);
+        initializeDisplay(&cache);
+
+        GLuint program = CompileProgram(kVertexShader, kFragmentShader);
+        ASSERT_NE(0u, program);
+        colorLocation = glGetUniformLocation(program, "color");
+        EXPECT_NE(-1, colorLocation);
+        glDeleteProgram(program);
+
+        EXPECT_EQ(1u, mBlobCacheContext.setCount);
+        EXPECT_EQ(0u, mBlobCacheContext.getHitCount);
+
+        terminateDisplay();
+        EXPECT_EQ(1u, cache.entryCount());
+        ASSERT_TRUE(cache.flush());
+    }
+
+    // A new cache reads the blob back from the file, like it would in a new process.
+    FileBlobCache cache(kCachePath, kCacheSize);
+    EXPECT_EQ(1u, cache.entryCount());
+    initializeDisplay(&cache);
+
+    GLuint program = CompileProgram(kVertexShader, kFragmentShader);
+    ASSERT_NE(0u, program);
+    EXPECT_EQ(1u, mBlobCacheContext.getHitCount);
+    EXPECT_EQ(0u, mBlobCacheContext.setCount);
+    EXPECT_EQ(colorLocation, glGetUniformLocation(program, "color"));
+
+    glUseProgram(program);
+    glUniform4f(colorLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    EXPECT_GL_NO_ERROR();
+
+    glDeleteProgram(program);
+    terminateDisplay();
+}
+
+// Tests that programs linked from the same shaders but with other attribute bindings aren't
+// loaded from each other's blobs.
+TEST_P(EGLBlobCacheTest, AttributeBindingsAreInTheKey)
+{
+    FileBlobCache cache(kCachePath, kCacheSize);
+    initializeDisplay(&cache);
+
+    GLuint first = CompileProgram(kVertexShader, kFragmentShader);
+    ASSERT_NE(0u, first);
+
+    GLuint vertexShader   = CompileShader(GL_VERTEX_SHADER, kVertexShader);
+    GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+    GLuint second         = glCreateProgram();
+    glAttachShader(second, vertexShader);
+    glAttachShader(second, fragmentShader);
+    glBindAttribLocation(second, 3, "position");
+    glLinkProgram(second);
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(second, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_TRUE(linkStatus);
+    EXPECT_EQ(3, glGetAttribLocation(second, "position"));
+
+    EXPECT_EQ(2u, mBlobCacheContext.setCount);
+    EXPECT_EQ(0u, mBlobCacheContext.getHitCount);
+    EXPECT_EQ(2u, cache.entryCount());
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    glDeleteProgram(first);
+    glDeleteProgram(second);
+    terminateDisplay();
+}
+
+// Tests that a program saved by one renderer isn't loaded by another one, which couldn't use its
+// binary.
+TEST_P(EGLBlobCacheTest, OtherRendererMisses)
+{
+    if (GetParam().getRenderer() == EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE)
+    {
+        std::cout << "Test skipped because the other renderer is the NULL backend." << std::endl;
+        return;
+    }
+
+    FileBlobCache cache(kCachePath, kCacheSize);
+    initializeDisplay(&cache);
+
+    GLuint program = CompileProgram(kVertexShader, kFragmentShader);
+    ASSERT_NE(0u, program);
+    glDeleteProgram(program);
+    EXPECT_EQ(1u, mBlobCacheContext.setCount);
+    terminateDisplay();
+
+    // The NULL backend accepts any binary, so loading the blob would succeed if it were found.
+    initializeDisplay(&cache, EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+
+    program = CompileProgram(kVertexShader, kFragmentShader);
+    ASSERT_NE(0u, program);
+    EXPECT_EQ(0u, mBlobCacheContext.getHitCount);
+    EXPECT_EQ(1u, mBlobCacheContext.setCount);
+    EXPECT_EQ(2u, cache.entryCount());
+
+    glDeleteProgram(program);
+    terminateDisplay();
+}
+
+// The GL backend depends on the driver returning program binaries, so it isn't tested here.
+ANGLE_INSTANTIATE_TEST(EGLBlobCacheTest, ES2_D3D9(), ES2_D3D11(), ES2_NULL());
+
+}  // anonymous namespace
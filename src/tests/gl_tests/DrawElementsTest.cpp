@@ -264,5 +264,109 @@ TEST_P(DrawElementsTest, DeletingAfterStreamingIndexes)
     ASSERT_GL_NO_ERROR();
 }
 
+class DrawElementsNoErrorTest : public ANGLETest
+{
+  protected:
+    DrawElementsNoErrorTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+        setNoErrorEnabled(true);
+    }
+};
+
+// Test that contexts created with EGL_CONTEXT_OPENGL_NO_ERROR_KHR expose GL_KHR_no_error.
+TEST_P(DrawElementsNoErrorTest, ExtensionExposed)
+{
+    EXPECT_TRUE(extensionEnabled("GL_KHR_no_error"));
+}
+
+// Test that indexed draws still get a correct index range when validation is skipped, both with
+// an element array buffer and with client-side indices. The indices only reference the second
+// half of the vertex data, so a wrong range would pull the red vertices.
+TEST_P(DrawElementsNoErrorTest, IndexRangeWithoutValidation)
+{
+    const std::string &vertexShader =
+        "attribute vec2 position;\n"
+        "attribute vec4 color;\n"
+        "varying vec4 v_color;\n"
+        "void main() {\n"
+        "  gl_Position = vec4(position, 0, 1);\n"
+        "  v_color = color;\n"
+        "}";
+
+    const std::string &fragmentShader =
+        "varying highp vec4 v_color;\n"
+        "void main() {\n"
+        "  gl_FragColor = v_color;\n"
+        "}";
+
+    ANGLE_GL_PROGRAM(program, vertexShader, fragmentShader);
+    glUseProgram(program.get());
+
+    GLint positionLocation = glGetAttribLocation(program.get(), "position");
+    ASSERT_NE(-1, positionLocation);
+    GLint colorLocation = glGetAttribLocation(program.get(), "color");
+    ASSERT_NE(-1, colorLocation);
+
+    const GLfloat positionData[] = {
+        -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f,
+        -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f,
+    };
+    const GLubyte colorData[] = {
+        255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255,
+        0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255,
+    };
+    const GLushort indexData[] = {4, 5, 6, 6, 7, 4};
+
+    GLBuffer positionBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, positionBuffer.get());
+    glBufferData(GL_ARRAY_BUFFER, sizeof(positionData), positionData, GL_STATIC_DRAW);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    GLBuffer colorBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, colorBuffer.get());
+    glBufferData(GL_ARRAY_BUFFER, sizeof(colorData), colorData, GL_STATIC_DRAW);
+    glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, nullptr);
+    glEnableVertexAttribArray(colorLocation);
+
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.get());
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indexData), indexData, GL_STATIC_DRAW);
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    ASSERT_GL_NO_ERROR();
+    if (!IsNULL())
+    {
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+    }
+
+    // A zero count draw is dropped rather than reaching the back-end.
+    glDrawElements(GL_TRIANGLES, 0, GL_UNSIGNED_SHORT, nullptr);
+    ASSERT_GL_NO_ERROR();
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, indexData);
+    ASSERT_GL_NO_ERROR();
+    if (!IsNULL())
+    {
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+    }
+}
+
 ANGLE_INSTANTIATE_TEST(DrawElementsTest, ES3_OPENGL(), ES3_OPENGLES());
+ANGLE_INSTANTIATE_TEST(DrawElementsNoErrorTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES2_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES2_NULL());
 }
@@ -0,0 +1,219 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ParallelShaderCompileTest.cpp : Tests of the GL_KHR_parallel_shader_compile extension.
+
+#include "test_utils/ANGLETest.h"
+
+using namespace angle;
+
+namespace
+{
+
+const std::string kVertexShader =
+    "attribute vec4 position;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = position;\n"
+    "}\n";
+
+const std::string kFragmentShader =
+    "precision mediump float;\n"
+    "uniform vec4 color;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = color;\n"
+    "}\n";
+
+class ParallelShaderCompileTest : public ANGLETest
+{
+  protected:
+    ParallelShaderCompileTest()
+    {
+        setWindowWidth(128);
+        setWindowHeight(128);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    bool ensureParallelShaderCompileExtensionAvailable()
+    {
+        if (!extensionEnabled("GL_KHR_parallel_shader_compile"))
+        {
+            std::cout << "Test skipped because GL_KHR_parallel_shader_compile is not available."
+                      << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    GLuint compileShader(GLenum type, const std::string &source)
+    {
+        GLuint shader          = glCreateShader(type);
+        const char *sourceText = source.c_str();
+        glShaderSource(shader, 1, &sourceText, nullptr);
+        glCompileShader(shader);
+        return shader;
+    }
+
+    // Polls the completion status, which must not fail while the work is running.
+    void waitForCompletion(GLuint object, bool isProgram)
+    {
+        GLint completed = GL_FALSE;
+        while (completed == GL_FALSE)
+        {
+            if (isProgram)
+            {
+                glGetProgramiv(object, GL_COMPLETION_STATUS_KHR, &completed);
+            }
+            else
+            {
+                glGetShaderiv(object, GL_COMPLETION_STATUS_KHR, &completed);
+            }
+            ASSERT_GL_NO_ERROR();
+        }
+    }
+};
+
+// Tests that the thread count can be set and queried.
+TEST_P(ParallelShaderCompileTest, MaxShaderCompilerThreads)
+{
+    if (!ensureParallelShaderCompileExtensionAvailable())
+    {
+        return;
+    }
+
+    GLint count = 0;
+    glMaxShaderCompilerThreadsKHR(8);
+    glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &count);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(8, count);
+
+    glMaxShaderCompilerThreadsKHR(0);
+    glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &count);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(0, count);
+}
+
+// Tests that shaders and programs report their status once their completion status is true,
+// and that the program draws.
+TEST_P(ParallelShaderCompileTest, LinkAndDraw)
+{
+    if (!ensureParallelShaderCompileExtensionAvailable())
+    {
+        return;
+    }
+
+    GLuint vertexShader   = compileShader(GL_VERTEX_SHADER, kVertexShader);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+    waitForCompletion(vertexShader, false);
+    waitForCompletion(fragmentShader, false);
+
+    GLint compileStatus = GL_FALSE;
+    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_GL_TRUE(compileStatus);
+    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_GL_TRUE(compileStatus);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    waitForCompletion(program, true);
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_TRUE(linkStatus);
+
+    glUseProgram(program);
+    glUniform4f(glGetUniformLocation(program, "color"), 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(program, "position", 0.5f);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    glDeleteProgram(program);
+}
+
+// Tests that queries other than the completion status wait for the compile and link, and that
+// failures are reported.
+TEST_P(ParallelShaderCompileTest, QueriesWait)
+{
+    if (!ensureParallelShaderCompileExtensionAvailable())
+    {
+        return;
+    }
+
+    GLuint vertexShader   = compileShader(GL_VERTEX_SHADER, kVertexShader);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, "void main() { undefined(); }");
+
+    GLint compileStatus = GL_TRUE;
+    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &compileStatus);
+    EXPECT_GL_FALSE(compileStatus);
+
+    GLint completed = GL_FALSE;
+    glGetShaderiv(fragmentShader, GL_COMPLETION_STATUS_KHR, &completed);
+    EXPECT_GL_TRUE(completed);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+
+    GLint linkStatus = GL_TRUE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_FALSE(linkStatus);
+    EXPECT_GL_NO_ERROR();
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    glDeleteProgram(program);
+}
+
+// Tests that the shaders of a program that is still linking can be compiled again.
+TEST_P(ParallelShaderCompileTest, RecompileWhileLinking)
+{
+    if (!ensureParallelShaderCompileExtensionAvailable())
+    {
+        return;
+    }
+
+    GLuint vertexShader   = compileShader(GL_VERTEX_SHADER, kVertexShader);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+
+    const char *badSource = "void main() { undefined(); }";
+    glShaderSource(fragmentShader, 1, &badSource, nullptr);
+    glCompileShader(fragmentShader);
+
+    // The link used the shader that was compiled when the link started.
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_GL_TRUE(linkStatus);
+    EXPECT_GL_NO_ERROR();
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    glDeleteProgram(program);
+}
+
+ANGLE_INSTANTIATE_TEST(ParallelShaderCompileTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES3_D3D11(),
+                       ES2_OPENGL(),
+                       ES3_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES3_OPENGLES());
+
+}  // anonymous namespace
@@ -1702,6 +1702,51 @@ TEST_P(CHROMIUMPathRenderingWithTexturingTest, TestConflictingBind)
     ASSERT_GL_NO_ERROR();
 }
 
+// Test that a program with conflicting fragment input bindings fails to link even if a program
+// with the same shaders and without conflicts was linked before, and could be loaded from the
+// program cache.
+TEST_P(CHROMIUMPathRenderingWithTexturingTest, TestConflictingBindAfterLinkWithoutConflicts)
+{
+    if (!isApplicable())
+        return;
+
+    // clang-format off
+    const char* kVertexShaderSource =
+        "attribute vec4 position;\n"
+        "varying vec4 colorA;\n"
+        "varying vec4 colorB;\n"
+        "void main() {\n"
+        "  gl_Position = position;\n"
+        "  colorA = position + vec4(1);\n"
+        "  colorB = position + vec4(2);\n"
+        "}";
+
+    const char* kFragmentShaderSource =
+        "precision mediump float;\n"
+        "varying vec4 colorA;\n"
+        "varying vec4 colorB;\n"
+        "void main() {\n"
+        "  gl_FragColor = colorA + colorB;\n"
+        "}";
+    // clang-format on
+
+    const GLint kColorALocation = 3;
+    const GLint kColorBLocation = 4;
+
+    compileProgram(kVertexShaderSource, kFragmentShaderSource);
+    glBindFragmentInputLocationCHROMIUM(mProgram, kColorALocation, "colorA");
+    glBindFragmentInputLocationCHROMIUM(mProgram, kColorBLocation, "colorB");
+    ASSERT_TRUE(linkProgram() == true);
+    ASSERT_GL_NO_ERROR();
+
+    glDeleteProgram(mProgram);
+    compileProgram(kVertexShaderSource, kFragmentShaderSource);
+    glBindFragmentInputLocationCHROMIUM(mProgram, kColorALocation, "colorA");
+    glBindFragmentInputLocationCHROMIUM(mProgram, kColorALocation, "colorB");
+    ASSERT_TRUE(linkProgram() == false);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Test binding with array variables, using zero indices. Tests that
 // binding colorA[0] with explicit "colorA[0]" as well as "colorA" produces
 // a correct location that can be used with PathProgramFragmentInputGen.
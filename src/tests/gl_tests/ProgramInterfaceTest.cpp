@@ -72,6 +72,64 @@ TEST_P(ProgramInterfaceTestES31, GetResourceIndex)
     EXPECT_GL_ERROR(GL_INVALID_ENUM);
 }
 
+// Tests glGetProgramResourceIndex with uniforms, uniform blocks and transform feedback varyings.
+TEST_P(ProgramInterfaceTestES31, GetResourceIndexUniformsAndVaryings)
+{
+    const std::string &vertexShaderSource =
+        "#version 310 es\n"
+        "precision highp float;\n"
+        "in highp vec4 position;\n"
+        "out vec4 v;\n"
+        "out float w[2];\n"
+        "void main()\n"
+        "{\n"
+        "    v = position;\n"
+        "    w[0] = position.x;\n"
+        "    w[1] = position.y;\n"
+        "    gl_Position = position;\n"
+        "}";
+
+    const std::string &fragmentShaderSource =
+        "#version 310 es\n"
+        "precision highp float;\n"
+        "uniform vec4 arr[3];\n"
+        "uniform Block { vec4 blockMember; } blockInstance[2];\n"
+        "in vec4 v;\n"
+        "in float w[2];\n"
+        "out vec4 oColor;\n"
+        "void main()\n"
+        "{\n"
+        "    oColor = arr[2] + v + w[0] + w[1] + blockInstance[1].blockMember;\n"
+        "}";
+
+    std::vector<std::string> tfVaryings;
+    tfVaryings.push_back("v");
+    tfVaryings.push_back("w[1]");
+    GLuint program = CompileProgramWithTransformFeedback(vertexShaderSource, fragmentShaderSource,
+                                                         tfVaryings, GL_INTERLEAVED_ATTRIBS);
+    ASSERT_NE(0u, program);
+
+    GLuint index = glGetProgramResourceIndex(program, GL_UNIFORM, "arr");
+    EXPECT_GL_NO_ERROR();
+    EXPECT_NE(GL_INVALID_INDEX, index);
+    EXPECT_EQ(index, glGetProgramResourceIndex(program, GL_UNIFORM, "arr[0]"));
+    EXPECT_EQ(GL_INVALID_INDEX, glGetProgramResourceIndex(program, GL_UNIFORM, "missing"));
+
+    GLuint blockIndex = glGetProgramResourceIndex(program, GL_UNIFORM_BLOCK, "Block[1]");
+    EXPECT_GL_NO_ERROR();
+    EXPECT_NE(GL_INVALID_INDEX, blockIndex);
+    EXPECT_EQ(blockIndex, glGetUniformBlockIndex(program, "Block[1]"));
+    EXPECT_EQ(GL_INVALID_INDEX, glGetProgramResourceIndex(program, GL_UNIFORM_BLOCK, "Block[2]"));
+
+    EXPECT_EQ(0u, glGetProgramResourceIndex(program, GL_TRANSFORM_FEEDBACK_VARYING, "v"));
+    EXPECT_EQ(1u, glGetProgramResourceIndex(program, GL_TRANSFORM_FEEDBACK_VARYING, "w[1]"));
+    EXPECT_EQ(GL_INVALID_INDEX,
+              glGetProgramResourceIndex(program, GL_TRANSFORM_FEEDBACK_VARYING, "w[0]"));
+    EXPECT_GL_NO_ERROR();
+
+    glDeleteProgram(program);
+}
+
 // Tests glGetProgramResourceName.
 TEST_P(ProgramInterfaceTestES31, GetResourceName)
 {
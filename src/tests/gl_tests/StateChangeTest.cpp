@@ -600,6 +600,215 @@ TEST_P(StateChangeRenderTest, GenerateMipmap)
     EXPECT_GL_NO_ERROR();
 }
 
+// Validation must be enabled for these tests, since they check that the cached result of the
+// draw-time state validation is dropped when the state it depends on changes.
+class StateChangeValidationTest : public ANGLETest
+{
+  protected:
+    StateChangeValidationTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+};
+
+class StateChangeValidationTestES3 : public StateChangeValidationTest
+{
+};
+
+// Test that a draw is rejected after a previously valid framebuffer is made incomplete by
+// redefining its attachment, and accepted again once it is complete.
+TEST_P(StateChangeValidationTest, DrawAfterFramebufferAttachmentRedefined)
+{
+    const std::string vertexShader =
+        "attribute vec2 position;\n"
+        "void main() { gl_Position = vec4(position, 0, 1); }";
+    const std::string fragmentShader = "void main() { gl_FragColor = vec4(1, 0, 0, 1); }";
+    ANGLE_GL_PROGRAM(program, vertexShader, fragmentShader);
+    glUseProgram(program.get());
+
+    GLRenderbuffer renderbuffer;
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer.get());
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA4, 16, 16);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer.get());
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                              renderbuffer.get());
+
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    ASSERT_GL_NO_ERROR();
+
+    // A zero-sized attachment makes the framebuffer incomplete.
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA4, 0, 0);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_ERROR(GL_INVALID_FRAMEBUFFER_OPERATION);
+
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA4, 16, 16);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that a draw is rejected after a sampler uniform change makes two samplers of different
+// types refer to the same texture unit.
+TEST_P(StateChangeValidationTest, DrawAfterSamplerUniformConflict)
+{
+    const std::string vertexShader =
+        "attribute vec2 position;\n"
+        "void main() { gl_Position = vec4(position, 0, 1); }";
+    const std::string fragmentShader =
+        "precision mediump float;\n"
+        "uniform sampler2D tex2D;\n"
+        "uniform samplerCube texCube;\n"
+        "void main() { gl_FragColor = texture2D(tex2D, vec2(0)) + textureCube(texCube, vec3(0)); }";
+    ANGLE_GL_PROGRAM(program, vertexShader, fragmentShader);
+    glUseProgram(program.get());
+
+    GLint tex2DLocation   = glGetUniformLocation(program.get(), "tex2D");
+    GLint texCubeLocation = glGetUniformLocation(program.get(), "texCube");
+    ASSERT_NE(-1, tex2DLocation);
+    ASSERT_NE(-1, texCubeLocation);
+
+    glUniform1i(tex2DLocation, 0);
+    glUniform1i(texCubeLocation, 1);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    ASSERT_GL_NO_ERROR();
+
+    glUniform1i(texCubeLocation, 0);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glUniform1i(texCubeLocation, 1);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that a draw is rejected after the buffer backing a uniform block is unbound, or shrunk
+// below the size of the block.
+TEST_P(StateChangeValidationTestES3, DrawAfterUniformBufferChanged)
+{
+    const std::string vertexShader =
+        "#version 300 es\n"
+        "in vec2 position;\n"
+        "void main() { gl_Position = vec4(position, 0, 1); }";
+    const std::string fragmentShader =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform block { vec4 color; };\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = color; }";
+    ANGLE_GL_PROGRAM(program, vertexShader, fragmentShader);
+    glUseProgram(program.get());
+
+    GLuint blockIndex = glGetUniformBlockIndex(program.get(), "block");
+    ASSERT_NE(GL_INVALID_INDEX, blockIndex);
+    glUniformBlockBinding(program.get(), blockIndex, 0);
+
+    GLBuffer uniformBuffer;
+    glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer.get());
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(GLfloat) * 4, nullptr, GL_STATIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, uniformBuffer.get());
+
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    ASSERT_GL_NO_ERROR();
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, 0);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, uniformBuffer.get());
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_NO_ERROR();
+
+    // The null backend does not compute uniform block sizes.
+    if (IsNULL())
+    {
+        std::cout << "Test skipped on NULL." << std::endl;
+        return;
+    }
+
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(GLfloat), nullptr, GL_STATIC_DRAW);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(GLfloat) * 4, nullptr, GL_STATIC_DRAW);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that a draw is rejected after a context sharing the uniform buffer shrinks it below the
+// size of the block.
+TEST_P(StateChangeValidationTestES3, DrawAfterUniformBufferResizedInSharedContext)
+{
+    // The null backend does not compute uniform block sizes.
+    if (IsNULL())
+    {
+        std::cout << "Test skipped on NULL." << std::endl;
+        return;
+    }
+
+    const std::string vertexShader =
+        "#version 300 es\n"
+        "in vec2 position;\n"
+        "void main() { gl_Position = vec4(position, 0, 1); }";
+    const std::string fragmentShader =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "uniform block { vec4 color; };\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = color; }";
+    ANGLE_GL_PROGRAM(program, vertexShader, fragmentShader);
+    glUseProgram(program.get());
+
+    GLuint blockIndex = glGetUniformBlockIndex(program.get(), "block");
+    ASSERT_NE(GL_INVALID_INDEX, blockIndex);
+    glUniformBlockBinding(program.get(), blockIndex, 0);
+
+    GLBuffer uniformBuffer;
+    glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer.get());
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(GLfloat) * 4, nullptr, GL_STATIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, uniformBuffer.get());
+
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    ASSERT_GL_NO_ERROR();
+
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+    EGLSurface surface = window->getSurface();
+
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR, GetParam().majorVersion, EGL_CONTEXT_MINOR_VERSION_KHR,
+        GetParam().minorVersion, EGL_NONE,
+    };
+    EGLContext sharedContext =
+        eglCreateContext(display, window->getConfig(), window->getContext(), contextAttributes);
+    ASSERT_NE(EGL_NO_CONTEXT, sharedContext);
+
+    // Shrink the buffer from the other context.
+    eglMakeCurrent(display, surface, surface, sharedContext);
+    glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer.get());
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(GLfloat), nullptr, GL_STATIC_DRAW);
+    ASSERT_GL_NO_ERROR();
+
+    eglMakeCurrent(display, surface, surface, window->getContext());
+    eglDestroyContext(display, sharedContext);
+
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(GLfloat) * 4, nullptr, GL_STATIC_DRAW);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_NO_ERROR();
+}
+
 ANGLE_INSTANTIATE_TEST(StateChangeTest, ES2_D3D9(), ES2_D3D11(), ES2_OPENGL());
 ANGLE_INSTANTIATE_TEST(StateChangeRenderTest,
                        ES2_D3D9(),
@@ -607,3 +816,5 @@ ANGLE_INSTANTIATE_TEST(StateChangeRenderTest,
                        ES2_OPENGL(),
                        ES2_D3D11_FL9_3());
 ANGLE_INSTANTIATE_TEST(StateChangeTestES3, ES3_D3D11(), ES3_OPENGL());
+ANGLE_INSTANTIATE_TEST(StateChangeValidationTest, ES2_D3D11(), ES2_OPENGL(), ES2_NULL());
+ANGLE_INSTANTIATE_TEST(StateChangeValidationTestES3, ES3_D3D11(), ES3_OPENGL(), ES3_NULL());
@@ -91,6 +91,8 @@ std::string RenderTestParams::suffix() const
             return "_default";
         case EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE:
             return "_vulkan";
+        case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE:
+            return "_null";
         default:
             assert(0);
             return "_unk";
@@ -117,6 +119,7 @@ void ANGLERenderTest::SetUp()
     mEGLWindow = new EGLWindow(mTestParams.majorVersion, mTestParams.minorVersion,
                                mTestParams.eglParameters);
     mEGLWindow->setSwapInterval(0);
+    mEGLWindow->setNoErrorEnabled(mTestParams.noError);
 
     if (!mOSWindow->initialize(mName, mTestParams.windowWidth, mTestParams.windowHeight))
     {
@@ -78,6 +78,9 @@ struct RenderTestParams : public angle::PlatformParameters
 
     EGLint windowWidth;
     EGLint windowHeight;
+
+    // Creates the context with EGL_CONTEXT_OPENGL_NO_ERROR_KHR.
+    bool noError = false;
 };
 
 class ANGLERenderTest : public ANGLEPerfTest
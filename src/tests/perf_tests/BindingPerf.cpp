@@ -192,6 +192,15 @@ BindingsParams OpenGLParams(AllocationStyle allocationStyle)
     return params;
 }
 
+BindingsParams NullParams(AllocationStyle allocationStyle, size_t numObjects)
+{
+    BindingsParams params;
+    params.eglParameters   = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    params.allocationStyle = allocationStyle;
+    params.numObjects      = numObjects;
+    return params;
+}
+
 TEST_P(BindingsBenchmark, Run)
 {
     run();
@@ -203,6 +212,10 @@ ANGLE_INSTANTIATE_TEST(BindingsBenchmark,
                        D3D9Params(EVERY_ITERATION),
                        D3D9Params(AT_INITIALIZATION),
                        OpenGLParams(EVERY_ITERATION),
-                       OpenGLParams(AT_INITIALIZATION));
+                       OpenGLParams(AT_INITIALIZATION),
+                       NullParams(EVERY_ITERATION, 100),
+                       NullParams(AT_INITIALIZATION, 100),
+                       NullParams(EVERY_ITERATION, 1000),
+                       NullParams(AT_INITIALIZATION, 1000));
 
 }  // namespace angle
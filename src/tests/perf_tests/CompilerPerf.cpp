@@ -0,0 +1,189 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompilerPerf:
+//   CPU-only performance test for the shader translator, compiling large generated shaders.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "angle_gl.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace
+{
+
+struct CompilerPerfParams final
+{
+    std::string suffix() const;
+
+    ShShaderOutput output;
+    unsigned int functionCount;
+    ShCompileOptions workarounds;
+};
+
+std::string CompilerPerfParams::suffix() const
+{
+    std::stringstream strstr;
+
+    switch (output)
+    {
+        case SH_ESSL_OUTPUT:
+            strstr << "_essl";
+            break;
+        case SH_GLSL_COMPATIBILITY_OUTPUT:
+            strstr << "_glsl";
+            break;
+        default:
+            strstr << "_output_" << output;
+            break;
+    }
+
+    strstr << "_" << functionCount << "_functions";
+
+    if (workarounds != 0)
+    {
+        strstr << "_workarounds";
+    }
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const CompilerPerfParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+// Generates a fragment shader where every function declares globals and locals and calls
+// built-ins and the previous function, so parsing is dominated by symbol lookups. The loop, the
+// short circuit and the pow call give the driver workaround rewrites something to change.
+std::string GenerateShader(unsigned int functionCount)
+{
+    std::stringstream shader;
+    shader << "#version 300 es\n"
+              "precision highp float;\n"
+              "in vec4 v_position;\n"
+              "out vec4 color;\n";
+
+    for (unsigned int function = 0; function < functionCount; ++function)
+    {
+        shader << "const vec4 c" << function << " = vec4(" << function << ".0, 0.5, 0.25, 1.0);\n"
+               << "vec4 f" << function << "(vec4 value, float scale)\n"
+               << "{\n"
+               << "    vec4 local = value * scale + c" << function << ";\n"
+               << "    float len = length(local.xyz) + dot(local, c" << function << ");\n"
+               << "    local = clamp(local, vec4(0.0), vec4(len));\n";
+        if (function > 0)
+        {
+            shader << "    local += f" << (function - 1) << "(local.wzyx, scale * 0.5);\n";
+        }
+        shader << "    for (int i = 0; i < 2 && len > 0.0; ++i)\n"
+               << "    {\n"
+               << "        local.w += pow(abs(local.x), 2.0);\n"
+               << "    }\n"
+               << "    return mix(local, value, fract(len));\n"
+               << "}\n";
+    }
+
+    shader << "void main()\n"
+           << "{\n"
+           << "    color = f" << (functionCount - 1) << "(v_position, 2.0);\n"
+           << "}\n";
+    return shader.str();
+}
+
+class CompilerPerfBenchmark : public ANGLEPerfTest,
+                              public ::testing::WithParamInterface<CompilerPerfParams>
+{
+  public:
+    CompilerPerfBenchmark();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    ShHandle mCompiler = nullptr;
+    std::string mSource;
+};
+
+CompilerPerfBenchmark::CompilerPerfBenchmark()
+    : ANGLEPerfTest("CompilerPerf", GetParam().suffix())
+{
+}
+
+void CompilerPerfBenchmark::SetUp()
+{
+    const auto &params = GetParam();
+
+    ASSERT_TRUE(sh::Initialize());
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    mCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, params.output, &resources);
+    ASSERT_NE(nullptr, mCompiler);
+
+    mSource = GenerateShader(params.functionCount);
+
+    ANGLEPerfTest::SetUp();
+}
+
+void CompilerPerfBenchmark::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    if (mCompiler)
+    {
+        sh::Destruct(mCompiler);
+        mCompiler = nullptr;
+    }
+    sh::Finalize();
+}
+
+void CompilerPerfBenchmark::step()
+{
+    const char *source = mSource.c_str();
+    if (!sh::Compile(mCompiler, &source, 1,
+                     SH_OBJECT_CODE | SH_VARIABLES | GetParam().workarounds))
+    {
+        abortTest();
+        FAIL() << sh::GetInfoLog(mCompiler);
+    }
+}
+
+CompilerPerfParams CompilerParams(ShShaderOutput output,
+                                  unsigned int functionCount,
+                                  ShCompileOptions workarounds = 0)
+{
+    CompilerPerfParams params;
+    params.output        = output;
+    params.functionCount = functionCount;
+    params.workarounds   = workarounds;
+    return params;
+}
+
+// The driver workaround rewrites that are queued to share traversals with other passes.
+constexpr ShCompileOptions kFusedWorkarounds = SH_ADD_AND_TRUE_TO_LOOP_CONDITION |
+                                               SH_UNFOLD_SHORT_CIRCUIT |
+                                               SH_REMOVE_POW_WITH_CONSTANT_EXPONENT;
+
+TEST_P(CompilerPerfBenchmark, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        CompilerPerfBenchmark,
+                        ::testing::Values(CompilerParams(SH_ESSL_OUTPUT, 20),
+                                          CompilerParams(SH_ESSL_OUTPUT, 500),
+                                          CompilerParams(SH_GLSL_COMPATIBILITY_OUTPUT, 500),
+                                          CompilerParams(SH_GLSL_COMPATIBILITY_OUTPUT,
+                                                         500,
+                                                         kFusedWorkarounds)));
+
+}  // anonymous namespace
@@ -0,0 +1,173 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ComputeIndexRangePerf:
+//   CPU-only performance test for the scalar and vector gl::ComputeIndexRange kernels.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <iostream>
+#include <sstream>
+
+#include "common/utilities.h"
+
+namespace
+{
+
+struct ComputeIndexRangeParams final
+{
+    std::string suffix() const;
+
+    gl::IndexRangeKernel kernel;
+    GLenum indexType;
+    bool primitiveRestart;
+    size_t indexCount       = 64 * 1024;
+    unsigned int iterations = 100;
+};
+
+std::string ComputeIndexRangeParams::suffix() const
+{
+    std::stringstream strstr;
+
+    switch (kernel)
+    {
+        case gl::IndexRangeKernel::Scalar:
+            strstr << "_scalar";
+            break;
+        case gl::IndexRangeKernel::SSE2:
+            strstr << "_sse2";
+            break;
+        case gl::IndexRangeKernel::SSE41:
+            strstr << "_sse41";
+            break;
+        case gl::IndexRangeKernel::AVX2:
+            strstr << "_avx2";
+            break;
+    }
+
+    switch (indexType)
+    {
+        case GL_UNSIGNED_BYTE:
+            strstr << "_ubyte";
+            break;
+        case GL_UNSIGNED_SHORT:
+            strstr << "_ushort";
+            break;
+        case GL_UNSIGNED_INT:
+            strstr << "_uint";
+            break;
+    }
+
+    if (primitiveRestart)
+    {
+        strstr << "_primitive_restart";
+    }
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const ComputeIndexRangeParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+class ComputeIndexRangePerfBenchmark : public ANGLEPerfTest,
+                                       public ::testing::WithParamInterface<ComputeIndexRangeParams>
+{
+  public:
+    ComputeIndexRangePerfBenchmark();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mIndexData;
+    size_t mRangeSum = 0;
+};
+
+ComputeIndexRangePerfBenchmark::ComputeIndexRangePerfBenchmark()
+    : ANGLEPerfTest("ComputeIndexRange", GetParam().suffix())
+{
+}
+
+void ComputeIndexRangePerfBenchmark::SetUp()
+{
+    const auto &params = GetParam();
+    if (!gl::IsIndexRangeKernelSupported(params.kernel))
+    {
+        std::cout << "Kernel not supported on this CPU." << std::endl;
+        abortTest();
+    }
+
+    // A pseudo-random pattern, with a restart index every 16 indices. The restart index is the
+    // largest value of the type, so it also gives the size of one index.
+    GLuint restart   = gl::GetPrimitiveRestartIndex(params.indexType);
+    size_t indexSize = (restart == 0xFFu) ? 1u : (restart == 0xFFFFu ? 2u : 4u);
+    mIndexData.resize(params.indexCount * indexSize);
+    for (size_t i = 0; i < params.indexCount; ++i)
+    {
+        GLuint value = (i % 16 == 15) ? restart : static_cast<GLuint>((i * 7919u) % restart);
+        memcpy(&mIndexData[i * indexSize], &value, indexSize);
+    }
+
+    ANGLEPerfTest::SetUp();
+}
+
+void ComputeIndexRangePerfBenchmark::step()
+{
+    const auto &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterations; ++iteration)
+    {
+        gl::IndexRange range =
+            gl::ComputeIndexRangeWithKernel(params.kernel, params.indexType, mIndexData.data(),
+                                            params.indexCount, params.primitiveRestart);
+        mRangeSum += range.end - range.start;
+    }
+
+    // Keep the results alive so the computation is not optimized away.
+    ASSERT_NE(0u, mRangeSum);
+}
+
+ComputeIndexRangeParams IndexRangeParams(gl::IndexRangeKernel kernel,
+                                         GLenum indexType,
+                                         bool primitiveRestart)
+{
+    ComputeIndexRangeParams params;
+    params.kernel           = kernel;
+    params.indexType        = indexType;
+    params.primitiveRestart = primitiveRestart;
+    return params;
+}
+
+TEST_P(ComputeIndexRangePerfBenchmark, Run)
+{
+    run();
+}
+
+using gl::IndexRangeKernel;
+
+INSTANTIATE_TEST_CASE_P(
+    ,
+    ComputeIndexRangePerfBenchmark,
+    ::testing::Values(IndexRangeParams(IndexRangeKernel::Scalar, GL_UNSIGNED_BYTE, false),
+                      IndexRangeParams(IndexRangeKernel::SSE2, GL_UNSIGNED_BYTE, false),
+                      IndexRangeParams(IndexRangeKernel::AVX2, GL_UNSIGNED_BYTE, false),
+                      IndexRangeParams(IndexRangeKernel::Scalar, GL_UNSIGNED_SHORT, false),
+                      IndexRangeParams(IndexRangeKernel::SSE2, GL_UNSIGNED_SHORT, false),
+                      IndexRangeParams(IndexRangeKernel::SSE41, GL_UNSIGNED_SHORT, false),
+                      IndexRangeParams(IndexRangeKernel::AVX2, GL_UNSIGNED_SHORT, false),
+                      IndexRangeParams(IndexRangeKernel::Scalar, GL_UNSIGNED_SHORT, true),
+                      IndexRangeParams(IndexRangeKernel::SSE2, GL_UNSIGNED_SHORT, true),
+                      IndexRangeParams(IndexRangeKernel::SSE41, GL_UNSIGNED_SHORT, true),
+                      IndexRangeParams(IndexRangeKernel::AVX2, GL_UNSIGNED_SHORT, true),
+                      IndexRangeParams(IndexRangeKernel::Scalar, GL_UNSIGNED_INT, false),
+                      IndexRangeParams(IndexRangeKernel::SSE2, GL_UNSIGNED_INT, false),
+                      IndexRangeParams(IndexRangeKernel::SSE41, GL_UNSIGNED_INT, false),
+                      IndexRangeParams(IndexRangeKernel::AVX2, GL_UNSIGNED_INT, false)));
+
+}  // anonymous namespace
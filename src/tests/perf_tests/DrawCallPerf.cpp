@@ -106,10 +106,15 @@ ANGLE_INSTANTIATE_TEST(DrawCallPerfBenchmark,
                        DrawCallPerfD3D11Params(false, false),
                        DrawCallPerfD3D11Params(true, false),
                        DrawCallPerfD3D11Params(true, true),
+                       DrawCallPerfNoError(DrawCallPerfD3D11Params(true, false)),
                        DrawCallPerfOpenGLParams(false, false),
                        DrawCallPerfOpenGLParams(true, false),
                        DrawCallPerfOpenGLParams(true, true),
+                       DrawCallPerfNoError(DrawCallPerfOpenGLParams(true, false)),
                        DrawCallPerfValidationOnly(),
+                       DrawCallPerfNoError(DrawCallPerfValidationOnly()),
+                       DrawCallPerfNullParams(),
+                       DrawCallPerfNoError(DrawCallPerfNullParams()),
                        DrawCallPerfVulkanParams(false));
 
 } // namespace
@@ -38,6 +38,11 @@ std::string DrawCallPerfParams::suffix() const
         strstr << "_null";
     }
 
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
     return strstr.str();
 }
 
@@ -77,6 +82,20 @@ DrawCallPerfParams DrawCallPerfValidationOnly()
     return params;
 }
 
+DrawCallPerfParams DrawCallPerfNullParams()
+{
+    DrawCallPerfParams params;
+    params.eglParameters = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    return params;
+}
+
+DrawCallPerfParams DrawCallPerfNoError(const DrawCallPerfParams &base)
+{
+    DrawCallPerfParams params = base;
+    params.noError            = true;
+    return params;
+}
+
 DrawCallPerfParams DrawCallPerfVulkanParams(bool renderToTexture)
 {
     DrawCallPerfParams params;
@@ -43,6 +43,11 @@ DrawCallPerfParams DrawCallPerfOpenGLParams(bool useNullDevice, bool renderToTex
 
 DrawCallPerfParams DrawCallPerfValidationOnly();
 
+DrawCallPerfParams DrawCallPerfNullParams();
+
+// Same as |base| but with a KHR_no_error context, to measure the cost of validation.
+DrawCallPerfParams DrawCallPerfNoError(const DrawCallPerfParams &base);
+
 DrawCallPerfParams DrawCallPerfVulkanParams(bool renderToTexture);
 
 #endif  // TESTS_PERF_TESTS_DRAW_CALL_PERF_PARAMS_H_
@@ -0,0 +1,243 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PreprocessorPerf:
+//   CPU-only performance tests for the GLSL preprocessor, running it on generated shaders that
+//   expand nested object-like and function-like macros many times, and running its tokenizer
+//   alone on large commented shaders.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+#include "compiler/preprocessor/Tokenizer.h"
+
+namespace
+{
+
+class NullDiagnostics : public pp::Diagnostics
+{
+  protected:
+    void print(ID id, const pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public pp::DirectiveHandler
+{
+  public:
+    void handleError(const pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {
+    }
+    void handleExtension(const pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {
+    }
+    void handleVersion(const pp::SourceLocation &loc, int version) override {}
+};
+
+struct PreprocessorPerfParams final
+{
+    std::string suffix() const;
+
+    unsigned int statementCount;
+};
+
+std::string PreprocessorPerfParams::suffix() const
+{
+    std::stringstream strstr;
+    strstr << "_" << statementCount << "_statements";
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const PreprocessorPerfParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+// Generates a shader in the style of the generated uber-shaders: every statement expands a chain
+// of function-like macros whose arguments are themselves macro invocations.
+std::string GenerateMacroHeavyShader(unsigned int statementCount)
+{
+    std::stringstream shader;
+    shader << "#version 300 es\n"
+              "precision highp float;\n"
+              "#define SCALE 2.0\n"
+              "#define OFFSET vec4(0.5, 0.25, 0.125, 1.0)\n"
+              "#define MAD(a, b, c) ((a) * (b) + (c))\n"
+              "#define LERP(a, b, t) MAD((b) - (a), t, a)\n"
+              "#define STEP(v) LERP(v, MAD(v, SCALE, OFFSET), 0.5)\n"
+              "#define SATURATE(v) clamp(v, vec4(0.0), vec4(1.0))\n"
+              "in vec4 v_position;\n"
+              "out vec4 color;\n"
+              "void main()\n"
+              "{\n"
+              "    vec4 value = v_position;\n";
+
+    for (unsigned int statement = 0; statement < statementCount; ++statement)
+    {
+        shader << "    value = SATURATE(STEP(STEP(value)) * " << statement << ".0);\n";
+    }
+
+    shader << "    color = value;\n"
+           << "}\n";
+    return shader.str();
+}
+
+// Generates a shader in the style of hand-written code: indented statements with long identifiers,
+// line comments and block comments, but no macros.
+std::string GenerateCommentedShader(unsigned int statementCount)
+{
+    std::stringstream shader;
+    shader << "#version 300 es\n"
+              "precision highp float;\n"
+              "/*\n"
+              " * Accumulates the lighting of many lights. Every statement is commented, like\n"
+              " * in shaders that are written by hand rather than generated.\n"
+              " */\n"
+              "in vec4 v_position;\n"
+              "out vec4 color;\n"
+              "void main()\n"
+              "{\n"
+              "    vec4 accumulatedLighting = vec4(0.0);\n";
+
+    for (unsigned int statement = 0; statement < statementCount; ++statement)
+    {
+        shader << "    // Add the contribution of light " << statement
+               << ", attenuated by distance.\n"
+               << "    accumulatedLighting += v_position * " << statement
+               << ".5e-3 /* attenuation */ + vec4(0x" << std::hex << statement << std::dec
+               << "u);\n";
+    }
+
+    shader << "    color = accumulatedLighting;\n"
+           << "}\n";
+    return shader.str();
+}
+
+class PreprocessorPerfBenchmark : public ANGLEPerfTest,
+                                  public ::testing::WithParamInterface<PreprocessorPerfParams>
+{
+  public:
+    PreprocessorPerfBenchmark();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    std::string mSource;
+};
+
+PreprocessorPerfBenchmark::PreprocessorPerfBenchmark()
+    : ANGLEPerfTest("PreprocessorPerf", GetParam().suffix())
+{
+}
+
+void PreprocessorPerfBenchmark::SetUp()
+{
+    mSource = GenerateMacroHeavyShader(GetParam().statementCount);
+
+    ANGLEPerfTest::SetUp();
+}
+
+void PreprocessorPerfBenchmark::step()
+{
+    NullDiagnostics diagnostics;
+    NullDirectiveHandler directiveHandler;
+    pp::Preprocessor preprocessor(&diagnostics, &directiveHandler, pp::PreprocessorSettings());
+
+    const char *source = mSource.c_str();
+    if (!preprocessor.init(1, &source, nullptr))
+    {
+        abortTest();
+        FAIL() << "Could not initialize the preprocessor.";
+    }
+
+    pp::Token token;
+    do
+    {
+        preprocessor.lex(&token);
+    } while (token.type != pp::Token::LAST);
+}
+
+class TokenizerPerfBenchmark : public ANGLEPerfTest,
+                               public ::testing::WithParamInterface<PreprocessorPerfParams>
+{
+  public:
+    TokenizerPerfBenchmark();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    std::string mSource;
+};
+
+TokenizerPerfBenchmark::TokenizerPerfBenchmark()
+    : ANGLEPerfTest("TokenizerPerf", GetParam().suffix())
+{
+}
+
+void TokenizerPerfBenchmark::SetUp()
+{
+    mSource = GenerateCommentedShader(GetParam().statementCount);
+
+    ANGLEPerfTest::SetUp();
+}
+
+void TokenizerPerfBenchmark::step()
+{
+    NullDiagnostics diagnostics;
+    pp::Tokenizer tokenizer(&diagnostics);
+
+    const char *source = mSource.c_str();
+    if (!tokenizer.init(1, &source, nullptr))
+    {
+        abortTest();
+        FAIL() << "Could not initialize the tokenizer.";
+    }
+
+    pp::Token token;
+    do
+    {
+        tokenizer.lex(&token);
+    } while (token.type != pp::Token::LAST);
+}
+
+PreprocessorPerfParams PreprocessorParams(unsigned int statementCount)
+{
+    PreprocessorPerfParams params;
+    params.statementCount = statementCount;
+    return params;
+}
+
+TEST_P(PreprocessorPerfBenchmark, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        PreprocessorPerfBenchmark,
+                        ::testing::Values(PreprocessorParams(100), PreprocessorParams(1000)));
+
+TEST_P(TokenizerPerfBenchmark, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        TokenizerPerfBenchmark,
+                        ::testing::Values(PreprocessorParams(1000), PreprocessorParams(10000)));
+
+}  // anonymous namespace
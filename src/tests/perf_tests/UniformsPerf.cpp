@@ -314,6 +314,13 @@ UniformsParams VectorUniforms(const EGLPlatformParameters &egl, DataMode dataMod
     return params;
 }
 
+// The null backend only runs the front-end, so these measure the cost of storing and syncing
+// uniform data without the driver.
+EGLPlatformParameters NullPlatform()
+{
+    return EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+}
+
 UniformsParams MatrixUniforms(const EGLPlatformParameters &egl, DataMode dataMode)
 {
     UniformsParams params;
@@ -328,6 +335,17 @@ UniformsParams MatrixUniforms(const EGLPlatformParameters &egl, DataMode dataMod
     return params;
 }
 
+UniformsParams NullMatrixUniforms(DataMode dataMode)
+{
+    UniformsParams params = MatrixUniforms(NullPlatform(), dataMode);
+
+    // The null backend only reports the ES 3.0 minimum of 224 fragment uniform vectors.
+    params.numVertexUniforms   = 50;
+    params.numFragmentUniforms = 50;
+
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(UniformsBenchmark, Run)
@@ -344,4 +362,8 @@ ANGLE_INSTANTIATE_TEST(UniformsBenchmark,
                        MatrixUniforms(D3D11(), DataMode::REPEAT),
                        MatrixUniforms(D3D11(), DataMode::UPDATE),
                        MatrixUniforms(OPENGL(), DataMode::REPEAT),
-                       MatrixUniforms(OPENGL(), DataMode::UPDATE));
+                       MatrixUniforms(OPENGL(), DataMode::UPDATE),
+                       VectorUniforms(NullPlatform(), DataMode::REPEAT),
+                       VectorUniforms(NullPlatform(), DataMode::UPDATE),
+                       NullMatrixUniforms(DataMode::REPEAT),
+                       NullMatrixUniforms(DataMode::UPDATE));
@@ -0,0 +1,109 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// WorkerThreadPerf:
+//   CPU-only performance test for the throughput of the worker thread pool, posting many trivial
+//   tasks and waiting on all of them every step.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <atomic>
+#include <sstream>
+#include <vector>
+
+#include "common/WorkerThread.h"
+
+namespace
+{
+
+struct WorkerThreadPerfParams final
+{
+    std::string suffix() const;
+
+    size_t threadCount;
+    unsigned int taskCount;
+};
+
+std::string WorkerThreadPerfParams::suffix() const
+{
+    std::stringstream strstr;
+    strstr << "_" << threadCount << "_threads_" << taskCount << "_tasks";
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const WorkerThreadPerfParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+void IncrementCounter(void *counter)
+{
+    (*static_cast<std::atomic<unsigned int> *>(counter))++;
+}
+
+class WorkerThreadPerfBenchmark : public ANGLEPerfTest,
+                                  public ::testing::WithParamInterface<WorkerThreadPerfParams>
+{
+  public:
+    WorkerThreadPerfBenchmark();
+
+    void step() override;
+
+  private:
+    angle::WorkerThreadPool mWorkerPool;
+    std::vector<angle::WaitableEvent> mWaitables;
+};
+
+WorkerThreadPerfBenchmark::WorkerThreadPerfBenchmark()
+    : ANGLEPerfTest("WorkerThreadPerf", GetParam().suffix()), mWorkerPool(GetParam().threadCount)
+{
+    mWaitables.reserve(GetParam().taskCount);
+}
+
+void WorkerThreadPerfBenchmark::step()
+{
+    const unsigned int taskCount = GetParam().taskCount;
+
+    std::atomic<unsigned int> counter(0);
+    for (unsigned int taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        mWaitables.push_back(mWorkerPool.postWorkerTask(&IncrementCounter, &counter));
+    }
+
+    for (angle::WaitableEvent &waitable : mWaitables)
+    {
+        waitable.wait();
+    }
+    mWaitables.clear();
+
+    if (counter != taskCount)
+    {
+        abortTest();
+        FAIL() << "Some of the tasks didn't run.";
+    }
+}
+
+WorkerThreadPerfParams WorkerThreadParams(size_t threadCount, unsigned int taskCount)
+{
+    WorkerThreadPerfParams params;
+    params.threadCount = threadCount;
+    params.taskCount   = taskCount;
+    return params;
+}
+
+TEST_P(WorkerThreadPerfBenchmark, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        WorkerThreadPerfBenchmark,
+                        ::testing::Values(WorkerThreadParams(1, 1000),
+                                          WorkerThreadParams(4, 1000),
+                                          WorkerThreadParams(4, 10000)));
+
+}  // anonymous namespace
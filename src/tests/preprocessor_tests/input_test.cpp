@@ -176,3 +176,22 @@ TEST(InputTest, ReadStringsWithLineContinuation)
     EXPECT_EQ(2, lineNo);
     EXPECT_STREQ("foobar", buf);
 }
+
+// Reading nothing means the end of the input, so read must not stop after skipping only one of
+// several line continuations in a row.
+TEST(InputTest, ReadConsecutiveLineContinuations)
+{
+    int count = 2;
+    const char* str[] = {"a\\\n\\\r\n", "\\\nb"};
+    char buf[4] = {'\0', '\0', '\0', '\0'};
+    size_t maxSize = 4;
+    int lineNo = 0;
+
+    pp::Input input(count, str, 0);
+    EXPECT_EQ(1u, input.read(buf, maxSize, &lineNo));
+    EXPECT_EQ(0, lineNo);
+    EXPECT_EQ(1u, input.read(buf + 1, maxSize - 1, &lineNo));
+    EXPECT_EQ(3, lineNo);
+    EXPECT_EQ(0u, input.read(buf + 2, maxSize - 2, &lineNo));
+    EXPECT_STREQ("ab", buf);
+}
@@ -26,6 +26,8 @@
 #ifndef THIRD_PARTY_COMPILER_ARRAYBOUNDSCLAMPER_H_
 #define THIRD_PARTY_COMPILER_ARRAYBOUNDSCLAMPER_H_
 
+#include <memory>
+
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
 
@@ -45,6 +47,10 @@ class ArrayBoundsClamper
     // requiring clamping.
     void MarkIndirectArrayBoundsForClamping(TIntermNode* root);
 
+    // Same as above, as a traverser that can share a traversal with
+    // other passes.
+    std::unique_ptr<TIntermTraverser> CreateIndirectArrayBoundsMarker();
+
     // If necessary, output array clamp function source into the shader source.
     void OutputClampingFunctionDefinition(TInfoSinkBase& out) const;
 
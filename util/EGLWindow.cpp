@@ -326,6 +326,15 @@ bool EGLWindow::initializeContext()
         return false;
     }
 
+    bool hasKHRCreateContextNoError =
+        strstr(displayExtensions, "EGL_KHR_create_context_no_error") != nullptr;
+    if (mNoError && !hasKHRCreateContextNoError)
+    {
+        // Non-default state requested without the extension present
+        destroyGL();
+        return false;
+    }
+
     eglBindAPI(EGL_OPENGL_ES_API);
     if (eglGetError() != EGL_SUCCESS)
     {
@@ -345,12 +354,11 @@ bool EGLWindow::initializeContext()
         contextAttributes.push_back(EGL_CONTEXT_OPENGL_DEBUG);
         contextAttributes.push_back(mDebug ? EGL_TRUE : EGL_FALSE);
 
-        // TODO(jmadill): Check for the extension string.
-        // bool hasKHRCreateContextNoError = strstr(displayExtensions,
-        // "EGL_KHR_create_context_no_error") != nullptr;
-
-        contextAttributes.push_back(EGL_CONTEXT_OPENGL_NO_ERROR_KHR);
-        contextAttributes.push_back(mNoError ? EGL_TRUE : EGL_FALSE);
+        if (hasKHRCreateContextNoError)
+        {
+            contextAttributes.push_back(EGL_CONTEXT_OPENGL_NO_ERROR_KHR);
+            contextAttributes.push_back(mNoError ? EGL_TRUE : EGL_FALSE);
+        }
 
         if (hasWebGLCompatibility)
         {
@@ -0,0 +1,189 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FileBlobCache.cpp: Implementation of the file backed blob cache.
+
+#include "FileBlobCache.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <fstream>
+
+namespace
+{
+
+// The file starts with the magic and the version, followed by the number of blobs and the blobs
+// themselves, from the least to the most recently used one. Each blob is written as the size of
+// its key, the size of its value, the key and the value.
+constexpr char kMagic[8]    = {'A', 'N', 'G', 'L', 'E', 'B', 'L', 'B'};
+constexpr uint32_t kVersion = 1;
+
+template <typename T>
+bool Read(std::istream &stream, T *value)
+{
+    return static_cast<bool>(stream.read(reinterpret_cast<char *>(value), sizeof(T)));
+}
+
+template <typename T>
+void Write(std::ostream &stream, T value)
+{
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+bool ReadString(std::istream &stream, uint64_t size, std::string *stringOut)
+{
+    stringOut->resize(static_cast<size_t>(size));
+    return size == 0 || static_cast<bool>(stream.read(&(*stringOut)[0], size));
+}
+
+}  // anonymous namespace
+
+FileBlobCache::FileBlobCache(const std::string &path, size_t maxTotalSize)
+    : mPath(path), mMaxTotalSize(maxTotalSize), mTotalSize(0), mDirty(false)
+{
+    std::ifstream file(mPath, std::ios::binary);
+    if (!file)
+    {
+        return;
+    }
+
+    char magic[sizeof(kMagic)];
+    uint32_t version = 0;
+    uint32_t count   = 0;
+    if (!file.read(magic, sizeof(magic)) || memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !Read(file, &version) || version != kVersion || !Read(file, &count))
+    {
+        return;
+    }
+
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        uint64_t keySize   = 0;
+        uint64_t valueSize = 0;
+        std::string key;
+        std::string value;
+        if (!Read(file, &keySize) || !Read(file, &valueSize) ||
+            keySize + valueSize > maxTotalSize || !ReadString(file, keySize, &key) ||
+            !ReadString(file, valueSize, &value))
+        {
+            // A truncated file keeps the blobs read so far.
+            break;
+        }
+
+        insert(std::move(key), std::move(value));
+    }
+
+    evict();
+}
+
+FileBlobCache::~FileBlobCache()
+{
+    flush();
+}
+
+void FileBlobCache::set(const void *key, size_t keySize, const void *value, size_t valueSize)
+{
+    if (keySize + valueSize > mMaxTotalSize)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    insert(std::string(static_cast<const char *>(key), keySize),
+           std::string(static_cast<const char *>(value), valueSize));
+    evict();
+    mDirty = true;
+}
+
+size_t FileBlobCache::get(const void *key, size_t keySize, void *value, size_t valueSize)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto indexIter = mIndex.find(std::string(static_cast<const char *>(key), keySize));
+    if (indexIter == mIndex.end())
+    {
+        return 0;
+    }
+
+    const std::string &blob = indexIter->second->second;
+    if (value && valueSize >= blob.size())
+    {
+        memcpy(value, blob.data(), blob.size());
+
+        // Only a use of the blob counts, not the query of its size.
+        mEntries.splice(mEntries.begin(), mEntries, indexIter->second);
+    }
+
+    return blob.size();
+}
+
+bool FileBlobCache::flush()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mDirty)
+    {
+        return true;
+    }
+
+    std::ofstream file(mPath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    file.write(kMagic, sizeof(kMagic));
+    Write(file, kVersion);
+    Write(file, static_cast<uint32_t>(mEntries.size()));
+    for (auto entryIter = mEntries.rbegin(); entryIter != mEntries.rend(); ++entryIter)
+    {
+        Write(file, static_cast<uint64_t>(entryIter->first.size()));
+        Write(file, static_cast<uint64_t>(entryIter->second.size()));
+        file.write(entryIter->first.data(), entryIter->first.size());
+        file.write(entryIter->second.data(), entryIter->second.size());
+    }
+
+    mDirty = !file.flush();
+    return !mDirty;
+}
+
+size_t FileBlobCache::entryCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEntries.size();
+}
+
+size_t FileBlobCache::totalSize() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mTotalSize;
+}
+
+void FileBlobCache::insert(std::string &&key, std::string &&value)
+{
+    auto indexIter = mIndex.find(key);
+    if (indexIter != mIndex.end())
+    {
+        const Entry &oldEntry = *indexIter->second;
+        mTotalSize -= oldEntry.first.size() + oldEntry.second.size();
+        mEntries.erase(indexIter->second);
+        mIndex.erase(indexIter);
+    }
+
+    mTotalSize += key.size() + value.size();
+    mEntries.emplace_front(std::move(key), std::move(value));
+    mIndex[mEntries.front().first] = mEntries.begin();
+}
+
+void FileBlobCache::evict()
+{
+    while (mTotalSize > mMaxTotalSize)
+    {
+        const Entry &oldest = mEntries.back();
+        mTotalSize -= oldest.first.size() + oldest.second.size();
+        mIndex.erase(oldest.first);
+        mEntries.pop_back();
+    }
+}
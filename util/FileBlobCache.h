@@ -0,0 +1,61 @@
+//
+// Copyright 2017 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FileBlobCache.h: A blob cache kept in a single file, which can back the setBlob and getBlob
+//   platform methods. The whole cache is read when it is created and written back by flush.
+//   Once the blobs grow above the maximum size, the least recently used ones are dropped.
+
+#ifndef UTIL_FILEBLOBCACHE_H_
+#define UTIL_FILEBLOBCACHE_H_
+
+#include <stddef.h>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <export.h>
+
+#include "common/angleutils.h"
+
+class ANGLE_EXPORT FileBlobCache final : angle::NonCopyable
+{
+  public:
+    // Reads the cache from the file, if it exists and was written by a FileBlobCache.
+    FileBlobCache(const std::string &path, size_t maxTotalSize);
+    ~FileBlobCache();
+
+    // Same semantics as the setBlob and getBlob platform methods.
+    void set(const void *key, size_t keySize, const void *value, size_t valueSize);
+    size_t get(const void *key, size_t keySize, void *value, size_t valueSize);
+
+    // Writes the cache to its file if it changed. Returns false if the file can't be written.
+    bool flush();
+
+    size_t entryCount() const;
+    size_t totalSize() const;
+
+  private:
+    using Entry     = std::pair<std::string, std::string>;
+    using EntryList = std::list<Entry>;
+
+    void insert(std::string &&key, std::string &&value);
+    void evict();
+
+    const std::string mPath;
+    const size_t mMaxTotalSize;
+
+    mutable std::mutex mMutex;
+
+    // Ordered from the most to the least recently used blob.
+    EntryList mEntries;
+    std::map<std::string, EntryList::iterator> mIndex;
+    size_t mTotalSize;
+    bool mDirty;
+};
+
+#endif  // UTIL_FILEBLOBCACHE_H_
@@ -22,6 +22,8 @@
             'Event.h',
             'EGLWindow.cpp',
             'EGLWindow.h',
+            'FileBlobCache.cpp',
+            'FileBlobCache.h',
             'Matrix.cpp',
             'Matrix.h',
             'OSPixmap.h',